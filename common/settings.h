@@ -206,10 +206,19 @@ struct Settings {
 
   bool use_asset_fonts = true;
 
+  // Load and parse the asset fonts on the concurrent worker pool as soon as
+  // they are registered, instead of when text first uses them.
+  bool preload_asset_fonts = false;
+
   // Indicates whether the embedding started a prefetch of the default font
   // manager before creating the engine.
   bool prefetched_default_font_manager = false;
 
+  // Combine the consecutive moves of a pointer delivered within one frame into
+  // one event. The framework then sees fewer events from high frequency input
+  // devices, but can't use the intermediate positions to estimate velocities.
+  bool coalesce_pointer_moves = false;
+
   // Enable the rendering of colors outside of the sRGB gamut.
   bool enable_wide_gamut = false;
 
@@ -232,6 +241,12 @@ struct Settings {
   // Some devices claim to support the required APIs but crash on their usage.
   bool enable_opengl_gpu_tracing = false;
 
+  // Skip Impeller runtime effects whose pipelines are still compiling instead
+  // of stalling the frame until they are ready. A skipped effect is drawn on
+  // the next frame after its pipeline is ready, which only happens if
+  // something else schedules that frame.
+  bool impeller_async_runtime_effect_compilation = false;
+
   // Data set by platform-specific embedders for use in font initialization.
   uint32_t font_initialization_data = 0;
 
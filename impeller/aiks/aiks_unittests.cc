@@ -2253,6 +2253,120 @@ TEST_P(AiksTest, ClipRectElidesNoOpClips) {
   ASSERT_EQ(render_pass->GetCommands().size(), 0llu);
 }
 
+static std::shared_ptr<ContextSpy> RenderPictureWithSpy(
+    const std::shared_ptr<Context>& real_context,
+    Picture picture) {
+  std::shared_ptr<ContextSpy> spy = ContextSpy::Make();
+  std::shared_ptr<ContextMock> mock_context = spy->MakeContext(real_context);
+  AiksContext renderer(mock_context, nullptr);
+  std::shared_ptr<Image> image = picture.ToImage(renderer, {300, 300});
+  return spy;
+}
+
+TEST_P(AiksTest, ScissorClipNestedInStencilClip) {
+  Canvas canvas;
+  canvas.ClipOval(Rect::MakeLTRB(0, 0, 200, 200));
+  canvas.ClipRect(Rect::MakeLTRB(50, 50, 150, 150));
+  canvas.DrawRect(Rect::MakeLTRB(0, 0, 200, 200), {.color = Color::Red()});
+
+  auto spy = RenderPictureWithSpy(GetContext(), canvas.EndRecordingAsPicture());
+
+  ASSERT_EQ(spy->render_passes_.size(), 1llu);
+  const auto& commands = spy->render_passes_[0]->GetCommands();
+  // The oval is drawn to the stencil buffer. The rect is not.
+  ASSERT_EQ(commands.size(), 2llu);
+  EXPECT_EQ(commands[0].stencil_reference, 0u);
+  EXPECT_FALSE(commands[0].scissor.has_value());
+  EXPECT_EQ(commands[1].stencil_reference, 1u);
+  EXPECT_EQ(commands[1].scissor, IRect::MakeLTRB(50, 50, 150, 150));
+}
+
+TEST_P(AiksTest, StencilClipNestedInScissorClip) {
+  Canvas canvas;
+  canvas.ClipRect(Rect::MakeLTRB(50, 50, 150, 150));
+  canvas.ClipOval(Rect::MakeLTRB(0, 0, 200, 200));
+  canvas.DrawRect(Rect::MakeLTRB(0, 0, 200, 200), {.color = Color::Red()});
+
+  auto spy = RenderPictureWithSpy(GetContext(), canvas.EndRecordingAsPicture());
+
+  ASSERT_EQ(spy->render_passes_.size(), 1llu);
+  const auto& commands = spy->render_passes_[0]->GetCommands();
+  ASSERT_EQ(commands.size(), 2llu);
+  // The oval is drawn within the scissor, at the depth of the stencil buffer
+  // below it.
+  EXPECT_EQ(commands[0].stencil_reference, 0u);
+  EXPECT_EQ(commands[0].scissor, IRect::MakeLTRB(50, 50, 150, 150));
+  EXPECT_EQ(commands[1].stencil_reference, 1u);
+  EXPECT_EQ(commands[1].scissor, IRect::MakeLTRB(50, 50, 150, 150));
+}
+
+TEST_P(AiksTest, RestoringScissorClipsDoesNotTouchTheStencil) {
+  Canvas canvas;
+  canvas.Save();
+  canvas.ClipRect(Rect::MakeLTRB(50, 50, 150, 150));
+  canvas.DrawRect(Rect::MakeLTRB(0, 0, 200, 200), {.color = Color::Red()});
+  canvas.Restore();
+  canvas.DrawRect(Rect::MakeLTRB(0, 0, 200, 200), {.color = Color::Blue()});
+
+  canvas.Save();
+  canvas.ClipOval(Rect::MakeLTRB(0, 0, 200, 200));
+  canvas.ClipRect(Rect::MakeLTRB(50, 50, 150, 150));
+  canvas.DrawRect(Rect::MakeLTRB(0, 0, 200, 200), {.color = Color::Red()});
+  canvas.Restore();
+  canvas.DrawRect(Rect::MakeLTRB(0, 0, 200, 200), {.color = Color::Blue()});
+
+  auto spy = RenderPictureWithSpy(GetContext(), canvas.EndRecordingAsPicture());
+
+  ASSERT_EQ(spy->render_passes_.size(), 1llu);
+  const auto& commands = spy->render_passes_[0]->GetCommands();
+  ASSERT_EQ(commands.size(), 6llu);
+  // Scissor only layer: no restore is drawn.
+  EXPECT_EQ(commands[0].stencil_reference, 0u);
+  EXPECT_EQ(commands[0].scissor, IRect::MakeLTRB(50, 50, 150, 150));
+  EXPECT_EQ(commands[1].stencil_reference, 0u);
+  EXPECT_FALSE(commands[1].scissor.has_value());
+  // Layer with a stencil clip below a scissor: the stencil is restored.
+  EXPECT_EQ(commands[2].stencil_reference, 0u);
+  EXPECT_FALSE(commands[2].scissor.has_value());
+  EXPECT_EQ(commands[3].stencil_reference, 1u);
+  EXPECT_EQ(commands[3].scissor, IRect::MakeLTRB(50, 50, 150, 150));
+  EXPECT_EQ(commands[4].stencil_reference, 0u);
+  EXPECT_FALSE(commands[4].scissor.has_value());
+  EXPECT_EQ(commands[5].stencil_reference, 0u);
+  EXPECT_FALSE(commands[5].scissor.has_value());
+}
+
+TEST_P(AiksTest, BackdropReplaysOnlyTheClipsLeftAfterRestores) {
+  if (!GetContext()->GetCapabilities()->SupportsOffscreenMSAA()) {
+    GTEST_SKIP_("Clips are only replayed into MSAA backdrops.");
+  }
+  Canvas canvas;
+  canvas.ClipOval(Rect::MakeLTRB(0, 0, 200, 200));
+  canvas.Save();
+  canvas.ClipRect(Rect::MakeLTRB(50, 50, 150, 150));
+  canvas.ClipOval(Rect::MakeLTRB(40, 40, 160, 160));
+  canvas.ClipOval(Rect::MakeLTRB(60, 60, 140, 140));
+  canvas.DrawRect(Rect::MakeLTRB(0, 0, 200, 200), {.color = Color::Red()});
+  // Undoes the scissor and both stencil clips above it.
+  canvas.Restore();
+  canvas.SaveLayer({}, std::nullopt, ImageFilter::MakeMatrix(Matrix(), {}));
+  canvas.DrawRect(Rect::MakeLTRB(0, 0, 200, 200), {.color = Color::Blue()});
+  canvas.Restore();
+
+  auto spy = RenderPictureWithSpy(GetContext(), canvas.EndRecordingAsPicture());
+
+  // The root pass is resumed last, after the backdrop has been read.
+  ASSERT_GE(spy->render_passes_.size(), 2llu);
+  const auto& commands = spy->render_passes_.back()->GetCommands();
+  ASSERT_GE(commands.size(), 2llu);
+  // Only the outer oval is replayed before the backdrop is drawn.
+  EXPECT_EQ(commands[0].stencil_reference, 0u);
+  EXPECT_FALSE(commands[0].scissor.has_value());
+  for (const auto& command : commands) {
+    EXPECT_FALSE(command.scissor.has_value());
+  }
+}
+
 TEST_P(AiksTest, ClearColorOptimizationDoesNotApplyForBackdropFilters) {
   Canvas canvas;
   canvas.SaveLayer({}, std::nullopt,
@@ -0,0 +1,276 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/compiler/compile_cache.h"
+
+#include <atomic>
+#include <cinttypes>
+#include <cstdio>
+#include <filesystem>
+#include <random>
+#include <sstream>
+#include <string_view>
+
+#include "flutter/fml/file.h"
+#include "flutter/fml/paths.h"
+#include "impeller/base/strings.h"
+
+namespace impeller {
+namespace compiler {
+
+static constexpr std::string_view kEntryMagic = "impellerc-cache";
+static constexpr uint32_t kEntryVersion = 1u;
+
+static fml::UniqueFD OpenOrCreateDirectory(const std::string& directory) {
+  auto fd = fml::OpenDirectory(directory.c_str(),
+                               false,  // create if necessary
+                               fml::FilePermission::kReadWrite);
+  if (fd.is_valid()) {
+    return fd;
+  }
+  return fml::OpenDirectory(directory.c_str(),
+                            true,  // create if necessary
+                            fml::FilePermission::kReadWrite);
+}
+
+CompileCache::CompileCache(const std::string& directory,
+                           std::string tool_fingerprint)
+    : directory_path_(directory),
+      directory_(OpenOrCreateDirectory(directory)),
+      tool_fingerprint_(std::move(tool_fingerprint)) {}
+
+CompileCache::~CompileCache() = default;
+
+bool CompileCache::IsValid() const {
+  return directory_.is_valid();
+}
+
+uint64_t CompileCache::Hash(const uint8_t* data, size_t size, uint64_t seed) {
+  // 64 bit FNV-1a, which is stable across runs and platforms.
+  uint64_t hash = 0xcbf29ce484222325u ^ seed;
+  for (size_t i = 0; i < size; i++) {
+    hash ^= data[i];
+    hash *= 0x100000001b3u;
+  }
+  return hash;
+}
+
+static uint64_t HashString(std::string_view string, uint64_t seed = 0u) {
+  return CompileCache::Hash(reinterpret_cast<const uint8_t*>(string.data()),
+                            string.size(), seed);
+}
+
+static std::optional<uint64_t> HashFile(const std::string& file_name) {
+  auto mapping = fml::FileMapping::CreateReadOnly(file_name);
+  if (!mapping) {
+    return std::nullopt;
+  }
+  return CompileCache::Hash(mapping->GetMapping(), mapping->GetSize());
+}
+
+std::string CompileCache::GetExecutableFingerprint() {
+  auto [found, path] = fml::paths::GetExecutablePath();
+  if (!found) {
+    return "";
+  }
+  auto hash = HashFile(path);
+  if (!hash.has_value()) {
+    return "";
+  }
+  return SPrintF("%016" PRIx64, hash.value());
+}
+
+std::string CompileCache::GetUniqueTempSuffix() {
+  static const uint64_t process_token = [] {
+    std::random_device device;
+    return (static_cast<uint64_t>(device()) << 32u) | device();
+  }();
+  static std::atomic<uint64_t> counter = 0u;
+  return SPrintF("%016" PRIx64 "-%" PRIu64, process_token, counter++);
+}
+
+std::string CompileCache::GetEntryName(const std::string& options_description,
+                                       const fml::Mapping& source) const {
+  auto hash = HashString(tool_fingerprint_);
+  hash = HashString(options_description, hash);
+  hash = Hash(source.GetMapping(), source.GetSize(), hash);
+  return SPrintF("%016" PRIx64 ".entry", hash);
+}
+
+namespace {
+
+/// Reads the fields of a serialized entry in order.
+class EntryReader {
+ public:
+  explicit EntryReader(const fml::Mapping& mapping)
+      : data_(reinterpret_cast<const char*>(mapping.GetMapping()),
+              mapping.GetSize()) {}
+
+  std::optional<std::string_view> ReadLine() {
+    auto end = data_.find('\n', offset_);
+    if (end == std::string_view::npos) {
+      return std::nullopt;
+    }
+    auto line = data_.substr(offset_, end - offset_);
+    offset_ = end + 1;
+    return line;
+  }
+
+  std::optional<std::string_view> ReadBytes(size_t size) {
+    if (data_.size() - offset_ < size) {
+      return std::nullopt;
+    }
+    auto bytes = data_.substr(offset_, size);
+    offset_ += size;
+    return bytes;
+  }
+
+  std::optional<size_t> ReadCount() {
+    auto line = ReadLine();
+    if (!line.has_value()) {
+      return std::nullopt;
+    }
+    size_t count = 0;
+    int consumed = 0;
+    if (std::sscanf(std::string(line.value()).c_str(), "%zu%n", &count,
+                    &consumed) != 1 ||
+        static_cast<size_t>(consumed) != line->size()) {
+      return std::nullopt;
+    }
+    return count;
+  }
+
+ private:
+  const std::string_view data_;
+  size_t offset_ = 0u;
+};
+
+}  // namespace
+
+std::optional<CompileCache::Entry> CompileCache::Lookup(
+    const std::string& options_description,
+    const fml::Mapping& source) const {
+  if (!IsValid()) {
+    return std::nullopt;
+  }
+  auto mapping = fml::FileMapping::CreateReadOnly(
+      directory_, GetEntryName(options_description, source));
+  if (!mapping || mapping->GetMapping() == nullptr) {
+    return std::nullopt;
+  }
+
+  EntryReader reader(*mapping);
+  if (reader.ReadLine() !=
+      SPrintF("%s %u", kEntryMagic.data(), kEntryVersion)) {
+    return std::nullopt;
+  }
+
+  // Guard against collisions of the entry name.
+  auto description_size = reader.ReadCount();
+  if (!description_size.has_value() ||
+      reader.ReadBytes(description_size.value()) != options_description ||
+      reader.ReadLine() != "") {
+    return std::nullopt;
+  }
+
+  Entry entry;
+  auto include_count = reader.ReadCount();
+  if (!include_count.has_value()) {
+    return std::nullopt;
+  }
+  for (size_t i = 0; i < include_count.value(); i++) {
+    // Each line is the hash of the included file followed by its name.
+    auto line = reader.ReadLine();
+    if (!line.has_value() || line->size() < 18u || line->at(16) != ' ') {
+      return std::nullopt;
+    }
+    std::string file_name(line->substr(17));
+    auto hash = HashFile(file_name);
+    if (!hash.has_value() ||
+        SPrintF("%016" PRIx64, hash.value()) != line->substr(0, 16)) {
+      // The included file changed.
+      return std::nullopt;
+    }
+    entry.included_file_names.emplace_back(std::move(file_name));
+  }
+
+  auto artifact_count = reader.ReadCount();
+  if (!artifact_count.has_value()) {
+    return std::nullopt;
+  }
+  for (size_t i = 0; i < artifact_count.value(); i++) {
+    auto name = reader.ReadLine();
+    auto size = reader.ReadCount();
+    if (!name.has_value() || name->empty() || !size.has_value()) {
+      return std::nullopt;
+    }
+    auto contents = reader.ReadBytes(size.value());
+    if (!contents.has_value()) {
+      return std::nullopt;
+    }
+    auto data = std::make_shared<std::string>(contents.value());
+    entry.artifacts[std::string(name.value())] =
+        std::make_shared<fml::NonOwnedMapping>(
+            reinterpret_cast<const uint8_t*>(data->data()), data->size(),
+            [data](auto, auto) {});
+  }
+  return entry;
+}
+
+bool CompileCache::Store(const std::string& options_description,
+                         const fml::Mapping& source,
+                         const Entry& entry) const {
+  if (!IsValid()) {
+    return false;
+  }
+
+  std::stringstream stream;
+  stream << kEntryMagic << " " << kEntryVersion << "\n";
+  stream << options_description.size() << "\n"
+         << options_description << "\n";
+
+  stream << entry.included_file_names.size() << "\n";
+  for (const auto& file_name : entry.included_file_names) {
+    auto hash = HashFile(file_name);
+    if (!hash.has_value() || file_name.find('\n') != std::string::npos) {
+      return false;
+    }
+    stream << SPrintF("%016" PRIx64, hash.value()) << " " << file_name
+           << "\n";
+  }
+
+  stream << entry.artifacts.size() << "\n";
+  for (const auto& [name, artifact] : entry.artifacts) {
+    if (!artifact || name.empty() || name.find('\n') != std::string::npos) {
+      return false;
+    }
+    stream << name << "\n" << artifact->GetSize() << "\n";
+    stream.write(reinterpret_cast<const char*>(artifact->GetMapping()),
+                 artifact->GetSize());
+  }
+
+  auto data = stream.str();
+  fml::NonOwnedMapping mapping(reinterpret_cast<const uint8_t*>(data.data()),
+                               data.size());
+
+  // Several impellerc processes (or threads of a batch) may store the same
+  // entry at once. Each writes its own temporary file and renames it over the
+  // entry, so readers only ever see a complete entry.
+  const auto entry_name = GetEntryName(options_description, source);
+  const auto temp_name = entry_name + "." + GetUniqueTempSuffix();
+  if (!fml::WriteAtomically(directory_, temp_name.c_str(), mapping)) {
+    return false;
+  }
+  std::error_code error;
+  std::filesystem::rename(directory_path_ / temp_name,
+                          directory_path_ / entry_name, error);
+  if (error) {
+    fml::UnlinkFile(directory_, temp_name.c_str());
+    return false;
+  }
+  return true;
+}
+
+}  // namespace compiler
+}  // namespace impeller
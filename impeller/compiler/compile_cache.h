@@ -0,0 +1,105 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_IMPELLER_COMPILER_COMPILE_CACHE_H_
+#define FLUTTER_IMPELLER_COMPILER_COMPILE_CACHE_H_
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "flutter/fml/mapping.h"
+#include "flutter/fml/unique_fd.h"
+
+namespace impeller {
+namespace compiler {
+
+//------------------------------------------------------------------------------
+/// @brief      A content addressed cache of compiler outputs on disk.
+///
+///             Entries are keyed by the hash of the tool fingerprint, a
+///             description of the options the shader was compiled with, and
+///             the contents of the source file. Each entry also records the
+///             files that were included along with the hash of their contents
+///             and is only used if none of them changed.
+///
+///             Entries are written atomically so that the cache may be shared
+///             by concurrent invocations.
+///
+class CompileCache {
+ public:
+  struct Entry {
+    /// The outputs of the compilation, by name.
+    std::map<std::string, std::shared_ptr<const fml::Mapping>> artifacts;
+    /// The files included by the source, relative to the working directory.
+    std::vector<std::string> included_file_names;
+  };
+
+  //----------------------------------------------------------------------------
+  /// @brief      Open or create a cache in the given directory.
+  ///
+  /// @param[in]  directory         The cache directory.
+  /// @param[in]  tool_fingerprint  Identifies the compiler producing the
+  ///                               entries. Entries made by other compilers
+  ///                               are never used.
+  ///
+  CompileCache(const std::string& directory, std::string tool_fingerprint);
+
+  ~CompileCache();
+
+  bool IsValid() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Find the outputs of an earlier compilation of the same source
+  ///             with the same options.
+  ///
+  /// @return     The entry, or std::nullopt if there is none or an included
+  ///             file has changed since.
+  ///
+  std::optional<Entry> Lookup(const std::string& options_description,
+                              const fml::Mapping& source) const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Store the outputs of a compilation. The included files are
+  ///             hashed as they are now.
+  ///
+  bool Store(const std::string& options_description,
+             const fml::Mapping& source,
+             const Entry& entry) const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      A stable hash of the given data.
+  ///
+  static uint64_t Hash(const uint8_t* data, size_t size, uint64_t seed = 0u);
+
+  //----------------------------------------------------------------------------
+  /// @brief      A fingerprint of the running executable, or an empty string
+  ///             if it could not be read.
+  ///
+  static std::string GetExecutableFingerprint();
+
+ private:
+  const std::filesystem::path directory_path_;
+  fml::UniqueFD directory_;
+  const std::string tool_fingerprint_;
+
+  std::string GetEntryName(const std::string& options_description,
+                           const fml::Mapping& source) const;
+
+  /// A suffix that no other store, in this process or another, is using.
+  static std::string GetUniqueTempSuffix();
+
+  CompileCache(const CompileCache&) = delete;
+
+  CompileCache& operator=(const CompileCache&) = delete;
+};
+
+}  // namespace compiler
+}  // namespace impeller
+
+#endif  // FLUTTER_IMPELLER_COMPILER_COMPILE_CACHE_H_
@@ -0,0 +1,133 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "flutter/fml/file.h"
+#include "flutter/fml/mapping.h"
+#include "flutter/fml/paths.h"
+#include "flutter/testing/testing.h"
+#include "impeller/compiler/compile_cache.h"
+
+namespace impeller {
+namespace compiler {
+namespace testing {
+
+static std::shared_ptr<fml::Mapping> MakeMapping(const std::string& string) {
+  auto data = std::make_shared<std::string>(string);
+  return std::make_shared<fml::NonOwnedMapping>(
+      reinterpret_cast<const uint8_t*>(data->data()), data->size(),
+      [data](auto, auto) {});
+}
+
+static std::string ToString(const std::shared_ptr<const fml::Mapping>& mapping) {
+  return std::string(reinterpret_cast<const char*>(mapping->GetMapping()),
+                     mapping->GetSize());
+}
+
+static bool WriteFile(const fml::ScopedTemporaryDirectory& directory,
+                      const std::string& name,
+                      const std::string& contents) {
+  return fml::WriteAtomically(
+      fml::OpenDirectory(directory.path().c_str(), false,
+                         fml::FilePermission::kReadWrite),
+      name.c_str(), *MakeMapping(contents));
+}
+
+TEST(CompileCacheTest, ReturnsStoredArtifacts) {
+  fml::ScopedTemporaryDirectory directory;
+  CompileCache cache(directory.path(), "fingerprint");
+  ASSERT_TRUE(cache.IsValid());
+
+  auto source = MakeMapping("void main() {}");
+  ASSERT_FALSE(cache.Lookup("options", *source).has_value());
+
+  CompileCache::Entry entry;
+  entry.artifacts["sl"] = MakeMapping("compiled");
+  entry.artifacts["empty"] = MakeMapping("");
+  ASSERT_TRUE(cache.Store("options", *source, entry));
+
+  auto found = cache.Lookup("options", *source);
+  ASSERT_TRUE(found.has_value());
+  ASSERT_EQ(found->artifacts.size(), 2u);
+  EXPECT_EQ(ToString(found->artifacts["sl"]), "compiled");
+  EXPECT_EQ(found->artifacts["empty"]->GetSize(), 0u);
+
+  // Any change of the key misses.
+  EXPECT_FALSE(cache.Lookup("other options", *source).has_value());
+  EXPECT_FALSE(
+      cache.Lookup("options", *MakeMapping("void main() { }")).has_value());
+  CompileCache other_tool_cache(directory.path(), "other fingerprint");
+  EXPECT_FALSE(other_tool_cache.Lookup("options", *source).has_value());
+}
+
+TEST(CompileCacheTest, MissesWhenAnIncludedFileChanges) {
+  fml::ScopedTemporaryDirectory directory;
+  CompileCache cache(directory.path(), "fingerprint");
+  ASSERT_TRUE(WriteFile(directory, "include.glsl", "// one"));
+
+  auto source = MakeMapping("#include \"include.glsl\"");
+  CompileCache::Entry entry;
+  entry.artifacts["sl"] = MakeMapping("compiled");
+  entry.included_file_names.push_back(
+      fml::paths::JoinPaths({directory.path(), "include.glsl"}));
+  ASSERT_TRUE(cache.Store("options", *source, entry));
+  ASSERT_TRUE(cache.Lookup("options", *source).has_value());
+
+  ASSERT_TRUE(WriteFile(directory, "include.glsl", "// two"));
+  EXPECT_FALSE(cache.Lookup("options", *source).has_value());
+}
+
+TEST(CompileCacheTest, ConcurrentStoresOfAnEntryDoNotCollide) {
+  fml::ScopedTemporaryDirectory directory;
+  auto source = MakeMapping("void main() {}");
+
+  constexpr size_t kStoreCount = 8u;
+  std::vector<std::thread> threads;
+  std::vector<char> stored(kStoreCount, false);
+  for (size_t i = 0; i < kStoreCount; i++) {
+    threads.emplace_back([&, i]() {
+      // Separate caches stand in for separate impellerc processes.
+      CompileCache cache(directory.path(), "fingerprint");
+      CompileCache::Entry entry;
+      entry.artifacts["sl"] = MakeMapping("compiled");
+      stored[i] = cache.Store("options", *source, entry);
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (size_t i = 0; i < kStoreCount; i++) {
+    EXPECT_TRUE(stored[i]) << i;
+  }
+
+  CompileCache cache(directory.path(), "fingerprint");
+  auto found = cache.Lookup("options", *source);
+  ASSERT_TRUE(found.has_value());
+  EXPECT_EQ(ToString(found->artifacts["sl"]), "compiled");
+
+  // Only the entry is left behind, no temporary files.
+  size_t file_count = 0u;
+  for (const auto& file :
+       std::filesystem::directory_iterator(directory.path())) {
+    EXPECT_EQ(file.path().extension(), ".entry");
+    file_count++;
+  }
+  EXPECT_EQ(file_count, 1u);
+}
+
+TEST(CompileCacheTest, HashIsStable) {
+  const uint8_t data[] = {'a'};
+  // The 64 bit FNV-1a hash of "a".
+  EXPECT_EQ(CompileCache::Hash(data, 1u), 0xaf63dc4c8601ec8cu);
+  EXPECT_NE(CompileCache::Hash(data, 1u, 1u), CompileCache::Hash(data, 1u));
+}
+
+}  // namespace testing
+}  // namespace compiler
+}  // namespace impeller
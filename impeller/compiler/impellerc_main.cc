@@ -3,18 +3,27 @@
 // found in the LICENSE file.
 
 #include <filesystem>
+#include <map>
+#include <optional>
+#include <sstream>
 #include <system_error>
+#include <thread>
+#include <vector>
 
 #include "flutter/fml/backtrace.h"
 #include "flutter/fml/command_line.h"
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/file.h"
 #include "flutter/fml/mapping.h"
+#include "flutter/fml/synchronization/count_down_latch.h"
+#include "impeller/compiler/compile_cache.h"
 #include "impeller/compiler/compiler.h"
 #include "impeller/compiler/shader_bundle.h"
 #include "impeller/compiler/source_options.h"
 #include "impeller/compiler/switches.h"
 #include "impeller/compiler/types.h"
 #include "impeller/compiler/utilities.h"
+#include "third_party/json/include/nlohmann/json.hpp"
 
 namespace impeller {
 namespace compiler {
@@ -24,7 +33,8 @@ namespace compiler {
 static std::shared_ptr<fml::Mapping> CompileSkSL(
     std::shared_ptr<fml::Mapping> source_file_mapping,
     SourceOptions& options,
-    Reflector::Options& reflector_options) {
+    Reflector::Options& reflector_options,
+    std::ostream& error_stream) {
   SourceOptions sksl_options = options;
   sksl_options.target_platform = TargetPlatform::kSkSL;
 
@@ -34,50 +44,96 @@ static std::shared_ptr<fml::Mapping> CompileSkSL(
   Compiler sksl_compiler = Compiler(std::move(source_file_mapping),
                                     sksl_options, sksl_reflector_options);
   if (!sksl_compiler.IsValid()) {
-    std::cerr << "Compilation to SkSL failed." << std::endl;
-    std::cerr << sksl_compiler.GetErrorMessages() << std::endl;
+    error_stream << "Compilation to SkSL failed." << std::endl;
+    error_stream << sksl_compiler.GetErrorMessages() << std::endl;
     return nullptr;
   }
   return sksl_compiler.GetSLShaderSource();
 }
 
-/// Outputs artifacts for a single compiler invocation and option configuration.
-/// If there is an error, prints error text and returns `false`.
-static bool OutputArtifacts(Compiler& compiler,
-                            Switches& switches,
-                            std::shared_ptr<fml::Mapping> source_file_mapping,
-                            SourceOptions& options,
-                            Reflector::Options& reflector_options) {
+/// Describes everything other than the source file contents that the outputs
+/// of an invocation depend on. This keys the compile cache.
+static std::string DescribeInvocation(const Switches& switches,
+                                      const SourceOptions& options) {
+  std::stringstream stream;
+  stream << "platform=" << TargetPlatformToString(options.target_platform)
+         << "\n";
+  stream << "type=" << SourceTypeToString(options.type) << "\n";
+  stream << "language=" << SourceLanguageToString(options.source_language)
+         << "\n";
+  stream << "input=" << switches.source_file_name << "\n";
+  stream << "entry-point=" << options.entry_point_name << "\n";
+  for (const auto& include_dir : options.include_dirs) {
+    stream << "include=" << include_dir.name << "\n";
+  }
+  for (const auto& define : options.defines) {
+    stream << "define=" << define << "\n";
+  }
+  stream << "iplr=" << switches.iplr << "\n";
+  stream << "json=" << options.json_format << "\n";
+  stream << "gles-language-version=" << options.gles_language_version << "\n";
+  stream << "metal-version=" << options.metal_version << "\n";
+  stream << "use-half-textures=" << options.use_half_textures << "\n";
+  stream << "require-framebuffer-fetch=" << options.require_framebuffer_fetch
+         << "\n";
+  // Output names end up in the reflection header and the depfile.
+  stream << "sl=" << switches.sl_file_name << "\n";
+  stream << "spirv=" << switches.spirv_file_name << "\n";
+  stream << "reflection-json=" << switches.reflection_json_name << "\n";
+  stream << "reflection-header=" << switches.reflection_header_name << "\n";
+  stream << "reflection-cc=" << switches.reflection_cc_name << "\n";
+  stream << "depfile=" << switches.depfile_path << "\n";
+  return stream.str();
+}
+
+/// Compiles a single shader or runtime stage IPLR and returns the contents of
+/// each output, keyed by the name of the flag naming its file.
+/// If there is an error, prints error text and returns `std::nullopt`.
+static std::optional<CompileCache::Entry> CompileArtifacts(
+    const Switches& switches,
+    std::shared_ptr<fml::Mapping> source_file_mapping,
+    SourceOptions& options,
+    Reflector::Options& reflector_options,
+    std::ostream& error_stream) {
+  Compiler compiler(source_file_mapping, options, reflector_options);
+  if (!compiler.IsValid()) {
+    error_stream << "Compilation failed." << std::endl;
+    error_stream << compiler.GetErrorMessages() << std::endl;
+    return std::nullopt;
+  }
+
+  CompileCache::Entry entry;
+  entry.included_file_names = compiler.GetIncludedFileNames();
+  entry.artifacts["spirv"] = compiler.GetSPIRVAssembly();
+
   // --------------------------------------------------------------------------
   /// 1. Invoke the compiler to generate SkSL if needed.
   ///
 
   std::shared_ptr<fml::Mapping> sksl_mapping;
   if (switches.iplr && TargetPlatformBundlesSkSL(switches.target_platform)) {
-    sksl_mapping =
-        CompileSkSL(std::move(source_file_mapping), options, reflector_options);
+    sksl_mapping = CompileSkSL(std::move(source_file_mapping), options,
+                               reflector_options, error_stream);
     if (!sksl_mapping) {
-      return false;
+      return std::nullopt;
     }
   }
 
   // --------------------------------------------------------------------------
-  /// 2. Output the source file. When in IPLR/RuntimeStage mode, output the
-  ///    serialized IPLR flatbuffer.
+  /// 2. Generate the source file. When in IPLR/RuntimeStage mode, generate
+  ///    the serialized IPLR flatbuffer.
   ///
 
-  auto sl_file_name = std::filesystem::absolute(
-      std::filesystem::current_path() / switches.sl_file_name);
   if (switches.iplr) {
     auto reflector = compiler.GetReflector();
     if (reflector == nullptr) {
-      std::cerr << "Could not create reflector." << std::endl;
-      return false;
+      error_stream << "Could not create reflector." << std::endl;
+      return std::nullopt;
     }
     auto stage_data = reflector->GetRuntimeStageData();
     if (!stage_data) {
-      std::cerr << "Runtime stage information was nil." << std::endl;
-      return false;
+      error_stream << "Runtime stage information was nil." << std::endl;
+      return std::nullopt;
     }
     if (sksl_mapping) {
       stage_data->SetSkSLData(std::move(sksl_mapping));
@@ -86,81 +142,36 @@ static bool OutputArtifacts(Compiler& compiler,
                                   ? stage_data->CreateJsonMapping()
                                   : stage_data->CreateMapping();
     if (!stage_data_mapping) {
-      std::cerr << "Runtime stage data could not be created." << std::endl;
-      return false;
-    }
-    if (!fml::WriteAtomically(*switches.working_directory,         //
-                              Utf8FromPath(sl_file_name).c_str(),  //
-                              *stage_data_mapping                  //
-                              )) {
-      std::cerr << "Could not write file to " << switches.sl_file_name
-                << std::endl;
-      return false;
-    }
-    // Tools that consume the runtime stage data expect the access mode to
-    // be 0644.
-    if (!SetPermissiveAccess(sl_file_name)) {
-      return false;
+      error_stream << "Runtime stage data could not be created." << std::endl;
+      return std::nullopt;
     }
+    entry.artifacts["sl"] = std::move(stage_data_mapping);
   } else {
-    if (!fml::WriteAtomically(*switches.working_directory,
-                              Utf8FromPath(sl_file_name).c_str(),
-                              *compiler.GetSLShaderSource())) {
-      std::cerr << "Could not write file to " << switches.sl_file_name
-                << std::endl;
-      return false;
-    }
+    entry.artifacts["sl"] = compiler.GetSLShaderSource();
   }
 
   // --------------------------------------------------------------------------
-  /// 3. Output shader reflection data.
+  /// 3. Generate shader reflection data.
   ///    May include a JSON file, a C++ header, and/or a C++ TU.
   ///
 
   if (TargetPlatformNeedsReflection(options.target_platform)) {
     if (!switches.reflection_json_name.empty()) {
-      auto reflection_json_name = std::filesystem::absolute(
-          std::filesystem::current_path() / switches.reflection_json_name);
-      if (!fml::WriteAtomically(
-              *switches.working_directory,
-              Utf8FromPath(reflection_json_name).c_str(),
-              *compiler.GetReflector()->GetReflectionJSON())) {
-        std::cerr << "Could not write reflection json to "
-                  << switches.reflection_json_name << std::endl;
-        return false;
-      }
+      entry.artifacts["reflection-json"] =
+          compiler.GetReflector()->GetReflectionJSON();
     }
-
     if (!switches.reflection_header_name.empty()) {
-      auto reflection_header_name =
-          std::filesystem::absolute(std::filesystem::current_path() /
-                                    switches.reflection_header_name.c_str());
-      if (!fml::WriteAtomically(
-              *switches.working_directory,
-              Utf8FromPath(reflection_header_name).c_str(),
-              *compiler.GetReflector()->GetReflectionHeader())) {
-        std::cerr << "Could not write reflection header to "
-                  << switches.reflection_header_name << std::endl;
-        return false;
-      }
+      entry.artifacts["reflection-header"] =
+          compiler.GetReflector()->GetReflectionHeader();
     }
-
     if (!switches.reflection_cc_name.empty()) {
-      auto reflection_cc_name =
-          std::filesystem::absolute(std::filesystem::current_path() /
-                                    switches.reflection_cc_name.c_str());
-      if (!fml::WriteAtomically(*switches.working_directory,
-                                Utf8FromPath(reflection_cc_name).c_str(),
-                                *compiler.GetReflector()->GetReflectionCC())) {
-        std::cerr << "Could not write reflection CC to "
-                  << switches.reflection_cc_name << std::endl;
-        return false;
-      }
+      entry.artifacts["reflection-cc"] =
+          compiler.GetReflector()->GetReflectionCC();
     }
   }
 
   // --------------------------------------------------------------------------
-  /// 4. Output a depfile.
+  /// 4. Generate a depfile.
   ///
 
   if (!switches.depfile_path.empty()) {
@@ -181,33 +192,62 @@ static bool OutputArtifacts(Compiler& compiler,
         result_file = switches.spirv_file_name;
         break;
     }
-    auto depfile_path = std::filesystem::absolute(
-        std::filesystem::current_path() / switches.depfile_path.c_str());
-    if (!fml::WriteAtomically(*switches.working_directory,
-                              Utf8FromPath(depfile_path).c_str(),
-                              *compiler.CreateDepfileContents({result_file}))) {
-      std::cerr << "Could not write depfile to " << switches.depfile_path
-                << std::endl;
-      return false;
-    }
+    entry.artifacts["depfile"] = compiler.CreateDepfileContents({result_file});
   }
 
-  return true;
+  for (const auto& [name, artifact] : entry.artifacts) {
+    if (!artifact) {
+      error_stream << "Could not generate " << name << " output." << std::endl;
+      return std::nullopt;
+    }
+  }
+  return entry;
 }
 
-bool Main(const fml::CommandLine& command_line) {
-  fml::InstallCrashHandler();
-  if (command_line.HasOption("help")) {
-    Switches::PrintHelp(std::cout);
-    return true;
+/// Writes the outputs of an invocation to the files named by the switches.
+/// If there is an error, prints error text and returns `false`.
+static bool WriteArtifacts(const Switches& switches,
+                           const CompileCache::Entry& entry,
+                           std::ostream& error_stream) {
+  const std::map<std::string, std::string> file_names = {
+      {"spirv", switches.spirv_file_name},
+      {"sl", switches.sl_file_name},
+      {"reflection-json", switches.reflection_json_name},
+      {"reflection-header", switches.reflection_header_name},
+      {"reflection-cc", switches.reflection_cc_name},
+      {"depfile", switches.depfile_path},
+  };
+  for (const auto& [name, artifact] : entry.artifacts) {
+    auto found = file_names.find(name);
+    if (found == file_names.end() || found->second.empty()) {
+      error_stream << "No file to write the " << name << " output to."
+                   << std::endl;
+      return false;
+    }
+    auto file_name = std::filesystem::absolute(
+        std::filesystem::current_path() / found->second);
+    if (!fml::WriteAtomically(*switches.working_directory,      //
+                              Utf8FromPath(file_name).c_str(),  //
+                              *artifact                         //
+                              )) {
+      error_stream << "Could not write " << name << " output to "
+                   << found->second << std::endl;
+      return false;
+    }
+    // Tools that consume the runtime stage data expect the access mode to
+    // be 0644.
+    if (name == "sl" && switches.iplr && !SetPermissiveAccess(file_name)) {
+      return false;
+    }
   }
+  return true;
+}
 
-  Switches switches(command_line);
-  if (!switches.AreValid(std::cerr)) {
-    std::cerr << "Invalid flags specified." << std::endl;
-    Switches::PrintHelp(std::cerr);
-    return false;
-  }
+/// Runs a single invocation of the compiler with the given flags.
+/// If there is an error, prints error text and returns `false`.
+static bool RunInvocation(Switches& switches,
+                          const CompileCache* cache,
+                          std::ostream& error_stream) {
   SourceOptions options;
   options.target_platform = switches.target_platform;
   options.source_language = switches.source_language;
@@ -238,10 +278,18 @@ bool Main(const fml::CommandLine& command_line) {
   std::shared_ptr<fml::FileMapping> source_file_mapping =
       fml::FileMapping::CreateReadOnly(switches.source_file_name);
   if (!source_file_mapping) {
-    std::cerr << "Could not open input file." << std::endl;
+    error_stream << "Could not open input file." << std::endl;
     return false;
   }
 
+  // Reuse the outputs of an earlier compilation of the same inputs.
+  const auto description = DescribeInvocation(switches, options);
+  if (cache) {
+    if (auto entry = cache->Lookup(description, *source_file_mapping)) {
+      return WriteArtifacts(switches, entry.value(), error_stream);
+    }
+  }
+
   // Invoke the compiler and generate reflection data for a single shader or
   // runtime stage IPLR.
 
@@ -253,29 +301,129 @@ bool Main(const fml::CommandLine& command_line) {
   reflector_options.header_file_name = Utf8FromPath(
       std::filesystem::path{switches.reflection_header_name}.filename());
 
-  Compiler compiler(source_file_mapping, options, reflector_options);
-  if (!compiler.IsValid()) {
-    std::cerr << "Compilation failed." << std::endl;
-    std::cerr << compiler.GetErrorMessages() << std::endl;
+  auto entry = CompileArtifacts(switches, source_file_mapping, options,
+                                reflector_options, error_stream);
+  if (!entry.has_value()) {
     return false;
   }
 
-  auto spriv_file_name = std::filesystem::absolute(
-      std::filesystem::current_path() / switches.spirv_file_name);
-  if (!fml::WriteAtomically(*switches.working_directory,
-                            Utf8FromPath(spriv_file_name).c_str(),
-                            *compiler.GetSPIRVAssembly())) {
-    std::cerr << "Could not write file to " << switches.spirv_file_name
-              << std::endl;
+  if (!WriteArtifacts(switches, entry.value(), error_stream)) {
     return false;
   }
 
-  if (!OutputArtifacts(compiler, switches, std::move(source_file_mapping),
-                       options, reflector_options)) {
+  if (cache && !cache->Store(description, *source_file_mapping, *entry)) {
+    // The outputs were written, so this doesn't fail the invocation.
+    error_stream << "Could not store " << switches.source_file_name
+                 << " in the compile cache." << std::endl;
+  }
+  return true;
+}
+
+/// Runs the invocations listed in the batch file concurrently. Each is given
+/// as an array of the flags it would be passed on the command line.
+/// If there is an error, prints error text and returns `false`.
+static bool RunBatch(const Switches& switches, const CompileCache* cache) {
+  auto batch_mapping =
+      fml::FileMapping::CreateReadOnly(switches.batch_file_name);
+  if (!batch_mapping || batch_mapping->GetMapping() == nullptr) {
+    std::cerr << "Could not open batch file." << std::endl;
+    return false;
+  }
+  auto json = nlohmann::json::parse(
+      std::string(reinterpret_cast<const char*>(batch_mapping->GetMapping()),
+                  batch_mapping->GetSize()),
+      nullptr, false);
+  if (json.is_discarded() || !json.is_array()) {
+    std::cerr << "The batch file is not a JSON array." << std::endl;
     return false;
   }
 
-  return true;
+  std::vector<fml::CommandLine> invocations;
+  for (const auto& arguments : json) {
+    if (!arguments.is_array()) {
+      std::cerr << "Batch entry " << invocations.size()
+                << " is not an array of flags." << std::endl;
+      return false;
+    }
+    std::vector<std::string> flags;
+    for (const auto& argument : arguments) {
+      if (!argument.is_string()) {
+        std::cerr << "Batch entry " << invocations.size()
+                  << " has a flag that is not a string." << std::endl;
+        return false;
+      }
+      flags.push_back(argument.get<std::string>());
+    }
+    invocations.push_back(fml::CommandLineFromIteratorsWithArgv0(
+        "impellerc", flags.begin(), flags.end()));
+  }
+
+  std::vector<std::string> errors(invocations.size());
+  std::vector<char> succeeded(invocations.size(), false);
+  {
+    auto loop = fml::ConcurrentMessageLoop::Create(
+        switches.jobs > 0u ? switches.jobs
+                           : std::thread::hardware_concurrency());
+    fml::CountDownLatch latch(invocations.size());
+    for (size_t i = 0; i < invocations.size(); i++) {
+      loop->GetTaskRunner()->PostTask([&, i]() {
+        std::stringstream error_stream;
+        Switches invocation_switches(invocations[i]);
+        if (!invocation_switches.AreValid(error_stream)) {
+          error_stream << "Invalid flags specified." << std::endl;
+        } else {
+          succeeded[i] =
+              RunInvocation(invocation_switches, cache, error_stream);
+        }
+        errors[i] = error_stream.str();
+        latch.CountDown();
+      });
+    }
+    latch.Wait();
+  }
+
+  // Report errors in the order of the batch file.
+  bool all_succeeded = true;
+  for (size_t i = 0; i < invocations.size(); i++) {
+    if (!succeeded[i]) {
+      std::cerr << "Batch entry " << i << " failed." << std::endl;
+      all_succeeded = false;
+    }
+    std::cerr << errors[i];
+  }
+  return all_succeeded;
+}
+
+bool Main(const fml::CommandLine& command_line) {
+  fml::InstallCrashHandler();
+  if (command_line.HasOption("help")) {
+    Switches::PrintHelp(std::cout);
+    return true;
+  }
+
+  Switches switches(command_line);
+  if (!switches.AreValid(std::cerr)) {
+    std::cerr << "Invalid flags specified." << std::endl;
+    Switches::PrintHelp(std::cerr);
+    return false;
+  }
+
+  std::unique_ptr<CompileCache> cache;
+  if (!switches.cache_directory.empty()) {
+    cache = std::make_unique<CompileCache>(
+        switches.cache_directory, CompileCache::GetExecutableFingerprint());
+    if (!cache->IsValid()) {
+      std::cerr << "Could not open the compile cache directory. Compiling "
+                   "without it."
+                << std::endl;
+      cache.reset();
+    }
+  }
+
+  if (!switches.batch_file_name.empty()) {
+    return RunBatch(switches, cache.get());
+  }
+  return RunInvocation(switches, cache.get(), std::cerr);
 }
 
 }  // namespace compiler
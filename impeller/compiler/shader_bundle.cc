@@ -3,6 +3,14 @@
 // found in the LICENSE file.
 
 #include "impeller/compiler/shader_bundle.h"
+
+#include <algorithm>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "flutter/fml/concurrent_message_loop.h"
+#include "flutter/fml/synchronization/count_down_latch.h"
 #include "impeller/compiler/compiler.h"
 #include "impeller/compiler/reflector.h"
 #include "impeller/compiler/source_options.h"
@@ -156,11 +164,30 @@ std::optional<fb::ShaderBundleT> GenerateShaderBundleFlatbuffer(
   /// 2. Build the deserialized shader bundle.
   ///
 
+  // The shaders are independent, so they are compiled concurrently. Each
+  // compilation overrides its own copy of the options.
+  std::vector<std::pair<std::string, ShaderConfig>> shader_configs(
+      bundle_config->begin(), bundle_config->end());
+  std::vector<std::unique_ptr<fb::ShaderT>> shaders(shader_configs.size());
+  {
+    auto loop = fml::ConcurrentMessageLoop::Create(std::max<size_t>(
+        1u, std::min<size_t>(shader_configs.size(),
+                             std::thread::hardware_concurrency())));
+    fml::CountDownLatch latch(shader_configs.size());
+    for (size_t i = 0; i < shader_configs.size(); i++) {
+      loop->GetTaskRunner()->PostTask([&, i]() {
+        SourceOptions shader_options = options;
+        shaders[i] = GenerateShaderFB(shader_options, shader_configs[i].first,
+                                      shader_configs[i].second);
+        latch.CountDown();
+      });
+    }
+    latch.Wait();
+  }
+
   fb::ShaderBundleT shader_bundle;
 
-  for (const auto& [shader_name, shader_config] : bundle_config.value()) {
-    std::unique_ptr<fb::ShaderT> shader =
-        GenerateShaderFB(options, shader_name, shader_config);
+  for (auto& shader : shaders) {
     if (!shader) {
       return std::nullopt;
     }
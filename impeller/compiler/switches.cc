@@ -78,6 +78,16 @@ void Switches::PrintHelp(std::ostream& stream) {
             "targeting metal)"
          << std::endl;
   stream << "[optional] --require-framebuffer-fetch" << std::endl;
+  stream << "[optional] --cache-dir=<cache_directory> (reuse the outputs of "
+            "earlier compilations of unchanged inputs)"
+         << std::endl;
+  stream << "--batch=<batch_file> (a JSON array of argument arrays, each "
+            "compiled as if passed to a separate invocation; replaces all "
+            "other flags except --cache-dir)"
+         << std::endl;
+  stream << "[optional] --jobs=<number> (invocations run concurrently in "
+            "batch mode, default: hardware threads)"
+         << std::endl;
 }
 
 Switches::Switches() = default;
@@ -143,7 +153,11 @@ Switches::Switches(const fml::CommandLine& command_line)
           command_line.GetOptionValueWithDefault("entry-point", "main")),
       use_half_textures(command_line.HasOption("use-half-textures")),
       require_framebuffer_fetch(
-          command_line.HasOption("require-framebuffer-fetch")) {
+          command_line.HasOption("require-framebuffer-fetch")),
+      batch_file_name(command_line.GetOptionValueWithDefault("batch", "")),
+      jobs(stoi(command_line.GetOptionValueWithDefault("jobs", "0"))),
+      cache_directory(
+          command_line.GetOptionValueWithDefault("cache-dir", "")) {
   auto language = ToLowerCase(
       command_line.GetOptionValueWithDefault("source-language", "glsl"));
 
@@ -199,6 +213,15 @@ bool Switches::AreValid(std::ostream& explain) const {
   // containing all compiled shaders and reflection state is output to `--sl`.
   const bool shader_bundle_mode = !shader_bundle.empty();
 
+  // In batch mode, the flags of each invocation are validated separately.
+  if (!batch_file_name.empty()) {
+    if (!working_directory || !working_directory->is_valid()) {
+      explain << "Could not open the working directory." << std::endl;
+      return false;
+    }
+    return true;
+  }
+
   bool valid = true;
   if (target_platform == TargetPlatform::kUnknown) {
     explain << "The target platform (only one) was not specified." << std::endl;
@@ -42,6 +42,14 @@ struct Switches {
   std::string entry_point = "";
   bool use_half_textures = false;
   bool require_framebuffer_fetch = false;
+  /// A JSON file listing the arguments of many invocations to run in
+  /// parallel.
+  std::string batch_file_name = "";
+  /// The number of invocations to run concurrently in batch mode. Zero uses
+  /// the number of hardware threads.
+  uint32_t jobs = 0;
+  /// A directory in which compiler outputs are cached across invocations.
+  std::string cache_directory = "";
 
   Switches();
 
@@ -0,0 +1,192 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/core/buffer_sub_allocator.h"
+
+#include <optional>
+
+#include "flutter/fml/logging.h"
+#include "impeller/base/validation.h"
+
+namespace impeller {
+
+double BufferSubAllocator::Stats::GetUtilization() const {
+  if (reserved_bytes == 0u) {
+    return 0.0;
+  }
+  return static_cast<double>(allocated_bytes) / reserved_bytes;
+}
+
+double BufferSubAllocator::Stats::GetFragmentation() const {
+  if (consumed_bytes == 0u) {
+    return 0.0;
+  }
+  return static_cast<double>(consumed_bytes - allocated_bytes) /
+         consumed_bytes;
+}
+
+BufferSubAllocator::Allocation::Allocation(
+    std::weak_ptr<BufferSubAllocator> sub_allocator,
+    std::shared_ptr<DeviceBuffer> block,
+    size_t block_index,
+    size_t offset,
+    size_t length)
+    : sub_allocator_(std::move(sub_allocator)),
+      block_(std::move(block)),
+      block_index_(block_index),
+      offset_(offset),
+      length_(length) {}
+
+BufferSubAllocator::Allocation::~Allocation() {
+  if (auto sub_allocator = sub_allocator_.lock()) {
+    sub_allocator->Release(block_index_, length_);
+  }
+}
+
+const std::shared_ptr<DeviceBuffer>& BufferSubAllocator::Allocation::GetBlock()
+    const {
+  return block_;
+}
+
+size_t BufferSubAllocator::Allocation::GetOffset() const {
+  return offset_;
+}
+
+std::shared_ptr<BufferSubAllocator> BufferSubAllocator::Create(
+    BlockFactory block_factory,
+    size_t block_size,
+    uint32_t free_block_keep_alive_frame_count) {
+  if (!block_factory || block_size == 0u) {
+    return nullptr;
+  }
+  return std::shared_ptr<BufferSubAllocator>(new BufferSubAllocator(
+      std::move(block_factory), block_size, free_block_keep_alive_frame_count));
+}
+
+BufferSubAllocator::BufferSubAllocator(
+    BlockFactory block_factory,
+    size_t block_size,
+    uint32_t free_block_keep_alive_frame_count)
+    : block_factory_(std::move(block_factory)),
+      block_size_(block_size),
+      free_block_keep_alive_frame_count_(free_block_keep_alive_frame_count) {}
+
+BufferSubAllocator::~BufferSubAllocator() = default;
+
+static size_t AlignUp(size_t offset, size_t alignment) {
+  if (alignment <= 1u) {
+    return offset;
+  }
+  return ((offset + alignment - 1u) / alignment) * alignment;
+}
+
+std::unique_ptr<BufferSubAllocator::Allocation> BufferSubAllocator::Allocate(
+    size_t length,
+    size_t alignment) {
+  if (length == 0u || length > block_size_) {
+    return nullptr;
+  }
+
+  Lock lock(mutex_);
+
+  auto fits = [&](const Block& block) {
+    return block.buffer &&
+           AlignUp(block.offset, alignment) + length <= block_size_;
+  };
+
+  // Prefer the current block, then any block that has been recycled, and
+  // only then create a new block.
+  std::optional<size_t> index;
+  if (current_block_ < blocks_.size() && fits(blocks_[current_block_])) {
+    index = current_block_;
+  }
+  if (!index.has_value()) {
+    for (size_t i = 0; i < blocks_.size(); i++) {
+      if (blocks_[i].buffer && blocks_[i].allocation_count == 0u) {
+        index = i;
+        break;
+      }
+    }
+  }
+  if (!index.has_value()) {
+    auto buffer = block_factory_(block_size_);
+    if (!buffer) {
+      VALIDATION_LOG << "Could not create a block for buffer sub-allocation.";
+      return nullptr;
+    }
+    Block block;
+    block.buffer = std::move(buffer);
+    for (size_t i = 0; i < blocks_.size(); i++) {
+      if (!blocks_[i].buffer) {
+        blocks_[i] = std::move(block);
+        index = i;
+        break;
+      }
+    }
+    if (!index.has_value()) {
+      index = blocks_.size();
+      blocks_.emplace_back(std::move(block));
+    }
+  }
+
+  current_block_ = index.value();
+  auto& block = blocks_[current_block_];
+  const auto offset = AlignUp(block.offset, alignment);
+  block.offset = offset + length;
+  block.allocation_count++;
+  block.allocated_bytes += length;
+  block.free_frame_count = 0u;
+
+  return std::unique_ptr<Allocation>(new Allocation(
+      weak_from_this(), block.buffer, current_block_, offset, length));
+}
+
+void BufferSubAllocator::Release(size_t block_index, size_t length) {
+  Lock lock(mutex_);
+  FML_DCHECK(block_index < blocks_.size());
+  auto& block = blocks_[block_index];
+  FML_DCHECK(block.allocation_count > 0u);
+  FML_DCHECK(block.allocated_bytes >= length);
+  block.allocation_count--;
+  block.allocated_bytes -= length;
+  if (block.allocation_count == 0u) {
+    // Nothing refers to the block anymore. It can be allocated from again.
+    block.offset = 0u;
+    block.free_frame_count = 0u;
+  }
+}
+
+void BufferSubAllocator::DidAcquireFrame() {
+  Lock lock(mutex_);
+  for (auto& block : blocks_) {
+    if (!block.buffer || block.allocation_count > 0u) {
+      continue;
+    }
+    if (++block.free_frame_count > free_block_keep_alive_frame_count_) {
+      block = Block{};
+    }
+  }
+}
+
+size_t BufferSubAllocator::GetBlockSize() const {
+  return block_size_;
+}
+
+BufferSubAllocator::Stats BufferSubAllocator::GetStats() const {
+  Lock lock(mutex_);
+  Stats stats;
+  for (const auto& block : blocks_) {
+    if (!block.buffer) {
+      continue;
+    }
+    stats.block_count++;
+    stats.reserved_bytes += block_size_;
+    stats.consumed_bytes += block.offset;
+    stats.allocated_bytes += block.allocated_bytes;
+    stats.allocation_count += block.allocation_count;
+  }
+  return stats;
+}
+
+}  // namespace impeller
@@ -0,0 +1,145 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_IMPELLER_CORE_BUFFER_SUB_ALLOCATOR_H_
+#define FLUTTER_IMPELLER_CORE_BUFFER_SUB_ALLOCATOR_H_
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "impeller/base/thread.h"
+#include "impeller/core/device_buffer.h"
+
+namespace impeller {
+
+//------------------------------------------------------------------------------
+/// @brief      Carves small buffers out of large device buffer blocks.
+///
+///             Each block is allocated from linearly. A block is recycled as a
+///             whole once every allocation made from it has been released, so
+///             its memory is only reused when nothing refers to it anymore.
+///             Blocks that have been free for more than a given number of
+///             frames are released back to the backend.
+///
+///             The allocator is backend agnostic. Backends create the blocks
+///             and wrap the returned allocations in their own device buffers,
+///             offsetting their use of the block as needed.
+///
+class BufferSubAllocator
+    : public std::enable_shared_from_this<BufferSubAllocator> {
+ public:
+  using BlockFactory =
+      std::function<std::shared_ptr<DeviceBuffer>(size_t block_size)>;
+
+  struct Stats {
+    /// The number of blocks currently held.
+    size_t block_count = 0u;
+    /// The combined size of all blocks.
+    size_t reserved_bytes = 0u;
+    /// The bytes of all blocks consumed by allocations, including alignment
+    /// padding and allocations that were released but whose block is still
+    /// in use.
+    size_t consumed_bytes = 0u;
+    /// The bytes of all live allocations.
+    size_t allocated_bytes = 0u;
+    /// The number of live allocations.
+    size_t allocation_count = 0u;
+
+    /// The fraction of the reserved memory that is allocated.
+    double GetUtilization() const;
+
+    /// The fraction of the consumed memory that is not allocated and can't
+    /// be reused until its block is recycled.
+    double GetFragmentation() const;
+  };
+
+  class Allocation {
+   public:
+    ~Allocation();
+
+    const std::shared_ptr<DeviceBuffer>& GetBlock() const;
+
+    size_t GetOffset() const;
+
+   private:
+    friend class BufferSubAllocator;
+
+    std::weak_ptr<BufferSubAllocator> sub_allocator_;
+    std::shared_ptr<DeviceBuffer> block_;
+    size_t block_index_;
+    size_t offset_;
+    size_t length_;
+
+    Allocation(std::weak_ptr<BufferSubAllocator> sub_allocator,
+               std::shared_ptr<DeviceBuffer> block,
+               size_t block_index,
+               size_t offset,
+               size_t length);
+
+    Allocation(const Allocation&) = delete;
+
+    Allocation& operator=(const Allocation&) = delete;
+  };
+
+  static std::shared_ptr<BufferSubAllocator> Create(
+      BlockFactory block_factory,
+      size_t block_size,
+      uint32_t free_block_keep_alive_frame_count);
+
+  ~BufferSubAllocator();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Allocate a range of a block.
+  ///
+  /// @return     The allocation, which is released when destroyed. `nullptr`
+  ///             if the length exceeds the block size or a block could not be
+  ///             created.
+  ///
+  std::unique_ptr<Allocation> Allocate(size_t length, size_t alignment);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Release blocks that have been free for too many frames.
+  ///
+  void DidAcquireFrame();
+
+  size_t GetBlockSize() const;
+
+  Stats GetStats() const;
+
+ private:
+  struct Block {
+    std::shared_ptr<DeviceBuffer> buffer;
+    size_t offset = 0u;
+    size_t allocation_count = 0u;
+    size_t allocated_bytes = 0u;
+    // The number of frames acquired since the block was last freed.
+    uint32_t free_frame_count = 0u;
+  };
+
+  const BlockFactory block_factory_;
+  const size_t block_size_;
+  const uint32_t free_block_keep_alive_frame_count_;
+  mutable Mutex mutex_;
+  // Released blocks leave an empty slot so that the indices of allocations
+  // remain valid.
+  std::vector<Block> blocks_ IPLR_GUARDED_BY(mutex_);
+  // The block allocations are currently made from.
+  size_t current_block_ IPLR_GUARDED_BY(mutex_) = 0u;
+
+  BufferSubAllocator(BlockFactory block_factory,
+                     size_t block_size,
+                     uint32_t free_block_keep_alive_frame_count);
+
+  void Release(size_t block_index, size_t length);
+
+  BufferSubAllocator(const BufferSubAllocator&) = delete;
+
+  BufferSubAllocator& operator=(const BufferSubAllocator&) = delete;
+};
+
+}  // namespace impeller
+
+#endif  // FLUTTER_IMPELLER_CORE_BUFFER_SUB_ALLOCATOR_H_
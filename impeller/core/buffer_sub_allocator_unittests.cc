@@ -0,0 +1,117 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+#include "flutter/testing/testing.h"
+#include "impeller/core/buffer_sub_allocator.h"
+#include "impeller/renderer/testing/mocks.h"
+
+namespace impeller {
+namespace testing {
+
+static std::shared_ptr<BufferSubAllocator> CreateSubAllocator(
+    size_t* blocks_created,
+    uint32_t keep_alive_frame_count = 0u) {
+  return BufferSubAllocator::Create(
+      [blocks_created](size_t block_size) {
+        (*blocks_created)++;
+        return std::make_shared<MockDeviceBuffer>(
+            DeviceBufferDescriptor{.size = block_size});
+      },
+      /*block_size=*/1024u, keep_alive_frame_count);
+}
+
+TEST(BufferSubAllocatorTest, AllocatesAlignedRangesFromOneBlock) {
+  size_t blocks_created = 0u;
+  auto sub_allocator = CreateSubAllocator(&blocks_created);
+  ASSERT_NE(sub_allocator, nullptr);
+
+  auto a = sub_allocator->Allocate(100u, 256u);
+  auto b = sub_allocator->Allocate(100u, 256u);
+  ASSERT_NE(a, nullptr);
+  ASSERT_NE(b, nullptr);
+  EXPECT_EQ(a->GetBlock(), b->GetBlock());
+  EXPECT_EQ(a->GetOffset(), 0u);
+  EXPECT_EQ(b->GetOffset(), 256u);
+  EXPECT_EQ(blocks_created, 1u);
+
+  auto stats = sub_allocator->GetStats();
+  EXPECT_EQ(stats.block_count, 1u);
+  EXPECT_EQ(stats.reserved_bytes, 1024u);
+  EXPECT_EQ(stats.consumed_bytes, 356u);
+  EXPECT_EQ(stats.allocated_bytes, 200u);
+  EXPECT_EQ(stats.allocation_count, 2u);
+
+  // Too large for a block.
+  EXPECT_EQ(sub_allocator->Allocate(1025u, 1u), nullptr);
+}
+
+TEST(BufferSubAllocatorTest, RecyclesBlocksOnceEmpty) {
+  size_t blocks_created = 0u;
+  auto sub_allocator = CreateSubAllocator(&blocks_created);
+
+  auto a = sub_allocator->Allocate(600u, 1u);
+  auto b = sub_allocator->Allocate(600u, 1u);
+  ASSERT_NE(a, nullptr);
+  ASSERT_NE(b, nullptr);
+  EXPECT_NE(a->GetBlock(), b->GetBlock());
+  EXPECT_EQ(blocks_created, 2u);
+
+  auto first_block = a->GetBlock();
+  a.reset();
+  auto c = sub_allocator->Allocate(600u, 1u);
+  ASSERT_NE(c, nullptr);
+  EXPECT_EQ(c->GetBlock(), first_block);
+  EXPECT_EQ(c->GetOffset(), 0u);
+  EXPECT_EQ(blocks_created, 2u);
+}
+
+TEST(BufferSubAllocatorTest, ReportsFragmentationOfPartiallyFreedBlocks) {
+  size_t blocks_created = 0u;
+  auto sub_allocator = CreateSubAllocator(&blocks_created);
+
+  auto a = sub_allocator->Allocate(256u, 1u);
+  auto b = sub_allocator->Allocate(256u, 1u);
+  a.reset();
+
+  auto stats = sub_allocator->GetStats();
+  EXPECT_EQ(stats.consumed_bytes, 512u);
+  EXPECT_EQ(stats.allocated_bytes, 256u);
+  EXPECT_DOUBLE_EQ(stats.GetFragmentation(), 0.5);
+  EXPECT_DOUBLE_EQ(stats.GetUtilization(), 0.25);
+}
+
+TEST(BufferSubAllocatorTest, TrimsBlocksFreeForTooManyFrames) {
+  size_t blocks_created = 0u;
+  auto sub_allocator =
+      CreateSubAllocator(&blocks_created, /*keep_alive_frame_count=*/1u);
+
+  auto a = sub_allocator->Allocate(16u, 1u);
+  sub_allocator->DidAcquireFrame();
+  sub_allocator->DidAcquireFrame();
+  // Blocks in use are never trimmed.
+  EXPECT_EQ(sub_allocator->GetStats().block_count, 1u);
+
+  a.reset();
+  sub_allocator->DidAcquireFrame();
+  EXPECT_EQ(sub_allocator->GetStats().block_count, 1u);
+  sub_allocator->DidAcquireFrame();
+  EXPECT_EQ(sub_allocator->GetStats().block_count, 0u);
+
+  auto b = sub_allocator->Allocate(16u, 1u);
+  ASSERT_NE(b, nullptr);
+  EXPECT_EQ(blocks_created, 2u);
+}
+
+TEST(BufferSubAllocatorTest, AllocationsMayOutliveTheSubAllocator) {
+  size_t blocks_created = 0u;
+  auto sub_allocator = CreateSubAllocator(&blocks_created);
+  auto a = sub_allocator->Allocate(16u, 1u);
+  sub_allocator.reset();
+  ASSERT_NE(a->GetBlock(), nullptr);
+  a.reset();
+}
+
+}  // namespace testing
+}  // namespace impeller
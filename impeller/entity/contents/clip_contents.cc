@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <cmath>
 #include <optional>
 
 #include "fml/logging.h"
@@ -62,6 +63,24 @@ Contents::ClipCoverage ClipContents::GetClipCoverage(
   FML_UNREACHABLE();
 }
 
+bool ClipContents::CanApplyAsScissor(const Entity& entity) const {
+  if (clip_op_ != Entity::ClipOperation::kIntersect || !geometry_ ||
+      !geometry_->IsAxisAlignedRect() ||
+      !entity.GetTransform().IsTranslationScaleOnly()) {
+    return false;
+  }
+  auto coverage = geometry_->GetCoverage(entity.GetTransform());
+  if (!coverage.has_value()) {
+    return false;
+  }
+  auto is_integral = [](Scalar value) {
+    return ScalarNearlyEqual(value, std::round(value));
+  };
+  return is_integral(coverage->GetLeft()) && is_integral(coverage->GetTop()) &&
+         is_integral(coverage->GetRight()) &&
+         is_integral(coverage->GetBottom());
+}
+
 bool ClipContents::ShouldRender(const Entity& entity,
                                 const std::optional<Rect> clip_coverage) const {
   return true;
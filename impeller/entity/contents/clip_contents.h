@@ -26,6 +26,15 @@ class ClipContents final : public Contents {
 
   void SetClipOperation(Entity::ClipOperation clip_op);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Whether this clip is an intersection with a rectangle that is
+  ///             aligned to the pixel grid once transformed.
+  ///
+  ///             Such clips are equivalent to a scissor over their coverage
+  ///             and don't need to touch the stencil buffer.
+  ///
+  bool CanApplyAsScissor(const Entity& entity) const;
+
   // |Contents|
   std::optional<Rect> GetCoverage(const Entity& entity) const override;
 
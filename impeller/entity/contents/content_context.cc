@@ -5,11 +5,15 @@
 #include "impeller/entity/contents/content_context.h"
 
 #include <memory>
+#include <unordered_map>
 
 #include "impeller/base/strings.h"
 #include "impeller/core/formats.h"
 #include "impeller/entity/contents/framebuffer_blend_contents.h"
+#include "impeller/entity/contents/gradient_texture_cache.h"
+#include "impeller/entity/contents/pipeline_variant_manifest.h"
 #include "impeller/entity/entity.h"
+#include "impeller/entity/geometry/path_vertex_cache.h"
 #include "impeller/entity/render_target_cache.h"
 #include "impeller/renderer/command_buffer.h"
 #include "impeller/renderer/pipeline_descriptor.h"
@@ -145,7 +149,14 @@ void ContentContextOptions::ApplyToPipelineDescriptor(
     StencilAttachmentDescriptor stencil = maybe_stencil.value();
     stencil.stencil_compare = stencil_compare;
     stencil.depth_stencil_pass = stencil_operation;
-    desc.SetStencilAttachmentDescriptors(stencil);
+    if (is_for_nonzero_stencil_fill) {
+      StencilAttachmentDescriptor back_stencil = stencil;
+      stencil.depth_stencil_pass = StencilOperation::kIncrementWrap;
+      back_stencil.depth_stencil_pass = StencilOperation::kDecrementWrap;
+      desc.SetStencilAttachmentDescriptors(stencil, back_stencil);
+    } else {
+      desc.SetStencilAttachmentDescriptors(stencil);
+    }
   }
 
   desc.SetPrimitiveType(primitive_type);
@@ -153,6 +164,11 @@ void ContentContextOptions::ApplyToPipelineDescriptor(
   desc.SetPolygonMode(wireframe ? PolygonMode::kLine : PolygonMode::kFill);
 }
 
+// Offscreen textures of passes that are skipped for a frame or two (or that
+// alternate between sizes) are kept around instead of being reallocated.
+static constexpr uint32_t kRenderTargetKeepAliveFrameCount = 2u;
+static constexpr size_t kRenderTargetCacheMaxBytes = 64u * 1024u * 1024u;
+
 template <typename PipelineT>
 static std::unique_ptr<PipelineT> CreateDefaultPipeline(
     const Context& context) {
@@ -178,12 +194,16 @@ ContentContext::ContentContext(
       lazy_glyph_atlas_(
           std::make_shared<LazyGlyphAtlas>(std::move(typographer_context))),
       tessellator_(std::make_shared<Tessellator>()),
+      gradient_texture_cache_(std::make_shared<GradientTextureCache>()),
+      path_vertex_cache_(std::make_shared<PathVertexCache>()),
 #if IMPELLER_ENABLE_3D
       scene_context_(std::make_shared<scene::SceneContext>(context_)),
 #endif  // IMPELLER_ENABLE_3D
       render_target_cache_(render_target_allocator == nullptr
                                ? std::make_shared<RenderTargetCache>(
-                                     context_->GetResourceAllocator())
+                                     context_->GetResourceAllocator(),
+                                     kRenderTargetKeepAliveFrameCount,
+                                     kRenderTargetCacheMaxBytes)
                                : std::move(render_target_allocator)) {
   if (!context_ || !context_->IsValid()) {
     return;
@@ -396,6 +416,8 @@ ContentContext::ContentContext(
   clip_pipelines_.SetDefault(options, std::make_unique<ClipPipeline>(
                                           *context_, clip_pipeline_descriptor));
 
+  PrewarmRecordedPipelineVariants();
+
   is_valid_ = true;
 }
 
@@ -466,6 +488,150 @@ std::shared_ptr<Tessellator> ContentContext::GetTessellator() const {
   return tessellator_;
 }
 
+std::shared_ptr<GradientTextureCache> ContentContext::GetGradientTextureCache()
+    const {
+  return gradient_texture_cache_;
+}
+
+std::shared_ptr<PathVertexCache> ContentContext::GetPathVertexCache() const {
+  return path_vertex_cache_;
+}
+
+std::shared_ptr<PipelineVariantManifest>
+ContentContext::GetPipelineVariantManifest() const {
+  return pipeline_variant_manifest_;
+}
+
+bool ContentContext::HasPipelineVariant(
+    const std::string& manifest_key,
+    const ContentContextOptions& options) const {
+  for (const auto& [key, variants] : GetAllPipelineVariants()) {
+    if (key == manifest_key) {
+      return variants->HasVariant(options);
+    }
+  }
+  return false;
+}
+
+void ContentContext::RecordPipelineVariant(
+    const VariantsBase& container,
+    const ContentContextOptions& opts) const {
+  if (pipeline_variant_manifest_ && !container.GetManifestKey().empty()) {
+    pipeline_variant_manifest_->Record(container.GetManifestKey(), opts);
+  }
+}
+
+std::vector<std::pair<std::string, ContentContext::VariantsBase*>>
+ContentContext::GetAllPipelineVariants() const {
+// Containers are named after their members. Several of them hold pipelines
+// built from the same shaders, so the pipelines themselves can't be used to
+// tell them apart.
+#define IPLR_PIPELINE_VARIANTS(member) \
+  { #member, &member }
+  return {
+#ifdef IMPELLER_DEBUG
+      IPLR_PIPELINE_VARIANTS(checkerboard_pipelines_),
+#endif  // IMPELLER_DEBUG
+      IPLR_PIPELINE_VARIANTS(solid_fill_pipelines_),
+      IPLR_PIPELINE_VARIANTS(linear_gradient_fill_pipelines_),
+      IPLR_PIPELINE_VARIANTS(radial_gradient_fill_pipelines_),
+      IPLR_PIPELINE_VARIANTS(conical_gradient_fill_pipelines_),
+      IPLR_PIPELINE_VARIANTS(sweep_gradient_fill_pipelines_),
+      IPLR_PIPELINE_VARIANTS(linear_gradient_ssbo_fill_pipelines_),
+      IPLR_PIPELINE_VARIANTS(radial_gradient_ssbo_fill_pipelines_),
+      IPLR_PIPELINE_VARIANTS(conical_gradient_ssbo_fill_pipelines_),
+      IPLR_PIPELINE_VARIANTS(sweep_gradient_ssbo_fill_pipelines_),
+      IPLR_PIPELINE_VARIANTS(rrect_blur_pipelines_),
+      IPLR_PIPELINE_VARIANTS(texture_blend_pipelines_),
+      IPLR_PIPELINE_VARIANTS(texture_pipelines_),
+#ifdef IMPELLER_ENABLE_OPENGLES
+      IPLR_PIPELINE_VARIANTS(texture_external_pipelines_),
+      IPLR_PIPELINE_VARIANTS(tiled_texture_external_pipelines_),
+#endif  // IMPELLER_ENABLE_OPENGLES
+      IPLR_PIPELINE_VARIANTS(position_uv_pipelines_),
+      IPLR_PIPELINE_VARIANTS(tiled_texture_pipelines_),
+      IPLR_PIPELINE_VARIANTS(gaussian_blur_noalpha_decal_pipelines_),
+      IPLR_PIPELINE_VARIANTS(gaussian_blur_noalpha_nodecal_pipelines_),
+      IPLR_PIPELINE_VARIANTS(border_mask_blur_pipelines_),
+      IPLR_PIPELINE_VARIANTS(morphology_filter_pipelines_),
+      IPLR_PIPELINE_VARIANTS(color_matrix_color_filter_pipelines_),
+      IPLR_PIPELINE_VARIANTS(linear_to_srgb_filter_pipelines_),
+      IPLR_PIPELINE_VARIANTS(srgb_to_linear_filter_pipelines_),
+      IPLR_PIPELINE_VARIANTS(clip_pipelines_),
+      IPLR_PIPELINE_VARIANTS(glyph_atlas_pipelines_),
+      IPLR_PIPELINE_VARIANTS(glyph_atlas_color_pipelines_),
+      IPLR_PIPELINE_VARIANTS(geometry_color_pipelines_),
+      IPLR_PIPELINE_VARIANTS(yuv_to_rgb_filter_pipelines_),
+      IPLR_PIPELINE_VARIANTS(porter_duff_blend_pipelines_),
+      IPLR_PIPELINE_VARIANTS(blend_color_pipelines_),
+      IPLR_PIPELINE_VARIANTS(blend_colorburn_pipelines_),
+      IPLR_PIPELINE_VARIANTS(blend_colordodge_pipelines_),
+      IPLR_PIPELINE_VARIANTS(blend_darken_pipelines_),
+      IPLR_PIPELINE_VARIANTS(blend_difference_pipelines_),
+      IPLR_PIPELINE_VARIANTS(blend_exclusion_pipelines_),
+      IPLR_PIPELINE_VARIANTS(blend_hardlight_pipelines_),
+      IPLR_PIPELINE_VARIANTS(blend_hue_pipelines_),
+      IPLR_PIPELINE_VARIANTS(blend_lighten_pipelines_),
+      IPLR_PIPELINE_VARIANTS(blend_luminosity_pipelines_),
+      IPLR_PIPELINE_VARIANTS(blend_multiply_pipelines_),
+      IPLR_PIPELINE_VARIANTS(blend_overlay_pipelines_),
+      IPLR_PIPELINE_VARIANTS(blend_saturation_pipelines_),
+      IPLR_PIPELINE_VARIANTS(blend_screen_pipelines_),
+      IPLR_PIPELINE_VARIANTS(blend_softlight_pipelines_),
+      IPLR_PIPELINE_VARIANTS(framebuffer_blend_color_pipelines_),
+      IPLR_PIPELINE_VARIANTS(framebuffer_blend_colorburn_pipelines_),
+      IPLR_PIPELINE_VARIANTS(framebuffer_blend_colordodge_pipelines_),
+      IPLR_PIPELINE_VARIANTS(framebuffer_blend_darken_pipelines_),
+      IPLR_PIPELINE_VARIANTS(framebuffer_blend_difference_pipelines_),
+      IPLR_PIPELINE_VARIANTS(framebuffer_blend_exclusion_pipelines_),
+      IPLR_PIPELINE_VARIANTS(framebuffer_blend_hardlight_pipelines_),
+      IPLR_PIPELINE_VARIANTS(framebuffer_blend_hue_pipelines_),
+      IPLR_PIPELINE_VARIANTS(framebuffer_blend_lighten_pipelines_),
+      IPLR_PIPELINE_VARIANTS(framebuffer_blend_luminosity_pipelines_),
+      IPLR_PIPELINE_VARIANTS(framebuffer_blend_multiply_pipelines_),
+      IPLR_PIPELINE_VARIANTS(framebuffer_blend_overlay_pipelines_),
+      IPLR_PIPELINE_VARIANTS(framebuffer_blend_saturation_pipelines_),
+      IPLR_PIPELINE_VARIANTS(framebuffer_blend_screen_pipelines_),
+      IPLR_PIPELINE_VARIANTS(framebuffer_blend_softlight_pipelines_),
+  };
+#undef IPLR_PIPELINE_VARIANTS
+}
+
+void ContentContext::PrewarmRecordedPipelineVariants() {
+  auto library = context_->GetPipelineLibrary();
+  pipeline_variant_manifest_ = std::make_shared<PipelineVariantManifest>();
+
+  auto recorded =
+      PipelineVariantManifest::Parse(library->LoadVariantManifest().get());
+  std::unordered_map<std::string, VariantsBase*> variants_by_key;
+  for (const auto& [key, variants] : GetAllPipelineVariants()) {
+    variants->SetManifestKey(key);
+    variants_by_key.emplace(key, variants);
+  }
+
+  if (recorded) {
+    // The pipelines are compiled asynchronously by the pipeline library. The
+    // variants only block the frame if they are used before they are ready.
+    // Variants of prototypes that no longer exist are dropped.
+    recorded->ForEachVariant([&](const std::string& key,
+                                 const ContentContextOptions& options) {
+      auto found = variants_by_key.find(key);
+      if (found == variants_by_key.end()) {
+        return;
+      }
+      found->second->PrewarmVariant(*context_, options);
+      pipeline_variant_manifest_->Record(key, options);
+    });
+  }
+
+  library->SetVariantManifestProvider(
+      [weak_manifest = std::weak_ptr<PipelineVariantManifest>(
+           pipeline_variant_manifest_)]() -> std::shared_ptr<fml::Mapping> {
+        auto manifest = weak_manifest.lock();
+        return manifest ? manifest->Serialize() : nullptr;
+      });
+}
+
 std::shared_ptr<Context> ContentContext::GetContext() const {
   return context_;
 }
@@ -478,4 +644,20 @@ void ContentContext::SetWireframe(bool wireframe) {
   wireframe_ = wireframe;
 }
 
+void ContentContext::SetPathFillMode(PathFillMode mode) {
+  path_fill_mode_ = mode;
+}
+
+PathFillMode ContentContext::GetPathFillMode() const {
+  return path_fill_mode_;
+}
+
+void ContentContext::SetAsyncRuntimeEffectCompilation(bool async) {
+  async_runtime_effect_compilation_ = async;
+}
+
+bool ContentContext::IsAsyncRuntimeEffectCompilationEnabled() const {
+  return async_runtime_effect_compilation_;
+}
+
 }  // namespace impeller
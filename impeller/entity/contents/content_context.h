@@ -8,7 +8,9 @@
 #include <initializer_list>
 #include <memory>
 #include <optional>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "flutter/fml/build_config.h"
 #include "flutter/fml/logging.h"
@@ -18,6 +20,7 @@
 #include "impeller/renderer/capabilities.h"
 #include "impeller/renderer/pipeline.h"
 #include "impeller/renderer/pipeline_descriptor.h"
+#include "impeller/renderer/pipeline_library.h"
 #include "impeller/renderer/render_target.h"
 #include "impeller/typographer/typographer_context.h"
 
@@ -276,6 +279,10 @@ struct ContentContextOptions {
   bool has_stencil_attachment = true;
   bool wireframe = false;
   bool is_for_rrect_blur_clear = false;
+  /// Increment the stencil for front facing triangles and decrement it for
+  /// back facing ones instead of applying `stencil_operation`, to count the
+  /// winding of stencil-then-cover fills.
+  bool is_for_nonzero_stencil_fill = false;
 
   struct Hash {
     constexpr uint64_t operator()(const ContentContextOptions& o) const {
@@ -290,6 +297,7 @@ struct ContentContextOptions {
       return (o.is_for_rrect_blur_clear ? 1llu : 0llu) << 0 |
              (o.wireframe ? 1llu : 0llu) << 1 |
              (o.has_stencil_attachment ? 1llu : 0llu) << 2 |
+             (o.is_for_nonzero_stencil_fill ? 1llu : 0llu) << 3 |
              // enums
              static_cast<uint64_t>(o.color_attachment_pixel_format) << 16 |
              static_cast<uint64_t>(o.primitive_type) << 24 |
@@ -312,15 +320,31 @@ struct ContentContextOptions {
                  rhs.color_attachment_pixel_format &&
              lhs.has_stencil_attachment == rhs.has_stencil_attachment &&
              lhs.wireframe == rhs.wireframe &&
-             lhs.is_for_rrect_blur_clear == rhs.is_for_rrect_blur_clear;
+             lhs.is_for_rrect_blur_clear == rhs.is_for_rrect_blur_clear &&
+             lhs.is_for_nonzero_stencil_fill ==
+                 rhs.is_for_nonzero_stencil_fill;
     }
   };
 
   void ApplyToPipelineDescriptor(PipelineDescriptor& desc) const;
 };
 
+/// How filled paths are turned into pixels.
+enum class PathFillMode {
+  /// Tessellate paths into triangles on the CPU.
+  kTessellate,
+  /// Where possible, count the coverage of a triangle fan of the path outline
+  /// in the stencil buffer and then cover the path bounds where the stencil
+  /// was touched. This trades CPU tessellation for GPU fill rate, which pays
+  /// off for complex paths that change every frame.
+  kStencilThenCover,
+};
+
 class Tessellator;
 class RenderTargetCache;
+class GradientTextureCache;
+class PathVertexCache;
+class PipelineVariantManifest;
 
 class ContentContext {
  public:
@@ -339,6 +363,21 @@ class ContentContext {
 
   std::shared_ptr<Tessellator> GetTessellator() const;
 
+  std::shared_ptr<GradientTextureCache> GetGradientTextureCache() const;
+
+  std::shared_ptr<PathVertexCache> GetPathVertexCache() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      The pipeline variants created by this content context (and
+  ///             prewarmed from the previous launch). Persisted by the
+  ///             pipeline library along with its pipeline cache.
+  ///
+  std::shared_ptr<PipelineVariantManifest> GetPipelineVariantManifest() const;
+
+  // Visible for testing.
+  bool HasPipelineVariant(const std::string& manifest_key,
+                          const ContentContextOptions& options) const;
+
 #ifdef IMPELLER_DEBUG
   std::shared_ptr<Pipeline<PipelineDescriptor>> GetCheckerboardPipeline(
       ContentContextOptions opts) const {
@@ -687,6 +726,27 @@ class ContentContext {
 
   void SetWireframe(bool wireframe);
 
+  //----------------------------------------------------------------------------
+  /// @brief      How filled paths are drawn. Paths whose tessellation is
+  ///             already cached are always drawn from the cache.
+  ///
+  void SetPathFillMode(PathFillMode mode);
+
+  PathFillMode GetPathFillMode() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Whether runtime effects whose pipelines are still compiling
+  ///             should be skipped instead of stalling the frame until the
+  ///             compilation completes.
+  ///
+  ///             The effect is drawn on the first frame after its pipeline is
+  ///             ready. Pipelines can be compiled ahead of time with
+  ///             |RuntimeEffectContents::PrewarmPipelines|.
+  ///
+  void SetAsyncRuntimeEffectCompilation(bool async);
+
+  bool IsAsyncRuntimeEffectCompilationEnabled() const;
+
   using SubpassCallback =
       std::function<bool(const ContentContext&, RenderPass&)>;
 
@@ -709,8 +769,29 @@ class ContentContext {
   std::shared_ptr<Context> context_;
   std::shared_ptr<LazyGlyphAtlas> lazy_glyph_atlas_;
 
+  class VariantsBase {
+   public:
+    virtual ~VariantsBase() = default;
+
+    /// Identifies the container in the pipeline variant manifest. Empty if
+    /// its variants are not recorded.
+    const std::string& GetManifestKey() const { return manifest_key_; }
+
+    void SetManifestKey(std::string key) { manifest_key_ = std::move(key); }
+
+    /// Start creating the variant with the given options, if it doesn't
+    /// exist yet, without waiting for it.
+    virtual void PrewarmVariant(const Context& context,
+                                const ContentContextOptions& options) = 0;
+
+    virtual bool HasVariant(const ContentContextOptions& options) const = 0;
+
+   private:
+    std::string manifest_key_;
+  };
+
   template <class PipelineT>
-  class Variants {
+  class Variants final : public VariantsBase {
    public:
     Variants() = default;
 
@@ -756,6 +837,32 @@ class ContentContext {
 
     size_t GetPipelineCount() const { return pipelines_.size(); }
 
+    // |VariantsBase|
+    bool HasVariant(const ContentContextOptions& options) const override {
+      return Get(options) != nullptr;
+    }
+
+    // |VariantsBase|
+    void PrewarmVariant(const Context& context,
+                        const ContentContextOptions& options) override {
+      if (Get(options)) {
+        return;
+      }
+      auto prototype = GetDefault();
+      if (!prototype) {
+        return;
+      }
+      auto desc = prototype->GetDescriptor();
+      if (!desc.has_value()) {
+        return;
+      }
+      options.ApplyToPipelineDescriptor(*desc);
+      desc->SetLabel(
+          SPrintF("%s V#%zu", desc->GetLabel().c_str(), GetPipelineCount()));
+      Set(options, std::make_unique<PipelineT>(
+                       context.GetPipelineLibrary()->GetPipeline(*desc)));
+    }
+
    private:
     std::optional<ContentContextOptions> default_options_;
     std::unordered_map<ContentContextOptions,
@@ -905,16 +1012,34 @@ class ContentContext {
     auto variant = std::make_unique<TypedPipeline>(std::move(variant_future));
     auto variant_pipeline = variant->WaitAndGet();
     container.Set(opts, std::move(variant));
+    if (variant_pipeline) {
+      RecordPipelineVariant(container, opts);
+    }
     return variant_pipeline;
   }
 
+  void RecordPipelineVariant(const VariantsBase& container,
+                             const ContentContextOptions& opts) const;
+
+  /// Every container of pipeline variants, along with a name that stays the
+  /// same across launches.
+  std::vector<std::pair<std::string, VariantsBase*>> GetAllPipelineVariants()
+      const;
+
+  void PrewarmRecordedPipelineVariants();
+
   bool is_valid_ = false;
   std::shared_ptr<Tessellator> tessellator_;
+  std::shared_ptr<GradientTextureCache> gradient_texture_cache_;
+  std::shared_ptr<PathVertexCache> path_vertex_cache_;
+  std::shared_ptr<PipelineVariantManifest> pipeline_variant_manifest_;
 #if IMPELLER_ENABLE_3D
   std::shared_ptr<scene::SceneContext> scene_context_;
 #endif  // IMPELLER_ENABLE_3D
   std::shared_ptr<RenderTargetAllocator> render_target_cache_;
   bool wireframe_ = false;
+  bool async_runtime_effect_compilation_ = false;
+  PathFillMode path_fill_mode_ = PathFillMode::kTessellate;
 
   ContentContext(const ContentContext&) = delete;
 
@@ -0,0 +1,78 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/entity/contents/gradient_texture_cache.h"
+
+#include "flutter/fml/hash_combine.h"
+#include "flutter/fml/logging.h"
+#include "flutter/fml/trace_event.h"
+#include "impeller/entity/contents/gradient_generator.h"
+#include "impeller/geometry/gradient.h"
+
+namespace impeller {
+
+std::size_t GradientTextureCache::Key::Hash::operator()(const Key& key) const {
+  std::size_t hash = fml::HashCombine(key.colors.size());
+  for (const auto& color : key.colors) {
+    fml::HashCombineSeed(hash, color.red, color.green, color.blue,
+                         color.alpha);
+  }
+  for (const auto& stop : key.stops) {
+    fml::HashCombineSeed(hash, stop);
+  }
+  return hash;
+}
+
+bool GradientTextureCache::Key::Equal::operator()(const Key& lhs,
+                                                  const Key& rhs) const {
+  return lhs.colors == rhs.colors && lhs.stops == rhs.stops;
+}
+
+GradientTextureCache::GradientTextureCache(size_t max_entries)
+    : max_entries_(max_entries) {
+  FML_DCHECK(max_entries_ > 0u);
+}
+
+GradientTextureCache::~GradientTextureCache() = default;
+
+std::shared_ptr<Texture> GradientTextureCache::GetOrCreateTexture(
+    const std::vector<Color>& colors,
+    const std::vector<Scalar>& stops,
+    const std::shared_ptr<Context>& context) {
+  Key key{colors, stops};
+  if (auto found = entries_.find(key); found != entries_.end()) {
+    lru_.splice(lru_.begin(), lru_, found->second.lru_position);
+    return found->second.texture;
+  }
+
+  TRACE_EVENT0("impeller", "GradientTextureCacheMiss");
+  auto texture =
+      CreateGradientTexture(CreateGradientBuffer(colors, stops), context);
+  if (!texture) {
+    return nullptr;
+  }
+
+  if (entries_.size() >= max_entries_) {
+    auto evicted = entries_.find(*lru_.back());
+    FML_DCHECK(evicted != entries_.end());
+    lru_.pop_back();
+    entries_.erase(evicted);
+  }
+  auto inserted =
+      entries_.emplace(std::move(key), Entry{.texture = texture}).first;
+  lru_.push_front(&inserted->first);
+  inserted->second.lru_position = lru_.begin();
+  return texture;
+}
+
+void GradientTextureCache::Clear() {
+  lru_.clear();
+  entries_.clear();
+}
+
+size_t GradientTextureCache::GetEntryCount() const {
+  return entries_.size();
+}
+
+}  // namespace impeller
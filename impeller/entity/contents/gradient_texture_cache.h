@@ -0,0 +1,89 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_IMPELLER_ENTITY_CONTENTS_GRADIENT_TEXTURE_CACHE_H_
+#define FLUTTER_IMPELLER_ENTITY_CONTENTS_GRADIENT_TEXTURE_CACHE_H_
+
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "impeller/core/texture.h"
+#include "impeller/geometry/color.h"
+#include "impeller/geometry/scalar.h"
+
+namespace impeller {
+
+class Context;
+
+//------------------------------------------------------------------------------
+/// @brief      A least recently used cache of the color ramp textures used to
+///             render gradients when the device does not support SSBOs.
+///
+///             The colors and stops of a gradient fully determine both the
+///             size and the contents of its ramp, so they are used as the key.
+///             Ramp textures are never written to after creation and may be
+///             shared by any number of draws across frames.
+///
+class GradientTextureCache {
+ public:
+  static constexpr size_t kDefaultMaxEntries = 64u;
+
+  explicit GradientTextureCache(size_t max_entries = kDefaultMaxEntries);
+
+  ~GradientTextureCache();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Return the ramp texture for the given gradient, creating and
+  ///             uploading it if it is not cached already. Creating a texture
+  ///             evicts the least recently used one once the cache is full.
+  ///
+  /// @return     The ramp texture, or `nullptr` if it could not be created.
+  ///
+  std::shared_ptr<Texture> GetOrCreateTexture(
+      const std::vector<Color>& colors,
+      const std::vector<Scalar>& stops,
+      const std::shared_ptr<Context>& context);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Drop all cached textures.
+  ///
+  void Clear();
+
+  // visible for testing.
+  size_t GetEntryCount() const;
+
+ private:
+  struct Key {
+    std::vector<Color> colors;
+    std::vector<Scalar> stops;
+
+    struct Hash {
+      std::size_t operator()(const Key& key) const;
+    };
+
+    struct Equal {
+      bool operator()(const Key& lhs, const Key& rhs) const;
+    };
+  };
+
+  struct Entry {
+    std::shared_ptr<Texture> texture;
+    std::list<const Key*>::iterator lru_position;
+  };
+
+  const size_t max_entries_;
+  // Most recently used first. Points at the keys owned by |entries_|.
+  std::list<const Key*> lru_;
+  std::unordered_map<Key, Entry, Key::Hash, Key::Equal> entries_;
+
+  GradientTextureCache(const GradientTextureCache&) = delete;
+
+  GradientTextureCache& operator=(const GradientTextureCache&) = delete;
+};
+
+}  // namespace impeller
+
+#endif  // FLUTTER_IMPELLER_ENTITY_CONTENTS_GRADIENT_TEXTURE_CACHE_H_
@@ -0,0 +1,63 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+#include <vector>
+
+#include "impeller/entity/contents/gradient_texture_cache.h"
+#include "impeller/entity/entity_playground.h"
+#include "impeller/playground/playground_test.h"
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace impeller {
+namespace testing {
+
+using EntityTest = EntityPlayground;
+
+TEST_P(EntityTest, GradientTextureCacheReusesTexturesForIdenticalStops) {
+  GradientTextureCache cache;
+  std::vector<Color> colors = {Color::Red(), Color::Blue()};
+  std::vector<Scalar> stops = {0.0, 1.0};
+
+  auto first = cache.GetOrCreateTexture(colors, stops, GetContext());
+  ASSERT_NE(first, nullptr);
+  auto second = cache.GetOrCreateTexture(colors, stops, GetContext());
+  ASSERT_EQ(first, second);
+  ASSERT_EQ(cache.GetEntryCount(), 1u);
+
+  std::vector<Scalar> other_stops = {0.0, 0.5};
+  auto third = cache.GetOrCreateTexture(colors, other_stops, GetContext());
+  ASSERT_NE(third, nullptr);
+  ASSERT_NE(first, third);
+  ASSERT_EQ(cache.GetEntryCount(), 2u);
+
+  cache.Clear();
+  ASSERT_EQ(cache.GetEntryCount(), 0u);
+}
+
+TEST_P(EntityTest, GradientTextureCacheEvictsLeastRecentlyUsed) {
+  GradientTextureCache cache(/*max_entries=*/2u);
+  std::vector<Scalar> stops = {0.0, 1.0};
+  std::vector<Color> red_blue = {Color::Red(), Color::Blue()};
+  std::vector<Color> red_green = {Color::Red(), Color::Green()};
+  std::vector<Color> blue_green = {Color::Blue(), Color::Green()};
+
+  auto red_blue_texture =
+      cache.GetOrCreateTexture(red_blue, stops, GetContext());
+  auto red_green_texture =
+      cache.GetOrCreateTexture(red_green, stops, GetContext());
+  // Touch red/blue so that red/green becomes the least recently used.
+  ASSERT_EQ(cache.GetOrCreateTexture(red_blue, stops, GetContext()),
+            red_blue_texture);
+
+  cache.GetOrCreateTexture(blue_green, stops, GetContext());
+  ASSERT_EQ(cache.GetEntryCount(), 2u);
+  ASSERT_EQ(cache.GetOrCreateTexture(red_blue, stops, GetContext()),
+            red_blue_texture);
+  ASSERT_NE(cache.GetOrCreateTexture(red_green, stops, GetContext()),
+            red_green_texture);
+}
+
+}  // namespace testing
+}  // namespace impeller
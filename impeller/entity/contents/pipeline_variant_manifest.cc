@@ -0,0 +1,146 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/entity/contents/pipeline_variant_manifest.h"
+
+#include <cinttypes>
+#include <cstdio>
+#include <optional>
+#include <sstream>
+#include <string_view>
+
+#include "impeller/base/strings.h"
+#include "impeller/entity/contents/content_context.h"
+
+namespace impeller {
+
+static constexpr std::string_view kManifestMagic = "impeller-pipeline-variants";
+
+// The options are stored in the same packed form used to hash them.
+static uint64_t PackOptions(const ContentContextOptions& options) {
+  return ContentContextOptions::Hash{}(options);
+}
+
+static std::optional<ContentContextOptions> UnpackOptions(uint64_t packed) {
+  auto field = [packed](int shift) -> uint8_t {
+    return static_cast<uint8_t>((packed >> shift) & 0xff);
+  };
+  ContentContextOptions options;
+  options.is_for_rrect_blur_clear = (packed >> 0) & 1u;
+  options.wireframe = (packed >> 1) & 1u;
+  options.has_stencil_attachment = (packed >> 2) & 1u;
+  options.is_for_nonzero_stencil_fill = (packed >> 3) & 1u;
+
+  if (field(16) > static_cast<uint8_t>(PixelFormat::kD32FloatS8UInt) ||
+      field(24) > static_cast<uint8_t>(PrimitiveType::kPoint) ||
+      field(32) > static_cast<uint8_t>(StencilOperation::kDecrementWrap) ||
+      field(40) > static_cast<uint8_t>(CompareFunction::kGreaterEqual) ||
+      field(48) > static_cast<uint8_t>(BlendMode::kLast) ||
+      (field(56) != static_cast<uint8_t>(SampleCount::kCount1) &&
+       field(56) != static_cast<uint8_t>(SampleCount::kCount4))) {
+    return std::nullopt;
+  }
+  options.color_attachment_pixel_format = static_cast<PixelFormat>(field(16));
+  options.primitive_type = static_cast<PrimitiveType>(field(24));
+  options.stencil_operation = static_cast<StencilOperation>(field(32));
+  options.stencil_compare = static_cast<CompareFunction>(field(40));
+  options.blend_mode = static_cast<BlendMode>(field(48));
+  options.sample_count = static_cast<SampleCount>(field(56));
+
+  // Reject unused bits being set.
+  if (PackOptions(options) != packed) {
+    return std::nullopt;
+  }
+  return options;
+}
+
+PipelineVariantManifest::PipelineVariantManifest(size_t max_entries)
+    : max_entries_(max_entries) {}
+
+PipelineVariantManifest::~PipelineVariantManifest() = default;
+
+std::unique_ptr<PipelineVariantManifest> PipelineVariantManifest::Parse(
+    const fml::Mapping* data,
+    size_t max_entries) {
+  if (data == nullptr || data->GetMapping() == nullptr) {
+    return nullptr;
+  }
+  std::istringstream stream(
+      std::string(reinterpret_cast<const char*>(data->GetMapping()),
+                  data->GetSize()));
+
+  std::string line;
+  if (!std::getline(stream, line) ||
+      line != SPrintF("%s %u", kManifestMagic.data(), kVersion)) {
+    return nullptr;
+  }
+
+  auto manifest = std::make_unique<PipelineVariantManifest>(max_entries);
+  while (std::getline(stream, line)) {
+    // Each line is the packed options in hex followed by the pipeline key.
+    uint64_t packed = 0;
+    int key_offset = 0;
+    if (std::sscanf(line.c_str(), "%" SCNx64 " %n", &packed, &key_offset) !=
+            1 ||
+        key_offset == 0 || static_cast<size_t>(key_offset) >= line.size()) {
+      return nullptr;
+    }
+    auto options = UnpackOptions(packed);
+    if (!options.has_value()) {
+      return nullptr;
+    }
+    manifest->Record(line.substr(key_offset), options.value());
+  }
+  return manifest;
+}
+
+bool PipelineVariantManifest::Record(const std::string& pipeline_key,
+                                     const ContentContextOptions& options) {
+  if (pipeline_key.empty() || pipeline_key.find('\n') != std::string::npos) {
+    return false;
+  }
+  Lock lock(mutex_);
+  if (entries_.size() >= max_entries_) {
+    return false;
+  }
+  return entries_.emplace(pipeline_key, PackOptions(options)).second;
+}
+
+void PipelineVariantManifest::ForEachVariant(
+    const std::function<void(const std::string& pipeline_key,
+                             const ContentContextOptions& options)>& callback)
+    const {
+  std::set<Entry> entries;
+  {
+    Lock lock(mutex_);
+    entries = entries_;
+  }
+  for (const auto& entry : entries) {
+    // Entries are validated when parsed or recorded.
+    callback(entry.first, UnpackOptions(entry.second).value());
+  }
+}
+
+std::shared_ptr<fml::Mapping> PipelineVariantManifest::Serialize() const {
+  std::stringstream stream;
+  stream << kManifestMagic << " " << kVersion << "\n";
+  {
+    Lock lock(mutex_);
+    for (const auto& entry : entries_) {
+      stream << SPrintF("%016" PRIx64, entry.second) << " " << entry.first
+             << "\n";
+    }
+  }
+  auto data = std::make_shared<std::string>(stream.str());
+  return std::make_shared<fml::NonOwnedMapping>(
+      reinterpret_cast<const uint8_t*>(data->data()), data->size(),
+      [data](auto, auto) {});
+}
+
+size_t PipelineVariantManifest::GetVariantCount() const {
+  Lock lock(mutex_);
+  return entries_.size();
+}
+
+}  // namespace impeller
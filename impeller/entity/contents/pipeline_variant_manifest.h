@@ -0,0 +1,101 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_IMPELLER_ENTITY_CONTENTS_PIPELINE_VARIANT_MANIFEST_H_
+#define FLUTTER_IMPELLER_ENTITY_CONTENTS_PIPELINE_VARIANT_MANIFEST_H_
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+
+#include "flutter/fml/mapping.h"
+#include "impeller/base/thread.h"
+
+namespace impeller {
+
+struct ContentContextOptions;
+
+//------------------------------------------------------------------------------
+/// @brief      The set of pipeline variants an application has used, so that
+///             they can be compiled ahead of time on the next launch.
+///
+///             The content context creates its prototype pipelines eagerly but
+///             variants (blend modes, stencil modes, sample counts, formats)
+///             only when they are first used, which blocks the frame on the
+///             pipeline library. Each variant the content context creates is
+///             recorded here. The manifest is persisted by the pipeline
+///             library along with its own cache and, when loaded on the next
+///             launch, the content context starts compiling exactly those
+///             variants in the background.
+///
+///             Variants are identified by the name of the content context
+///             container holding them along with the content context options.
+///             Manifests written with a different version are discarded.
+///
+class PipelineVariantManifest {
+ public:
+  /// The version of the serialized manifest. Must be bumped whenever the
+  /// layout of |ContentContextOptions| or the way variants are keyed changes.
+  static constexpr uint32_t kVersion = 2u;
+
+  static constexpr size_t kDefaultMaxEntries = 512u;
+
+  explicit PipelineVariantManifest(size_t max_entries = kDefaultMaxEntries);
+
+  ~PipelineVariantManifest();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Parse a manifest previously created by |Serialize|.
+  ///
+  /// @return     The manifest, or `nullptr` if the data is missing, malformed
+  ///             or of a different version.
+  ///
+  static std::unique_ptr<PipelineVariantManifest> Parse(
+      const fml::Mapping* data,
+      size_t max_entries = kDefaultMaxEntries);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Record that a variant of the pipeline identified by
+  ///             `pipeline_key` was created with the given options. Once the
+  ///             manifest is full, new variants are no longer recorded.
+  ///
+  /// @return     If the variant was not already recorded.
+  ///
+  bool Record(const std::string& pipeline_key,
+              const ContentContextOptions& options);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Invoke the callback for every recorded variant.
+  ///
+  void ForEachVariant(
+      const std::function<void(const std::string& pipeline_key,
+                               const ContentContextOptions& options)>& callback)
+      const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Serialize the manifest so that it can be persisted. May be
+  ///             called from any thread.
+  ///
+  std::shared_ptr<fml::Mapping> Serialize() const;
+
+  size_t GetVariantCount() const;
+
+ private:
+  using Entry = std::pair<std::string, uint64_t>;
+
+  const size_t max_entries_;
+  mutable Mutex mutex_;
+  std::set<Entry> entries_ IPLR_GUARDED_BY(mutex_);
+
+  PipelineVariantManifest(const PipelineVariantManifest&) = delete;
+
+  PipelineVariantManifest& operator=(const PipelineVariantManifest&) = delete;
+};
+
+}  // namespace impeller
+
+#endif  // FLUTTER_IMPELLER_ENTITY_CONTENTS_PIPELINE_VARIANT_MANIFEST_H_
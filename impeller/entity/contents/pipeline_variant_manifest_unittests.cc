@@ -0,0 +1,90 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+#include <string>
+
+#include "impeller/entity/contents/content_context.h"
+#include "impeller/entity/contents/pipeline_variant_manifest.h"
+#include "impeller/entity/entity_playground.h"
+#include "impeller/playground/playground_test.h"
+#include "impeller/typographer/backends/skia/typographer_context_skia.h"
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace impeller {
+namespace testing {
+
+using EntityTest = EntityPlayground;
+
+TEST(PipelineVariantManifestTest, RoundTripsThroughSerialization) {
+  PipelineVariantManifest manifest;
+  ContentContextOptions options;
+  options.blend_mode = BlendMode::kSourceIn;
+  options.primitive_type = PrimitiveType::kTriangleStrip;
+  options.color_attachment_pixel_format = PixelFormat::kB8G8R8A8UNormInt;
+  ASSERT_TRUE(manifest.Record("SolidFill Pipeline", options));
+  ASSERT_FALSE(manifest.Record("SolidFill Pipeline", options));
+  ASSERT_TRUE(manifest.Record("AdvancedBlend Pipeline 3 1", options));
+
+  auto parsed = PipelineVariantManifest::Parse(manifest.Serialize().get());
+  ASSERT_NE(parsed, nullptr);
+  ASSERT_EQ(parsed->GetVariantCount(), 2u);
+  parsed->ForEachVariant([&](const std::string& key,
+                             const ContentContextOptions& parsed_options) {
+    EXPECT_TRUE(key == "SolidFill Pipeline" ||
+                key == "AdvancedBlend Pipeline 3 1");
+    EXPECT_TRUE(ContentContextOptions::Equal{}(parsed_options, options));
+  });
+}
+
+TEST(PipelineVariantManifestTest, RejectsOtherVersionsAndMalformedData) {
+  ASSERT_EQ(PipelineVariantManifest::Parse(nullptr), nullptr);
+
+  auto parse = [](const std::string& data) {
+    auto mapping = fml::NonOwnedMapping(
+        reinterpret_cast<const uint8_t*>(data.data()), data.size());
+    return PipelineVariantManifest::Parse(&mapping);
+  };
+  ASSERT_EQ(parse("impeller-pipeline-variants 1\n"), nullptr);
+  ASSERT_EQ(parse("impeller-pipeline-variants 2\nnot an entry\n"), nullptr);
+  // Blend mode out of range.
+  ASSERT_EQ(parse("impeller-pipeline-variants 2\n01ff000000000004 Key\n"),
+            nullptr);
+  ASSERT_NE(parse("impeller-pipeline-variants 2\n"), nullptr);
+}
+
+TEST(PipelineVariantManifestTest, StopsRecordingWhenFull) {
+  PipelineVariantManifest manifest(/*max_entries=*/1u);
+  ASSERT_TRUE(manifest.Record("A", {}));
+  ASSERT_FALSE(manifest.Record("B", {}));
+  ASSERT_EQ(manifest.GetVariantCount(), 1u);
+}
+
+TEST_P(EntityTest, ContentContextRecordsCreatedPipelineVariants) {
+  auto content_context =
+      ContentContext(GetContext(), TypographerContextSkia::Make());
+  ASSERT_TRUE(content_context.IsValid());
+  auto manifest = content_context.GetPipelineVariantManifest();
+  ASSERT_NE(manifest, nullptr);
+
+  ContentContextOptions options;
+  options.blend_mode = BlendMode::kSourceIn;
+  options.color_attachment_pixel_format =
+      GetContext()->GetCapabilities()->GetDefaultColorFormat();
+  ASSERT_NE(content_context.GetSolidFillPipeline(options), nullptr);
+
+  // The variant may also have been prewarmed from a previous run.
+  auto recorded = 0;
+  manifest->ForEachVariant([&](const std::string& key,
+                               const ContentContextOptions& variant_options) {
+    if (ContentContextOptions::Equal{}(variant_options, options)) {
+      EXPECT_FALSE(key.empty());
+      recorded++;
+    }
+  });
+  ASSERT_GE(recorded, 1);
+}
+
+}  // namespace testing
+}  // namespace impeller
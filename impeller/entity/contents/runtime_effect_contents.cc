@@ -41,31 +41,21 @@ bool RuntimeEffectContents::CanInheritOpacity(const Entity& entity) const {
   return false;
 }
 
-bool RuntimeEffectContents::Render(const ContentContext& renderer,
-                                   const Entity& entity,
-                                   RenderPass& pass) const {
-// TODO(jonahwilliams): FragmentProgram API is not fully wired up on Android.
-// Disable until this is complete so that integration tests and benchmarks can
-// run m3 applications.
-#ifdef FML_OS_ANDROID
-  return true;
-#else
-
-  auto context = renderer.GetContext();
-  auto library = context->GetShaderLibrary();
-
-  //--------------------------------------------------------------------------
-  /// Get or register shader.
-  ///
+// Runtime effects aren't rendered on Android yet, see |Render|.
+#ifndef FML_OS_ANDROID
+static std::shared_ptr<const ShaderFunction> GetOrRegisterShader(
+    const Context& context,
+    RuntimeStage& runtime_stage) {
+  auto library = context.GetShaderLibrary();
 
   // TODO(113719): Register the shader function earlier.
 
   std::shared_ptr<const ShaderFunction> function = library->GetFunction(
-      runtime_stage_->GetEntrypoint(), ShaderStage::kFragment);
+      runtime_stage.GetEntrypoint(), ShaderStage::kFragment);
 
-  if (function && runtime_stage_->IsDirty()) {
-    context->GetPipelineLibrary()->RemovePipelinesWithEntryPoint(function);
-    library->UnregisterFunction(runtime_stage_->GetEntrypoint(),
+  if (function && runtime_stage.IsDirty()) {
+    context.GetPipelineLibrary()->RemovePipelinesWithEntryPoint(function);
+    library->UnregisterFunction(runtime_stage.GetEntrypoint(),
                                 ShaderStage::kFragment);
 
     function = nullptr;
@@ -76,44 +66,40 @@ bool RuntimeEffectContents::Render(const ContentContext& renderer,
     auto future = promise.get_future();
 
     library->RegisterFunction(
-        runtime_stage_->GetEntrypoint(),
-        ToShaderStage(runtime_stage_->GetShaderStage()),
-        runtime_stage_->GetCodeMapping(),
+        runtime_stage.GetEntrypoint(),
+        ToShaderStage(runtime_stage.GetShaderStage()),
+        runtime_stage.GetCodeMapping(),
         fml::MakeCopyable([promise = std::move(promise)](bool result) mutable {
           promise.set_value(result);
         }));
 
     if (!future.get()) {
       VALIDATION_LOG << "Failed to build runtime effect (entry point: "
-                     << runtime_stage_->GetEntrypoint() << ")";
-      return false;
+                     << runtime_stage.GetEntrypoint() << ")";
+      return nullptr;
     }
 
-    function = library->GetFunction(runtime_stage_->GetEntrypoint(),
+    function = library->GetFunction(runtime_stage.GetEntrypoint(),
                                     ShaderStage::kFragment);
     if (!function) {
       VALIDATION_LOG
           << "Failed to fetch runtime effect function immediately after "
              "registering it (entry point: "
-          << runtime_stage_->GetEntrypoint() << ")";
-      return false;
+          << runtime_stage.GetEntrypoint() << ")";
+      return nullptr;
     }
 
-    runtime_stage_->SetClean();
+    runtime_stage.SetClean();
   }
+  return function;
+}
 
-  //--------------------------------------------------------------------------
-  /// Resolve geometry.
-  ///
-
-  auto geometry_result =
-      GetGeometry()->GetPositionBuffer(renderer, entity, pass);
-
-  //--------------------------------------------------------------------------
-  /// Get or create runtime stage pipeline.
-  ///
-
-  const auto& caps = context->GetCapabilities();
+static PipelineDescriptor CreatePipelineDescriptor(
+    const Context& context,
+    const RuntimeStage& runtime_stage,
+    const ContentContextOptions& options) {
+  auto library = context.GetShaderLibrary();
+  const auto& caps = context.GetCapabilities();
   const auto color_attachment_format = caps->GetDefaultColorFormat();
   const auto stencil_attachment_format = caps->GetDefaultStencilFormat();
 
@@ -122,7 +108,7 @@ bool RuntimeEffectContents::Render(const ContentContext& renderer,
   desc.SetLabel("Runtime Stage");
   desc.AddStageEntrypoint(
       library->GetFunction(VS::kEntrypointName, ShaderStage::kVertex));
-  desc.AddStageEntrypoint(library->GetFunction(runtime_stage_->GetEntrypoint(),
+  desc.AddStageEntrypoint(library->GetFunction(runtime_stage.GetEntrypoint(),
                                                ShaderStage::kFragment));
   auto vertex_descriptor = std::make_shared<VertexDescriptor>();
   vertex_descriptor->SetStageInputs(VS::kAllShaderStageInputs,
@@ -136,20 +122,101 @@ bool RuntimeEffectContents::Render(const ContentContext& renderer,
   desc.SetStencilAttachmentDescriptors(stencil0);
   desc.SetStencilPixelFormat(stencil_attachment_format);
 
+  options.ApplyToPipelineDescriptor(desc);
+  return desc;
+}
+#endif  // FML_OS_ANDROID
+
+bool RuntimeEffectContents::PrewarmPipelines(
+    const std::shared_ptr<Context>& context,
+    const std::shared_ptr<RuntimeStage>& runtime_stage) {
+#ifdef FML_OS_ANDROID
+  return false;
+#else
+  if (!context || !runtime_stage) {
+    return false;
+  }
+  if (!GetOrRegisterShader(*context, *runtime_stage)) {
+    return false;
+  }
+
+  // Runtime effects are usually drawn with the default blend mode, either as
+  // a cover rectangle (triangle strip) or as a tessellated path (triangles),
+  // into onscreen (MSAA) and offscreen (single sample) passes.
+  std::vector<SampleCount> sample_counts = {SampleCount::kCount1};
+  if (context->GetCapabilities()->SupportsOffscreenMSAA()) {
+    sample_counts.push_back(SampleCount::kCount4);
+  }
+  for (auto sample_count : sample_counts) {
+    for (auto primitive_type :
+         {PrimitiveType::kTriangleStrip, PrimitiveType::kTriangle}) {
+      ContentContextOptions options;
+      options.sample_count = sample_count;
+      options.primitive_type = primitive_type;
+      options.color_attachment_pixel_format =
+          context->GetCapabilities()->GetDefaultColorFormat();
+      // The pipeline library keeps the future, there's no need to wait on it.
+      context->GetPipelineLibrary()->GetPipeline(
+          CreatePipelineDescriptor(*context, *runtime_stage, options));
+    }
+  }
+  return true;
+#endif  // FML_OS_ANDROID
+}
+
+bool RuntimeEffectContents::Render(const ContentContext& renderer,
+                                   const Entity& entity,
+                                   RenderPass& pass) const {
+// TODO(jonahwilliams): FragmentProgram API is not fully wired up on Android.
+// Disable until this is complete so that integration tests and benchmarks can
+// run m3 applications.
+#ifdef FML_OS_ANDROID
+  return true;
+#else
+
+  auto context = renderer.GetContext();
+
+  //--------------------------------------------------------------------------
+  /// Get or register shader.
+  ///
+
+  if (!GetOrRegisterShader(*context, *runtime_stage_)) {
+    return false;
+  }
+
+  //--------------------------------------------------------------------------
+  /// Resolve geometry.
+  ///
+
+  auto geometry_result =
+      GetGeometry()->GetPositionBuffer(renderer, entity, pass);
+
+  //--------------------------------------------------------------------------
+  /// Get or create runtime stage pipeline.
+  ///
+
   auto options = OptionsFromPassAndEntity(pass, entity);
   if (geometry_result.prevent_overdraw) {
     options.stencil_compare = CompareFunction::kEqual;
     options.stencil_operation = StencilOperation::kIncrementClamp;
   }
   options.primitive_type = geometry_result.type;
-  options.ApplyToPipelineDescriptor(desc);
 
-  auto pipeline = context->GetPipelineLibrary()->GetPipeline(desc).Get();
+  auto pipeline_future = context->GetPipelineLibrary()->GetPipeline(
+      CreatePipelineDescriptor(*context, *runtime_stage_, options));
+  if (renderer.IsAsyncRuntimeEffectCompilationEnabled() &&
+      !pipeline_future.IsReady()) {
+    // The pipeline is compiling on a worker. Skip the effect for this frame
+    // instead of stalling it.
+    return true;
+  }
+  auto pipeline = pipeline_future.Get();
   if (!pipeline) {
     VALIDATION_LOG << "Failed to get or create runtime effect pipeline.";
     return false;
   }
 
+  using VS = RuntimeEffectVertexShader;
   Command cmd;
   DEBUG_COMMAND_INFO(cmd, "RuntimeEffectContents");
   cmd.pipeline = pipeline;
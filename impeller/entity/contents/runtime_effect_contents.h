@@ -27,6 +27,22 @@ class RuntimeEffectContents final : public ColorSourceContents {
 
   void SetTextureInputs(std::vector<TextureInput> texture_inputs);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Register the shader of a runtime stage and start compiling
+  ///             the pipeline variants it is most commonly drawn with, without
+  ///             waiting for them to complete.
+  ///
+  ///             This avoids compiling pipelines on the raster thread the first
+  ///             time the effect is drawn. It should be called on the thread
+  ///             the effect is rendered on since it updates the runtime stage
+  ///             the same way rendering does.
+  ///
+  /// @return     If the shader was registered.
+  ///
+  static bool PrewarmPipelines(
+      const std::shared_ptr<Context>& context,
+      const std::shared_ptr<RuntimeStage>& runtime_stage);
+
   // | Contents|
   bool CanInheritOpacity(const Entity& entity) const override;
 
@@ -48,6 +48,13 @@ std::optional<Rect> SolidColorContents::GetCoverage(
 bool SolidColorContents::Render(const ContentContext& renderer,
                                 const Entity& entity,
                                 RenderPass& pass) const {
+  auto stencil_cover =
+      GetGeometry()->GetStencilCoverBuffers(renderer, entity, pass);
+  if (stencil_cover.has_value()) {
+    return RenderStencilThenCover(renderer, entity, pass,
+                                  std::move(stencil_cover.value()));
+  }
+
   auto capture = entity.GetCapture().CreateChild("SolidColorContents");
 
   using VS = SolidFillPipeline::VertexShader;
@@ -86,6 +93,66 @@ bool SolidColorContents::Render(const ContentContext& renderer,
   return true;
 }
 
+bool SolidColorContents::RenderStencilThenCover(
+    const ContentContext& renderer,
+    const Entity& entity,
+    RenderPass& pass,
+    StencilCoverGeometryResult geometry_result) const {
+  auto capture = entity.GetCapture().CreateChild("SolidColorContents");
+
+  {
+    using VS = ClipPipeline::VertexShader;
+
+    Command cmd;
+    DEBUG_COMMAND_INFO(cmd, "Solid Fill (Stencil)");
+    cmd.stencil_reference = entity.GetClipDepth();
+
+    // Only pixels inside the current clip are counted.
+    auto options = OptionsFromPass(pass);
+    options.blend_mode = BlendMode::kDestination;
+    options.primitive_type = PrimitiveType::kTriangle;
+    options.stencil_compare = CompareFunction::kLessEqual;
+    if (geometry_result.fill_type == FillType::kNonZero) {
+      options.is_for_nonzero_stencil_fill = true;
+    } else {
+      options.stencil_operation = StencilOperation::kInvert;
+    }
+    cmd.pipeline = renderer.GetClipPipeline(options);
+    cmd.BindVertices(std::move(geometry_result.stencil_vertex_buffer));
+
+    VS::FrameInfo frame_info;
+    frame_info.mvp = geometry_result.transform;
+    VS::BindFrameInfo(cmd,
+                      pass.GetTransientsBuffer().EmplaceUniform(frame_info));
+
+    if (!pass.AddCommand(std::move(cmd))) {
+      return false;
+    }
+  }
+
+  using VS = SolidFillPipeline::VertexShader;
+
+  Command cmd;
+  DEBUG_COMMAND_INFO(cmd, "Solid Fill (Cover)");
+  cmd.stencil_reference = entity.GetClipDepth();
+
+  // Draw where the stencil pass left a value above the clip depth, resetting
+  // it to the clip depth.
+  auto options = OptionsFromPassAndEntity(pass, entity);
+  options.primitive_type = PrimitiveType::kTriangleStrip;
+  options.stencil_compare = CompareFunction::kLess;
+  options.stencil_operation = StencilOperation::kSetToReferenceValue;
+  cmd.pipeline = renderer.GetSolidFillPipeline(options);
+  cmd.BindVertices(std::move(geometry_result.cover_vertex_buffer));
+
+  VS::FrameInfo frame_info;
+  frame_info.mvp = capture.AddMatrix("Transform", geometry_result.transform);
+  frame_info.color = capture.AddColor("Color", GetColor()).Premultiply();
+  VS::BindFrameInfo(cmd, pass.GetTransientsBuffer().EmplaceUniform(frame_info));
+
+  return pass.AddCommand(std::move(cmd));
+}
+
 std::unique_ptr<SolidColorContents> SolidColorContents::Make(Path path,
                                                              Color color) {
   auto contents = std::make_unique<SolidColorContents>();
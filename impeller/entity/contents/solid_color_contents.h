@@ -58,6 +58,11 @@ class SolidColorContents final : public ColorSourceContents {
  private:
   Color color_;
 
+  bool RenderStencilThenCover(const ContentContext& renderer,
+                              const Entity& entity,
+                              RenderPass& pass,
+                              StencilCoverGeometryResult geometry_result) const;
+
   SolidColorContents(const SolidColorContents&) = delete;
 
   SolidColorContents& operator=(const SolidColorContents&) = delete;
@@ -4,6 +4,7 @@
 
 #include "impeller/entity/entity_pass.h"
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 #include <variant>
@@ -702,11 +703,13 @@ bool EntityPass::RenderElement(Entity& element_entity,
     // Restore any clips that were recorded before the backdrop filter was
     // applied.
     auto& replay_entities = clip_replay_->GetReplayEntities();
-    for (const auto& entity : replay_entities) {
-      if (!entity.Render(renderer, *result.pass)) {
+    for (const auto& replay : replay_entities) {
+      result.pass->SetScissor(replay.scissor);
+      if (!replay.entity.Render(renderer, *result.pass)) {
         VALIDATION_LOG << "Failed to render entity for clip restore.";
       }
     }
+    result.pass->SetScissor(std::nullopt);
 
     auto size_rect = Rect::MakeSize(result.pass->GetRenderTargetSize());
     auto msaa_backdrop_contents = TextureContents::MakeRect(size_rect);
@@ -754,14 +757,23 @@ bool EntityPass::RenderElement(Entity& element_entity,
       break;
     case Contents::ClipCoverage::Type::kAppend: {
       auto op = clip_coverage_stack.back().coverage;
-      clip_coverage_stack.push_back(
-          ClipCoverageLayer{.coverage = clip_coverage.coverage,
-                            .clip_depth = element_entity.GetClipDepth() + 1});
+      // Pixel aligned rectangle clips don't need the stencil buffer. Entities
+      // within them are scissored to the clip coverage instead.
+      auto is_scissor =
+          clip_coverage.coverage.has_value() &&
+          static_cast<ClipContents*>(element_entity.GetContents().get())
+              ->CanApplyAsScissor(element_entity);
+      clip_coverage_stack.push_back(ClipCoverageLayer{
+          .coverage = clip_coverage.coverage,
+          .clip_depth = element_entity.GetClipDepth() + 1,
+          .scissor = is_scissor ? clip_coverage.coverage
+                                : clip_coverage_stack.back().scissor,
+          .is_scissor = is_scissor});
       FML_DCHECK(clip_coverage_stack.back().clip_depth ==
                  clip_coverage_stack.front().clip_depth +
                      clip_coverage_stack.size() - 1);
 
-      if (!op.has_value()) {
+      if (is_scissor || !op.has_value()) {
         // Running this append op won't impact the clip buffer because the
         // whole screen is already being clipped, so skip it.
         return true;
@@ -788,8 +800,19 @@ bool EntityPass::RenderElement(Entity& element_entity,
         // Make the coverage rectangle relative to the current pass.
         restore_coverage = restore_coverage->Shift(-global_pass_position);
       }
+      auto only_scissors_restored =
+          std::all_of(clip_coverage_stack.begin() + restoration_index + 1,
+                      clip_coverage_stack.end(),
+                      [](const ClipCoverageLayer& layer) {
+                        return layer.is_scissor;
+                      });
       clip_coverage_stack.resize(restoration_index + 1);
 
+      if (only_scissors_restored) {
+        // None of the restored clips touched the stencil buffer.
+        return true;
+      }
+
       if (!clip_coverage_stack.back().coverage.has_value()) {
         // Running this restore op won't make anything renderable, so skip it.
         return true;
@@ -814,9 +837,33 @@ bool EntityPass::RenderElement(Entity& element_entity,
   }
 #endif
 
-  element_entity.SetClipDepth(element_entity.GetClipDepth() - clip_depth_floor);
-  clip_replay_->RecordEntity(element_entity, clip_coverage.type);
-  if (!element_entity.Render(renderer, *result.pass)) {
+  // Clips applied as scissors don't increment the stencil, so the entity's
+  // clip depth is lowered by the number of scissors it is drawn within.
+  size_t scissor_count = std::count_if(
+      clip_coverage_stack.begin(), clip_coverage_stack.end(),
+      [&](const ClipCoverageLayer& layer) {
+        return layer.is_scissor && layer.clip_depth > clip_depth_floor &&
+               layer.clip_depth <= element_entity.GetClipDepth();
+      });
+  element_entity.SetClipDepth(element_entity.GetClipDepth() -
+                              clip_depth_floor - scissor_count);
+
+  std::optional<IRect> scissor;
+  if (auto scissor_coverage = clip_coverage_stack.back().scissor;
+      scissor_coverage.has_value()) {
+    scissor = IRect::MakeSize(result.pass->GetRenderTargetSize())
+                  .Intersection(IRect(Rect::RoundOut(
+                      scissor_coverage->Shift(-global_pass_position))));
+    if (!scissor.has_value()) {
+      return true;  // Nothing to render.
+    }
+  }
+
+  clip_replay_->RecordEntity(element_entity, clip_coverage.type, scissor);
+  result.pass->SetScissor(scissor);
+  auto rendered = element_entity.Render(renderer, *result.pass);
+  result.pass->SetScissor(std::nullopt);
+  if (!rendered) {
     VALIDATION_LOG << "Failed to render entity.";
     return false;
   }
@@ -1170,20 +1217,28 @@ void EntityPass::SetEnableOffscreenCheckerboard(bool enabled) {
 EntityPassClipRecorder::EntityPassClipRecorder() {}
 
 void EntityPassClipRecorder::RecordEntity(const Entity& entity,
-                                          Contents::ClipCoverage::Type type) {
+                                          Contents::ClipCoverage::Type type,
+                                          std::optional<IRect> scissor) {
   switch (type) {
     case Contents::ClipCoverage::Type::kNoChange:
       return;
     case Contents::ClipCoverage::Type::kAppend:
-      rendered_clip_entities_.push_back(entity.Clone());
+      rendered_clip_entities_.push_back(
+          ReplayEntity{.entity = entity.Clone(), .scissor = scissor});
       break;
     case Contents::ClipCoverage::Type::kRestore:
-      rendered_clip_entities_.pop_back();
+      // A restore may pop several clips at once.
+      while (!rendered_clip_entities_.empty() &&
+             rendered_clip_entities_.back().entity.GetClipDepth() >=
+                 entity.GetClipDepth()) {
+        rendered_clip_entities_.pop_back();
+      }
       break;
   }
 }
 
-const std::vector<Entity>& EntityPassClipRecorder::GetReplayEntities() const {
+const std::vector<EntityPassClipRecorder::ReplayEntity>&
+EntityPassClipRecorder::GetReplayEntities() const {
   return rendered_clip_entities_;
 }
 
@@ -46,6 +46,12 @@ class EntityPass {
   struct ClipCoverageLayer {
     std::optional<Rect> coverage;
     size_t clip_depth;
+    /// The scissor that entities drawn at this depth are restricted to, in
+    /// global coordinates.
+    std::optional<Rect> scissor;
+    /// Whether this layer was applied as a scissor instead of being drawn to
+    /// the stencil buffer.
+    bool is_scissor = false;
   };
 
   using ClipCoverageStack = std::vector<ClipCoverageLayer>;
@@ -332,13 +338,21 @@ class EntityPassClipRecorder {
 
   ~EntityPassClipRecorder() = default;
 
+  struct ReplayEntity {
+    Entity entity;
+    /// The scissor the entity was rendered with.
+    std::optional<IRect> scissor;
+  };
+
   /// @brief Record the entity based on the provided coverage [type].
-  void RecordEntity(const Entity& entity, Contents::ClipCoverage::Type type);
+  void RecordEntity(const Entity& entity,
+                    Contents::ClipCoverage::Type type,
+                    std::optional<IRect> scissor = std::nullopt);
 
-  const std::vector<Entity>& GetReplayEntities() const;
+  const std::vector<ReplayEntity>& GetReplayEntities() const;
 
  private:
-  std::vector<Entity> rendered_clip_entities_;
+  std::vector<ReplayEntity> rendered_clip_entities_;
 };
 
 }  // namespace impeller
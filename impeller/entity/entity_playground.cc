@@ -70,6 +70,12 @@ bool EntityPlayground::OpenPlaygroundHere(EntityPlaygroundCallback callback) {
       wireframe = !wireframe;
       content_context.SetWireframe(wireframe);
     }
+    if (ImGui::IsKeyPressed(ImGuiKey_S)) {
+      content_context.SetPathFillMode(
+          content_context.GetPathFillMode() == PathFillMode::kTessellate
+              ? PathFillMode::kStencilThenCover
+              : PathFillMode::kTessellate);
+    }
     return callback(content_context, pass);
   };
   return Playground::OpenPlaygroundHere(pass_callback);
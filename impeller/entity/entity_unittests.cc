@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #include <cstring>
+#include <future>
 #include <memory>
 #include <optional>
 #include <utility>
@@ -45,6 +46,8 @@
 #include "impeller/playground/playground.h"
 #include "impeller/playground/widgets.h"
 #include "impeller/renderer/command.h"
+#include "impeller/renderer/context.h"
+#include "impeller/renderer/pipeline_library.h"
 #include "impeller/renderer/pipeline_descriptor.h"
 #include "impeller/renderer/render_pass.h"
 #include "impeller/renderer/vertex_buffer_builder.h"
@@ -1619,6 +1622,46 @@ TEST_P(EntityTest, SolidFillShouldRenderIsCorrect) {
   }
 }
 
+TEST_P(EntityTest, SolidFillUsesStencilThenCoverForChangingPaths) {
+  ContentContext content_context(GetContext(), TypographerContextSkia::Make());
+  ASSERT_TRUE(content_context.IsValid());
+  content_context.SetPathFillMode(PathFillMode::kStencilThenCover);
+
+  auto render_command_count = [&](FillType fill_type, uint32_t clip_depth) {
+    auto path = PathBuilder{}
+                    .MoveTo({0, 0})
+                    .LineTo({100, 0})
+                    .LineTo({50, 50})
+                    .LineTo({100, 100})
+                    .LineTo({0, 100})
+                    .Close()
+                    .TakePath(fill_type);
+    auto contents = std::make_shared<SolidColorContents>();
+    contents->SetColor(Color::CornflowerBlue());
+    contents->SetGeometry(Geometry::MakeFillPath(std::move(path)));
+    Entity entity;
+    entity.SetClipDepth(clip_depth);
+
+    auto buffer = GetContext()->CreateCommandBuffer();
+    auto render_target = RenderTarget::CreateOffscreenMSAA(
+        *GetContext(), *content_context.GetRenderTargetCache(), {100, 100});
+    auto render_pass = buffer->CreateRenderPass(render_target);
+    EXPECT_TRUE(contents->Render(content_context, entity, *render_pass));
+    return render_pass->GetCommands().size();
+  };
+
+  // Stencil and cover.
+  EXPECT_EQ(render_command_count(FillType::kOdd, 1u), 2u);
+  // A path that is seen again is tessellated into the vertex cache instead.
+  EXPECT_EQ(render_command_count(FillType::kOdd, 1u), 1u);
+
+  content_context.GetPathVertexCache()->Clear();
+  EXPECT_EQ(render_command_count(FillType::kNonZero, 0u), 2u);
+  // Non-zero winding can't be counted inside a clip.
+  content_context.GetPathVertexCache()->Clear();
+  EXPECT_EQ(render_command_count(FillType::kNonZero, 1u), 1u);
+}
+
 TEST_P(EntityTest, DoesNotCullEntitiesByDefault) {
   auto fill = std::make_shared<SolidColorContents>();
   fill->SetColor(Color::CornflowerBlue());
@@ -1717,6 +1760,74 @@ TEST_P(EntityTest, ClipContentsGetClipCoverageIsCorrect) {
   }
 }
 
+TEST_P(EntityTest, ClipContentsCanApplyPixelAlignedRectsAsScissors) {
+  auto make_clip = [](Rect rect, Entity::ClipOperation clip_op) {
+    auto clip = std::make_shared<ClipContents>();
+    clip->SetClipOperation(clip_op);
+    clip->SetGeometry(Geometry::MakeRect(rect));
+    return clip;
+  };
+  Entity entity;
+
+  auto aligned = make_clip(Rect::MakeLTRB(10, 10, 50, 50),
+                           Entity::ClipOperation::kIntersect);
+  ASSERT_TRUE(aligned->CanApplyAsScissor(entity));
+  entity.SetTransform(Matrix::MakeTranslation({0.5, 0, 0}));
+  ASSERT_FALSE(aligned->CanApplyAsScissor(entity));
+  entity.SetTransform(Matrix::MakeScale({2, 2, 1}));
+  ASSERT_TRUE(aligned->CanApplyAsScissor(entity));
+  entity.SetTransform(Matrix::MakeRotationZ(Radians{0.5}));
+  ASSERT_FALSE(aligned->CanApplyAsScissor(entity));
+  entity.SetTransform({});
+
+  auto difference = make_clip(Rect::MakeLTRB(10, 10, 50, 50),
+                              Entity::ClipOperation::kDifference);
+  ASSERT_FALSE(difference->CanApplyAsScissor(entity));
+
+  ClipContents oval;
+  oval.SetGeometry(Geometry::MakeOval(Rect::MakeLTRB(10, 10, 50, 50)));
+  ASSERT_FALSE(oval.CanApplyAsScissor(entity));
+}
+
+TEST_P(EntityTest, RenderPassScissorRestrictsCommandScissors) {
+  auto content_context =
+      ContentContext(GetContext(), TypographerContextSkia::Make());
+  auto buffer = GetContext()->CreateCommandBuffer();
+  auto render_target = RenderTarget::CreateOffscreenMSAA(
+      *GetContext(), *content_context.GetRenderTargetCache(), {100, 100});
+  auto pass = buffer->CreateRenderPass(render_target);
+
+  auto make_command = [&](std::optional<IRect> scissor) {
+    using VS = SolidFillVertexShader;
+    Command cmd;
+    cmd.pipeline = content_context.GetSolidFillPipeline(OptionsFromPass(*pass));
+    cmd.BindVertices(
+        VertexBufferBuilder<VS::PerVertexData>{}
+            .AddVertices({{Point(0, 0)}, {Point(10, 0)}, {Point(0, 10)}})
+            .CreateVertexBuffer(pass->GetTransientsBuffer()));
+    cmd.scissor = scissor;
+    return cmd;
+  };
+
+  pass->SetScissor(IRect::MakeLTRB(10, 10, 50, 50));
+  EXPECT_TRUE(pass->AddCommand(make_command(std::nullopt)));
+  // Nested within the pass scissor.
+  EXPECT_TRUE(pass->AddCommand(make_command(IRect::MakeLTRB(20, 20, 30, 30))));
+  // Overlapping the pass scissor.
+  EXPECT_TRUE(pass->AddCommand(make_command(IRect::MakeLTRB(0, 0, 20, 20))));
+  // Disjoint from the pass scissor, so nothing would be drawn.
+  EXPECT_TRUE(pass->AddCommand(make_command(IRect::MakeLTRB(60, 60, 70, 70))));
+  pass->SetScissor(std::nullopt);
+  EXPECT_TRUE(pass->AddCommand(make_command(IRect::MakeLTRB(60, 60, 70, 70))));
+
+  const auto& commands = pass->GetCommands();
+  ASSERT_EQ(commands.size(), 4u);
+  EXPECT_EQ(commands[0].scissor, IRect::MakeLTRB(10, 10, 50, 50));
+  EXPECT_EQ(commands[1].scissor, IRect::MakeLTRB(20, 20, 30, 30));
+  EXPECT_EQ(commands[2].scissor, IRect::MakeLTRB(10, 10, 20, 20));
+  EXPECT_EQ(commands[3].scissor, IRect::MakeLTRB(60, 60, 70, 70));
+}
+
 TEST_P(EntityTest, RRectShadowTest) {
   auto callback = [&](ContentContext& context, RenderPass& pass) {
     static Color color = Color::Red();
@@ -2163,6 +2274,237 @@ TEST_P(EntityTest, RuntimeEffect) {
   ASSERT_TRUE(OpenPlaygroundHere(callback));
 }
 
+TEST_P(EntityTest, RuntimeEffectPrewarmRegistersShader) {
+  if (GetParam() != PlaygroundBackend::kMetal) {
+    GTEST_SKIP_("This backend doesn't support runtime effects.");
+  }
+
+  auto runtime_stage =
+      OpenAssetAsRuntimeStage("runtime_stage_example.frag.iplr");
+  ASSERT_TRUE(runtime_stage->IsDirty());
+
+  ASSERT_TRUE(
+      RuntimeEffectContents::PrewarmPipelines(GetContext(), runtime_stage));
+  ASSERT_FALSE(runtime_stage->IsDirty());
+  ASSERT_NE(GetContext()->GetShaderLibrary()->GetFunction(
+                runtime_stage->GetEntrypoint(), ShaderStage::kFragment),
+            nullptr);
+}
+
+namespace {
+
+/// Forwards to another pipeline library, but can hold back the pipelines it
+/// hands out until |Release| is called, and can provide a variant manifest.
+class HeldPipelineLibrary final : public PipelineLibrary {
+ public:
+  explicit HeldPipelineLibrary(std::shared_ptr<PipelineLibrary> library)
+      : library_(std::move(library)) {}
+
+  void SetVariantManifest(std::shared_ptr<fml::Mapping> manifest) {
+    variant_manifest_ = std::move(manifest);
+  }
+
+  void Hold() { held_ = true; }
+
+  void Release() {
+    held_ = false;
+    for (auto& [descriptor, promise] : pending_) {
+      promise.set_value(library_->GetPipeline(descriptor).Get());
+    }
+    pending_.clear();
+  }
+
+  size_t GetHeldCount() const { return pending_.size(); }
+
+  // |PipelineLibrary|
+  bool IsValid() const override { return library_->IsValid(); }
+
+  // |PipelineLibrary|
+  PipelineFuture<PipelineDescriptor> GetPipeline(
+      PipelineDescriptor descriptor) override {
+    if (!held_) {
+      return library_->GetPipeline(descriptor);
+    }
+    pending_.emplace_back(descriptor, std::promise<PipelineRef>{});
+    return {descriptor, pending_.back().second.get_future().share()};
+  }
+
+  // |PipelineLibrary|
+  PipelineFuture<ComputePipelineDescriptor> GetPipeline(
+      ComputePipelineDescriptor descriptor) override {
+    return library_->GetPipeline(descriptor);
+  }
+
+  // |PipelineLibrary|
+  void RemovePipelinesWithEntryPoint(
+      std::shared_ptr<const ShaderFunction> function) override {
+    library_->RemovePipelinesWithEntryPoint(std::move(function));
+  }
+
+  // |PipelineLibrary|
+  std::shared_ptr<fml::Mapping> LoadVariantManifest() const override {
+    return variant_manifest_;
+  }
+
+ private:
+  using PipelineRef = std::shared_ptr<Pipeline<PipelineDescriptor>>;
+
+  const std::shared_ptr<PipelineLibrary> library_;
+  std::shared_ptr<fml::Mapping> variant_manifest_;
+  bool held_ = false;
+  std::vector<std::pair<PipelineDescriptor, std::promise<PipelineRef>>>
+      pending_;
+};
+
+/// Forwards to another context, but hands out a |HeldPipelineLibrary|.
+class HeldPipelineContext final : public Context {
+ public:
+  explicit HeldPipelineContext(std::shared_ptr<Context> context)
+      : context_(std::move(context)),
+        pipeline_library_(std::make_shared<HeldPipelineLibrary>(
+            context_->GetPipelineLibrary())) {}
+
+  HeldPipelineLibrary& GetHeldPipelineLibrary() const {
+    return *pipeline_library_;
+  }
+
+  // |Context|
+  BackendType GetBackendType() const override {
+    return context_->GetBackendType();
+  }
+
+  // |Context|
+  std::string DescribeGpuModel() const override {
+    return context_->DescribeGpuModel();
+  }
+
+  // |Context|
+  bool IsValid() const override { return context_->IsValid(); }
+
+  // |Context|
+  const std::shared_ptr<const Capabilities>& GetCapabilities() const override {
+    return context_->GetCapabilities();
+  }
+
+  // |Context|
+  std::shared_ptr<Allocator> GetResourceAllocator() const override {
+    return context_->GetResourceAllocator();
+  }
+
+  // |Context|
+  std::shared_ptr<ShaderLibrary> GetShaderLibrary() const override {
+    return context_->GetShaderLibrary();
+  }
+
+  // |Context|
+  std::shared_ptr<SamplerLibrary> GetSamplerLibrary() const override {
+    return context_->GetSamplerLibrary();
+  }
+
+  // |Context|
+  std::shared_ptr<PipelineLibrary> GetPipelineLibrary() const override {
+    return pipeline_library_;
+  }
+
+  // |Context|
+  std::shared_ptr<CommandBuffer> CreateCommandBuffer() const override {
+    return context_->CreateCommandBuffer();
+  }
+
+  // |Context|
+  void Shutdown() override {}
+
+ private:
+  const std::shared_ptr<Context> context_;
+  const std::shared_ptr<HeldPipelineLibrary> pipeline_library_;
+};
+
+}  // namespace
+
+TEST_P(EntityTest, AsyncRuntimeEffectCompilationSkipsPendingPipelines) {
+  if (GetParam() != PlaygroundBackend::kMetal) {
+    GTEST_SKIP_("This backend doesn't support runtime effects.");
+  }
+
+  auto held_context = std::make_shared<HeldPipelineContext>(GetContext());
+  auto content_context =
+      ContentContext(held_context, TypographerContextSkia::Make());
+  ASSERT_TRUE(content_context.IsValid());
+  ASSERT_FALSE(content_context.IsAsyncRuntimeEffectCompilationEnabled());
+  content_context.SetAsyncRuntimeEffectCompilation(true);
+
+  auto contents = std::make_shared<RuntimeEffectContents>();
+  contents->SetGeometry(Geometry::MakeCover());
+  contents->SetRuntimeStage(
+      OpenAssetAsRuntimeStage("runtime_stage_example.frag.iplr"));
+  struct FragUniforms {
+    Vector2 iResolution;
+    Scalar iTime;
+  } frag_uniforms = {.iResolution = Vector2(100, 100), .iTime = 0};
+  auto uniform_data = std::make_shared<std::vector<uint8_t>>();
+  uniform_data->resize(sizeof(FragUniforms));
+  memcpy(uniform_data->data(), &frag_uniforms, sizeof(FragUniforms));
+  contents->SetUniformData(uniform_data);
+
+  auto render_command_count = [&]() -> size_t {
+    auto buffer = GetContext()->CreateCommandBuffer();
+    auto render_target = RenderTarget::CreateOffscreenMSAA(
+        *GetContext(), *content_context.GetRenderTargetCache(), {100, 100});
+    auto render_pass = buffer->CreateRenderPass(render_target);
+    Entity entity;
+    entity.SetContents(contents);
+    EXPECT_TRUE(contents->Render(content_context, entity, *render_pass));
+    return render_pass->GetCommands().size();
+  };
+
+  auto& pipeline_library = held_context->GetHeldPipelineLibrary();
+  pipeline_library.Hold();
+  // The effect is skipped while its pipeline is compiling.
+  EXPECT_EQ(render_command_count(), 0u);
+  EXPECT_EQ(pipeline_library.GetHeldCount(), 1u);
+
+  // And drawn once the pipeline is ready.
+  pipeline_library.Release();
+  EXPECT_EQ(render_command_count(), 1u);
+}
+
+TEST_P(EntityTest, ContentContextPrewarmsRecordedPipelineVariants) {
+  auto held_context = std::make_shared<HeldPipelineContext>(GetContext());
+  ContentContextOptions options{
+      .sample_count = SampleCount::kCount4,
+      .blend_mode = BlendMode::kPlus,
+      .color_attachment_pixel_format =
+          GetContext()->GetCapabilities()->GetDefaultColorFormat()};
+
+  auto recording_context =
+      ContentContext(held_context, TypographerContextSkia::Make());
+  ASSERT_TRUE(recording_context.IsValid());
+  // These containers are built from the same shaders.
+  ASSERT_NE(recording_context.GetPositionUVPipeline(options), nullptr);
+  ASSERT_NE(recording_context.GetTiledTexturePipeline(options), nullptr);
+  auto manifest = recording_context.GetPipelineVariantManifest();
+  ASSERT_EQ(manifest->GetVariantCount(), 2u);
+
+  held_context->GetHeldPipelineLibrary().SetVariantManifest(
+      manifest->Serialize());
+  auto content_context =
+      ContentContext(held_context, TypographerContextSkia::Make());
+  ASSERT_TRUE(content_context.IsValid());
+
+  auto recorded = 0u;
+  manifest->ForEachVariant([&](const std::string& key,
+                               const ContentContextOptions& recorded_options) {
+    EXPECT_TRUE(content_context.HasPipelineVariant(key, recorded_options))
+        << key;
+    recorded++;
+  });
+  EXPECT_EQ(recorded, 2u);
+  EXPECT_FALSE(
+      content_context.HasPipelineVariant("solid_fill_pipelines_", options));
+  EXPECT_EQ(content_context.GetPipelineVariantManifest()->GetVariantCount(),
+            2u);
+}
+
 TEST_P(EntityTest, InheritOpacityTest) {
   Entity entity;
 
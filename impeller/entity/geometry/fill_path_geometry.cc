@@ -4,6 +4,7 @@
 
 #include "impeller/entity/geometry/fill_path_geometry.h"
 #include "impeller/core/formats.h"
+#include "impeller/entity/geometry/path_vertex_cache.h"
 
 namespace impeller {
 
@@ -15,54 +16,89 @@ GeometryResult FillPathGeometry::GetPositionBuffer(
     const Entity& entity,
     RenderPass& pass) const {
   auto& host_buffer = pass.GetTransientsBuffer();
+  auto transform = Matrix::MakeOrthographic(pass.GetRenderTargetSize()) *
+                   entity.GetTransform();
+
+  PathVertexCache::Parameters parameters;
+  parameters.scale = PathVertexCache::QuantizeScale(
+      entity.GetTransform().GetMaxBasisLength());
+  auto& cache = *renderer.GetPathVertexCache();
+  auto lookup = cache.Find(path_, parameters);
+  if (lookup.vertex_buffer.has_value()) {
+    return GeometryResult{
+        .type = lookup.type,
+        .vertex_buffer = lookup.vertex_buffer.value(),
+        .transform = transform,
+        .prevent_overdraw = false,
+    };
+  }
+
+  // Paths that have been seen before are placed in device buffers owned by
+  // the cache instead of the per-frame transients buffer.
+  bool in_device_buffers = lookup.should_store;
+  auto allocator = renderer.GetContext()->GetResourceAllocator();
+  auto emplace = [&host_buffer, &allocator, &in_device_buffers](
+                     const void* data, size_t length,
+                     size_t align) -> BufferView {
+    if (in_device_buffers) {
+      auto buffer = allocator->CreateBufferWithCopy(
+          reinterpret_cast<const uint8_t*>(data), length);
+      if (buffer) {
+        return buffer->AsBufferView();
+      }
+      in_device_buffers = false;
+    }
+    return host_buffer.Emplace(data, length, align);
+  };
+
   VertexBuffer vertex_buffer;
+  PrimitiveType type;
 
   if (path_.GetFillType() == FillType::kNonZero &&  //
       path_.IsConvex()) {
-    auto points = renderer.GetTessellator()->TessellateConvex(
-        path_, entity.GetTransform().GetMaxBasisLength());
+    auto points =
+        renderer.GetTessellator()->TessellateConvex(path_, parameters.scale);
 
-    vertex_buffer.vertex_buffer = host_buffer.Emplace(
-        points.data(), points.size() * sizeof(Point), alignof(Point));
+    vertex_buffer.vertex_buffer =
+        emplace(points.data(), points.size() * sizeof(Point), alignof(Point));
     vertex_buffer.index_buffer = {}, vertex_buffer.vertex_count = points.size();
     vertex_buffer.index_type = IndexType::kNone;
-
-    return GeometryResult{
-        .type = PrimitiveType::kTriangleStrip,
-        .vertex_buffer = vertex_buffer,
-        .transform = Matrix::MakeOrthographic(pass.GetRenderTargetSize()) *
-                     entity.GetTransform(),
-        .prevent_overdraw = false,
-    };
+    type = PrimitiveType::kTriangleStrip;
+  } else {
+    auto tesselation_result = renderer.GetTessellator()->Tessellate(
+        path_, parameters.scale,
+        [&vertex_buffer, &emplace](const float* vertices,
+                                   size_t vertices_count,
+                                   const uint16_t* indices,
+                                   size_t indices_count) {
+          vertex_buffer.vertex_buffer = emplace(
+              vertices, vertices_count * sizeof(float) * 2, alignof(float));
+          if (indices != nullptr) {
+            vertex_buffer.index_buffer =
+                emplace(indices, indices_count * sizeof(uint16_t),
+                        alignof(uint16_t));
+            vertex_buffer.vertex_count = indices_count;
+            vertex_buffer.index_type = IndexType::k16bit;
+          } else {
+            vertex_buffer.index_buffer = {};
+            vertex_buffer.vertex_count = vertices_count;
+            vertex_buffer.index_type = IndexType::kNone;
+          }
+          return true;
+        });
+    if (tesselation_result != Tessellator::Result::kSuccess) {
+      return {};
+    }
+    type = PrimitiveType::kTriangle;
   }
 
-  auto tesselation_result = renderer.GetTessellator()->Tessellate(
-      path_, entity.GetTransform().GetMaxBasisLength(),
-      [&vertex_buffer, &host_buffer](
-          const float* vertices, size_t vertices_count, const uint16_t* indices,
-          size_t indices_count) {
-        vertex_buffer.vertex_buffer = host_buffer.Emplace(
-            vertices, vertices_count * sizeof(float) * 2, alignof(float));
-        if (indices != nullptr) {
-          vertex_buffer.index_buffer = host_buffer.Emplace(
-              indices, indices_count * sizeof(uint16_t), alignof(uint16_t));
-          vertex_buffer.vertex_count = indices_count;
-          vertex_buffer.index_type = IndexType::k16bit;
-        } else {
-          vertex_buffer.index_buffer = {};
-          vertex_buffer.vertex_count = vertices_count;
-          vertex_buffer.index_type = IndexType::kNone;
-        }
-        return true;
-      });
-  if (tesselation_result != Tessellator::Result::kSuccess) {
-    return {};
+  if (in_device_buffers) {
+    cache.Store(lookup, path_, parameters, vertex_buffer, type);
   }
   return GeometryResult{
-      .type = PrimitiveType::kTriangle,
+      .type = type,
       .vertex_buffer = vertex_buffer,
-      .transform = Matrix::MakeOrthographic(pass.GetRenderTargetSize()) *
-                   entity.GetTransform(),
+      .transform = transform,
       .prevent_overdraw = false,
   };
 }
@@ -137,6 +173,83 @@ GeometryResult FillPathGeometry::GetPositionUVBuffer(
   };
 }
 
+// Pixels inside the current clip hold the clip depth in the stencil buffer
+// and those outside of it hold less. The stencil pass may only change the
+// former, and the cover pass resets them to the clip depth.
+static bool CanStencilFill(FillType fill_type, uint32_t clip_depth) {
+  switch (fill_type) {
+    case FillType::kOdd:
+      // Inverting toggles the value between d and 255 - d, which are both at
+      // least d while d stays below 128.
+      return clip_depth < 128u;
+    case FillType::kNonZero:
+      // Winding counts can go below the starting value, so they can't be
+      // told apart from pixels outside of a clip.
+      return clip_depth == 0u;
+    case FillType::kPositive:
+    case FillType::kNegative:
+    case FillType::kAbsGeqTwo:
+      return false;
+  }
+  FML_UNREACHABLE();
+}
+
+std::optional<StencilCoverGeometryResult>
+FillPathGeometry::GetStencilCoverBuffers(const ContentContext& renderer,
+                                         const Entity& entity,
+                                         RenderPass& pass) const {
+  if (renderer.GetPathFillMode() != PathFillMode::kStencilThenCover) {
+    return std::nullopt;
+  }
+  // Convex paths are already cheap to tessellate.
+  if (path_.GetFillType() == FillType::kNonZero && path_.IsConvex()) {
+    return std::nullopt;
+  }
+  if (!pass.HasStencilAttachment() ||
+      !CanStencilFill(path_.GetFillType(), entity.GetClipDepth())) {
+    return std::nullopt;
+  }
+  auto coverage = path_.GetBoundingBox();
+  if (!coverage.has_value() || coverage->IsEmpty()) {
+    return std::nullopt;
+  }
+
+  // Paths drawn over and over again are tessellated once into the vertex
+  // cache, which costs less than stenciling them every frame.
+  PathVertexCache::Parameters parameters;
+  parameters.scale = PathVertexCache::QuantizeScale(
+      entity.GetTransform().GetMaxBasisLength());
+  auto lookup = renderer.GetPathVertexCache()->Find(path_, parameters);
+  if (lookup.vertex_buffer.has_value() || lookup.should_store) {
+    return std::nullopt;
+  }
+
+  auto& host_buffer = pass.GetTransientsBuffer();
+  auto points =
+      renderer.GetTessellator()->TessellateStencilFan(path_, parameters.scale);
+  if (points.empty()) {
+    return std::nullopt;
+  }
+
+  StencilCoverGeometryResult result;
+  result.stencil_vertex_buffer.vertex_buffer = host_buffer.Emplace(
+      points.data(), points.size() * sizeof(Point), alignof(Point));
+  result.stencil_vertex_buffer.vertex_count = points.size();
+  result.stencil_vertex_buffer.index_type = IndexType::kNone;
+
+  auto cover_points = coverage->GetPoints();
+  result.cover_vertex_buffer.vertex_buffer =
+      host_buffer.Emplace(cover_points.data(),
+                          cover_points.size() * sizeof(Point), alignof(Point));
+  result.cover_vertex_buffer.vertex_count = cover_points.size();
+  result.cover_vertex_buffer.index_type = IndexType::kNone;
+
+  result.transform = Matrix::MakeOrthographic(pass.GetRenderTargetSize()) *
+                     entity.GetTransform();
+  result.fill_type = path_.GetFillType();
+  return result;
+}
+
 GeometryVertexType FillPathGeometry::GetVertexType() const {
   return GeometryVertexType::kPosition;
 }
@@ -23,6 +23,12 @@ class FillPathGeometry final : public Geometry {
   // |Geometry|
   bool CoversArea(const Matrix& transform, const Rect& rect) const override;
 
+  // |Geometry|
+  std::optional<StencilCoverGeometryResult> GetStencilCoverBuffers(
+      const ContentContext& renderer,
+      const Entity& entity,
+      RenderPass& pass) const override;
+
  private:
   // |Geometry|
   GeometryResult GetPositionBuffer(const ContentContext& renderer,
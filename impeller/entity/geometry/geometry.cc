@@ -218,4 +218,11 @@ bool Geometry::IsAxisAlignedRect() const {
   return false;
 }
 
+std::optional<StencilCoverGeometryResult> Geometry::GetStencilCoverBuffers(
+    const ContentContext& renderer,
+    const Entity& entity,
+    RenderPass& pass) const {
+  return std::nullopt;
+}
+
 }  // namespace impeller
@@ -24,6 +24,16 @@ struct GeometryResult {
   bool prevent_overdraw;
 };
 
+/// The vertices for drawing a geometry by stencil-then-cover.
+struct StencilCoverGeometryResult {
+  /// Triangles whose coverage is counted in the stencil buffer.
+  VertexBuffer stencil_vertex_buffer;
+  /// A triangle strip covering every pixel the stencil triangles may touch.
+  VertexBuffer cover_vertex_buffer;
+  Matrix transform;
+  FillType fill_type;
+};
+
 static const GeometryResult kEmptyResult = {
     .vertex_buffer =
         {
@@ -121,6 +131,16 @@ class Geometry {
 
   virtual bool IsAxisAlignedRect() const;
 
+  /// @brief    Get the vertices for drawing this geometry by
+  ///           stencil-then-cover instead of from the position buffer.
+  ///
+  /// @returns  The vertices, or `std::nullopt` if the geometry should be
+  ///           drawn from its position buffer, which is the default.
+  virtual std::optional<StencilCoverGeometryResult> GetStencilCoverBuffers(
+      const ContentContext& renderer,
+      const Entity& entity,
+      RenderPass& pass) const;
+
  protected:
   static GeometryResult ComputePositionGeometry(
       const Tessellator::VertexGenerator& generator,
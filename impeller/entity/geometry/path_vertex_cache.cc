@@ -0,0 +1,118 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/entity/geometry/path_vertex_cache.h"
+
+#include <cmath>
+
+#include "flutter/fml/hash_combine.h"
+#include "flutter/fml/logging.h"
+
+namespace impeller {
+
+Scalar PathVertexCache::QuantizeScale(Scalar scale) {
+  if (!(scale > 0.0f) || !std::isfinite(scale)) {
+    return scale;
+  }
+  return std::exp2(std::ceil(std::log2(scale) * 4.0f) / 4.0f);
+}
+
+PathVertexCache::PathVertexCache(size_t max_entries, size_t max_bytes)
+    : max_entries_(max_entries), max_bytes_(max_bytes) {
+  FML_DCHECK(max_entries_ > 0u);
+}
+
+PathVertexCache::~PathVertexCache() = default;
+
+PathVertexCache::Lookup PathVertexCache::Find(const Path& path,
+                                              const Parameters& parameters) {
+  Lookup lookup;
+  lookup.hash = fml::HashCombine(
+      path.GetHash(), parameters.scale, parameters.is_stroke,
+      parameters.stroke_width, parameters.miter_limit, parameters.stroke_cap,
+      parameters.stroke_join);
+
+  if (auto found = entries_.find(lookup.hash); found != entries_.end()) {
+    auto entry = found->second;
+    if (entry->parameters == parameters && entry->path.IsEqual(path)) {
+      lru_.splice(lru_.begin(), lru_, entry);
+      lookup.vertex_buffer = entry->vertex_buffer;
+      lookup.type = entry->type;
+      return lookup;
+    }
+    // A hash collision with a different path. Let the newer one replace it.
+    lookup.should_store = true;
+    return lookup;
+  }
+
+  if (seen_.count(lookup.hash) > 0u) {
+    lookup.should_store = true;
+    return lookup;
+  }
+  if (seen_order_.size() >= max_entries_ * 2u) {
+    seen_.erase(seen_order_.front());
+    seen_order_.pop_front();
+  }
+  seen_order_.push_back(lookup.hash);
+  seen_.insert(lookup.hash);
+  return lookup;
+}
+
+void PathVertexCache::Store(const Lookup& lookup,
+                            const Path& path,
+                            const Parameters& parameters,
+                            const VertexBuffer& vertex_buffer,
+                            PrimitiveType type) {
+  if (!lookup.should_store || !vertex_buffer) {
+    return;
+  }
+  size_t bytes = vertex_buffer.vertex_buffer.range.length +
+                 vertex_buffer.index_buffer.range.length;
+  if (bytes > max_bytes_ / 4u) {
+    return;
+  }
+
+  if (auto found = entries_.find(lookup.hash); found != entries_.end()) {
+    Evict(found->second);
+  }
+  while (!lru_.empty() && (entries_.size() >= max_entries_ ||
+                           byte_count_ + bytes > max_bytes_)) {
+    Evict(std::prev(lru_.end()));
+  }
+
+  lru_.push_front(Entry{
+      .hash = lookup.hash,
+      .path = path.Clone(),
+      .parameters = parameters,
+      .vertex_buffer = vertex_buffer,
+      .type = type,
+      .bytes = bytes,
+  });
+  entries_[lookup.hash] = lru_.begin();
+  byte_count_ += bytes;
+}
+
+void PathVertexCache::Evict(std::list<Entry>::iterator entry) {
+  byte_count_ -= entry->bytes;
+  entries_.erase(entry->hash);
+  lru_.erase(entry);
+}
+
+void PathVertexCache::Clear() {
+  lru_.clear();
+  entries_.clear();
+  seen_order_.clear();
+  seen_.clear();
+  byte_count_ = 0u;
+}
+
+size_t PathVertexCache::GetEntryCount() const {
+  return entries_.size();
+}
+
+size_t PathVertexCache::GetByteCount() const {
+  return byte_count_;
+}
+
+}  // namespace impeller
@@ -0,0 +1,144 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_IMPELLER_ENTITY_GEOMETRY_PATH_VERTEX_CACHE_H_
+#define FLUTTER_IMPELLER_ENTITY_GEOMETRY_PATH_VERTEX_CACHE_H_
+
+#include <deque>
+#include <list>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "impeller/core/formats.h"
+#include "impeller/core/vertex_buffer.h"
+#include "impeller/geometry/path.h"
+#include "impeller/geometry/scalar.h"
+
+namespace impeller {
+
+//------------------------------------------------------------------------------
+/// @brief      A least recently used cache of tessellated path vertices that
+///             lives across frames.
+///
+///             Entries are keyed by the contents of the path together with
+///             the parameters that affect its tessellation. Cached vertices
+///             are stored in device buffers owned by the cache, so a hit
+///             costs neither tessellation nor an upload to the transients
+///             buffer.
+///
+///             Since uploading to a device buffer is more expensive than
+///             writing to the transients buffer, a path is only admitted
+///             once it has been seen twice. Paths that change every frame
+///             never allocate device buffers.
+///
+class PathVertexCache {
+ public:
+  static constexpr size_t kDefaultMaxEntries = 256u;
+  static constexpr size_t kDefaultMaxBytes = 4u * 1024u * 1024u;
+
+  //----------------------------------------------------------------------------
+  /// @brief      The parameters, other than the path, that determine the
+  ///             vertices produced by tessellation.
+  ///
+  struct Parameters {
+    /// The tessellation scale, quantized with `QuantizeScale`.
+    Scalar scale = 1.0f;
+    bool is_stroke = false;
+    Scalar stroke_width = 0.0f;
+    Scalar miter_limit = 0.0f;
+    Cap stroke_cap = Cap::kButt;
+    Join stroke_join = Join::kMiter;
+
+    constexpr bool operator==(const Parameters& other) const {
+      return scale == other.scale && is_stroke == other.is_stroke &&
+             stroke_width == other.stroke_width &&
+             miter_limit == other.miter_limit &&
+             stroke_cap == other.stroke_cap &&
+             stroke_join == other.stroke_join;
+    }
+  };
+
+  struct Lookup {
+    size_t hash = 0u;
+    /// Set if the vertices were found in the cache.
+    std::optional<VertexBuffer> vertex_buffer;
+    PrimitiveType type = PrimitiveType::kTriangle;
+    /// Whether the vertices should be created in device buffers and handed
+    /// to `Store` because they were not found but have been seen before.
+    bool should_store = false;
+  };
+
+  //----------------------------------------------------------------------------
+  /// @brief      Round a tessellation scale up to the nearest quarter power of
+  ///             two so that paths drawn under slightly different transforms
+  ///             share cache entries. Tessellating at the rounded up scale
+  ///             never produces fewer subdivisions than requested.
+  ///
+  static Scalar QuantizeScale(Scalar scale);
+
+  explicit PathVertexCache(size_t max_entries = kDefaultMaxEntries,
+                           size_t max_bytes = kDefaultMaxBytes);
+
+  ~PathVertexCache();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Look up the vertices of the path tessellated with the given
+  ///             parameters, and record that the path was seen.
+  ///
+  Lookup Find(const Path& path, const Parameters& parameters);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Store vertices created in device buffers after a `Find` that
+  ///             requested it. The least recently used entries are evicted
+  ///             to stay within the entry and byte budgets. Vertices larger
+  ///             than a quarter of the byte budget are not stored.
+  ///
+  void Store(const Lookup& lookup,
+             const Path& path,
+             const Parameters& parameters,
+             const VertexBuffer& vertex_buffer,
+             PrimitiveType type);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Drop all cached vertices.
+  ///
+  void Clear();
+
+  // visible for testing.
+  size_t GetEntryCount() const;
+
+  // visible for testing.
+  size_t GetByteCount() const;
+
+ private:
+  struct Entry {
+    size_t hash;
+    Path path;
+    Parameters parameters;
+    VertexBuffer vertex_buffer;
+    PrimitiveType type;
+    size_t bytes;
+  };
+
+  const size_t max_entries_;
+  const size_t max_bytes_;
+  size_t byte_count_ = 0u;
+  // Most recently used first.
+  std::list<Entry> lru_;
+  std::unordered_map<size_t, std::list<Entry>::iterator> entries_;
+  // Hashes of the paths seen recently but not yet admitted, oldest first.
+  std::deque<size_t> seen_order_;
+  std::unordered_set<size_t> seen_;
+
+  void Evict(std::list<Entry>::iterator entry);
+
+  PathVertexCache(const PathVertexCache&) = delete;
+
+  PathVertexCache& operator=(const PathVertexCache&) = delete;
+};
+
+}  // namespace impeller
+
+#endif  // FLUTTER_IMPELLER_ENTITY_GEOMETRY_PATH_VERTEX_CACHE_H_
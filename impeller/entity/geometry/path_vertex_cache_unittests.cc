@@ -0,0 +1,107 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <cmath>
+#include <vector>
+
+#include "impeller/entity/entity_playground.h"
+#include "impeller/entity/geometry/path_vertex_cache.h"
+#include "impeller/geometry/path_builder.h"
+#include "impeller/playground/playground_test.h"
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace impeller {
+namespace testing {
+
+using EntityTest = EntityPlayground;
+
+static VertexBuffer CreateDeviceVertexBuffer(Allocator& allocator,
+                                             size_t point_count) {
+  std::vector<Point> points(point_count);
+  VertexBuffer vertex_buffer;
+  vertex_buffer.vertex_buffer =
+      allocator
+          .CreateBufferWithCopy(reinterpret_cast<const uint8_t*>(points.data()),
+                                points.size() * sizeof(Point))
+          ->AsBufferView();
+  vertex_buffer.vertex_count = point_count;
+  vertex_buffer.index_type = IndexType::kNone;
+  return vertex_buffer;
+}
+
+TEST_P(EntityTest, PathVertexCacheAdmitsPathsSeenTwice) {
+  auto& allocator = *GetContext()->GetResourceAllocator();
+  PathVertexCache cache;
+  auto path = PathBuilder{}.AddCircle({100, 100}, 50).TakePath();
+  PathVertexCache::Parameters parameters;
+  parameters.scale = PathVertexCache::QuantizeScale(1.0f);
+
+  auto first = cache.Find(path, parameters);
+  EXPECT_FALSE(first.vertex_buffer.has_value());
+  EXPECT_FALSE(first.should_store);
+
+  auto second = cache.Find(path, parameters);
+  EXPECT_FALSE(second.vertex_buffer.has_value());
+  ASSERT_TRUE(second.should_store);
+  cache.Store(second, path, parameters, CreateDeviceVertexBuffer(allocator, 8),
+              PrimitiveType::kTriangleStrip);
+  EXPECT_EQ(cache.GetEntryCount(), 1u);
+  EXPECT_EQ(cache.GetByteCount(), 8u * sizeof(Point));
+
+  auto third = cache.Find(path.Clone(), parameters);
+  ASSERT_TRUE(third.vertex_buffer.has_value());
+  EXPECT_EQ(third.vertex_buffer->vertex_count, 8u);
+  EXPECT_EQ(third.type, PrimitiveType::kTriangleStrip);
+
+  // Different tessellation parameters are a different entry.
+  PathVertexCache::Parameters stroke = parameters;
+  stroke.is_stroke = true;
+  stroke.stroke_width = 4.0f;
+  EXPECT_FALSE(cache.Find(path, stroke).vertex_buffer.has_value());
+
+  cache.Clear();
+  EXPECT_EQ(cache.GetEntryCount(), 0u);
+  EXPECT_EQ(cache.GetByteCount(), 0u);
+}
+
+TEST_P(EntityTest, PathVertexCacheEvictsLeastRecentlyUsed) {
+  auto& allocator = *GetContext()->GetResourceAllocator();
+  PathVertexCache cache(/*max_entries=*/2u);
+  PathVertexCache::Parameters parameters;
+
+  std::vector<Path> paths;
+  for (auto i = 0; i < 3; i++) {
+    paths.push_back(PathBuilder{}.AddCircle({100, 100}, 10 + i).TakePath());
+  }
+  auto store = [&](const Path& path) {
+    cache.Find(path, parameters);
+    auto lookup = cache.Find(path, parameters);
+    cache.Store(lookup, path, parameters,
+                CreateDeviceVertexBuffer(allocator, 4),
+                PrimitiveType::kTriangle);
+  };
+
+  store(paths[0]);
+  store(paths[1]);
+  // Touch the first path so that the second becomes the least recently used.
+  EXPECT_TRUE(cache.Find(paths[0], parameters).vertex_buffer.has_value());
+  store(paths[2]);
+
+  EXPECT_EQ(cache.GetEntryCount(), 2u);
+  EXPECT_TRUE(cache.Find(paths[0], parameters).vertex_buffer.has_value());
+  EXPECT_FALSE(cache.Find(paths[1], parameters).vertex_buffer.has_value());
+  EXPECT_TRUE(cache.Find(paths[2], parameters).vertex_buffer.has_value());
+}
+
+TEST(PathVertexCacheTest, QuantizeScaleRoundsUpToQuarterPowersOfTwo) {
+  EXPECT_FLOAT_EQ(PathVertexCache::QuantizeScale(1.0f), 1.0f);
+  EXPECT_FLOAT_EQ(PathVertexCache::QuantizeScale(2.0f), 2.0f);
+  EXPECT_FLOAT_EQ(PathVertexCache::QuantizeScale(1.1f), std::exp2(0.25f));
+  EXPECT_FLOAT_EQ(PathVertexCache::QuantizeScale(0.9f), 1.0f);
+  EXPECT_GE(PathVertexCache::QuantizeScale(3.0f), 3.0f);
+  EXPECT_EQ(PathVertexCache::QuantizeScale(0.0f), 0.0f);
+}
+
+}  // namespace testing
+}  // namespace impeller
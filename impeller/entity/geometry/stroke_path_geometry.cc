@@ -4,6 +4,7 @@
 
 #include "impeller/entity/geometry/stroke_path_geometry.h"
 
+#include "impeller/entity/geometry/path_vertex_cache.h"
 #include "impeller/geometry/path_builder.h"
 
 namespace impeller {
@@ -451,17 +452,54 @@ GeometryResult StrokePathGeometry::GetPositionBuffer(
   Scalar min_size = 1.0f / sqrt(std::abs(determinant));
   Scalar stroke_width = std::max(stroke_width_, min_size);
 
-  auto& host_buffer = pass.GetTransientsBuffer();
-  auto vertex_builder = CreateSolidStrokeVertices(
-      path_, stroke_width, miter_limit_ * stroke_width_ * 0.5,
-      GetJoinProc(stroke_join_), GetCapProc(stroke_cap_),
+  auto transform = Matrix::MakeOrthographic(pass.GetRenderTargetSize()) *
+                   entity.GetTransform();
+
+  PathVertexCache::Parameters parameters;
+  parameters.scale = PathVertexCache::QuantizeScale(
       entity.GetTransform().GetMaxBasisLength());
+  parameters.is_stroke = true;
+  parameters.stroke_width = stroke_width;
+  parameters.miter_limit = miter_limit_ * stroke_width_ * 0.5;
+  parameters.stroke_cap = stroke_cap_;
+  parameters.stroke_join = stroke_join_;
+  auto& cache = *renderer.GetPathVertexCache();
+  auto lookup = cache.Find(path_, parameters);
+  if (lookup.vertex_buffer.has_value()) {
+    return GeometryResult{
+        .type = PrimitiveType::kTriangleStrip,
+        .vertex_buffer = lookup.vertex_buffer.value(),
+        .transform = transform,
+        .prevent_overdraw = true,
+    };
+  }
+
+  auto vertex_builder = CreateSolidStrokeVertices(
+      path_, stroke_width, parameters.miter_limit, GetJoinProc(stroke_join_),
+      GetCapProc(stroke_cap_), parameters.scale);
+
+  // Paths that have been seen before are placed in device buffers owned by
+  // the cache instead of the per-frame transients buffer.
+  if (lookup.should_store) {
+    auto vertex_buffer = vertex_builder.CreateVertexBuffer(
+        *renderer.GetContext()->GetResourceAllocator());
+    if (vertex_buffer) {
+      cache.Store(lookup, path_, parameters, vertex_buffer,
+                  PrimitiveType::kTriangleStrip);
+      return GeometryResult{
+          .type = PrimitiveType::kTriangleStrip,
+          .vertex_buffer = vertex_buffer,
+          .transform = transform,
+          .prevent_overdraw = true,
+      };
+    }
+  }
 
   return GeometryResult{
       .type = PrimitiveType::kTriangleStrip,
-      .vertex_buffer = vertex_builder.CreateVertexBuffer(host_buffer),
-      .transform = Matrix::MakeOrthographic(pass.GetRenderTargetSize()) *
-                   entity.GetTransform(),
+      .vertex_buffer =
+          vertex_builder.CreateVertexBuffer(pass.GetTransientsBuffer()),
+      .transform = transform,
       .prevent_overdraw = true,
   };
 }
@@ -3,12 +3,31 @@
 // found in the LICENSE file.
 
 #include "impeller/entity/render_target_cache.h"
+
+#include <algorithm>
+
+#include "flutter/fml/trace_event.h"
 #include "impeller/renderer/render_target.h"
 
 namespace impeller {
 
-RenderTargetCache::RenderTargetCache(std::shared_ptr<Allocator> allocator)
-    : RenderTargetAllocator(std::move(allocator)) {}
+static size_t GetTextureByteSize(const TextureDescriptor& desc) {
+  size_t byte_size = 0u;
+  auto mip_desc = desc;
+  for (size_t mip = 0u; mip < std::max<size_t>(desc.mip_count, 1u); mip++) {
+    byte_size += mip_desc.GetByteSizeOfBaseMipLevel();
+    mip_desc.size = ISize(std::max<int64_t>(mip_desc.size.width / 2, 1),
+                          std::max<int64_t>(mip_desc.size.height / 2, 1));
+  }
+  return byte_size * static_cast<size_t>(desc.sample_count);
+}
+
+RenderTargetCache::RenderTargetCache(std::shared_ptr<Allocator> allocator,
+                                     uint32_t keep_alive_frame_count,
+                                     size_t max_cached_bytes)
+    : RenderTargetAllocator(std::move(allocator)),
+      keep_alive_frame_count_(keep_alive_frame_count),
+      max_cached_bytes_(max_cached_bytes) {}
 
 void RenderTargetCache::Start() {
   for (auto& td : texture_data_) {
@@ -19,12 +38,41 @@ void RenderTargetCache::Start() {
 void RenderTargetCache::End() {
   std::vector<TextureData> retain;
 
-  for (const auto& td : texture_data_) {
+  for (auto& td : texture_data_) {
     if (td.used_this_frame) {
-      retain.push_back(td);
+      td.unused_frame_count = 0u;
+    } else if (++td.unused_frame_count > keep_alive_frame_count_) {
+      metrics_.cached_bytes -= td.byte_size;
+      continue;
+    }
+    retain.push_back(td);
+  }
+
+  if (metrics_.cached_bytes > max_cached_bytes_) {
+    // Discard the textures that have gone unused for the longest first.
+    // Textures used during the frame are likely to be needed in the next one
+    // and are never discarded.
+    std::stable_sort(retain.begin(), retain.end(),
+                     [](const TextureData& a, const TextureData& b) {
+                       return a.unused_frame_count > b.unused_frame_count;
+                     });
+    auto first_kept = retain.begin();
+    while (first_kept != retain.end() &&
+           metrics_.cached_bytes > max_cached_bytes_ &&
+           first_kept->unused_frame_count > 0u) {
+      metrics_.cached_bytes -= first_kept->byte_size;
+      metrics_.evictions++;
+      first_kept++;
     }
+    retain.erase(retain.begin(), first_kept);
   }
+
   texture_data_.swap(retain);
+  TraceMetrics();
+}
+
+const RenderTargetCache::Metrics& RenderTargetCache::GetMetrics() const {
+  return metrics_;
 }
 
 size_t RenderTargetCache::CachedTextureCount() const {
@@ -37,21 +85,46 @@ std::shared_ptr<Texture> RenderTargetCache::CreateTexture(
   FML_DCHECK(desc.usage &
              static_cast<TextureUsageMask>(TextureUsage::kRenderTarget));
 
+  // Prefer the texture used most recently so that the others can age out.
+  TextureData* match = nullptr;
   for (auto& td : texture_data_) {
-    const auto other_desc = td.texture->GetTextureDescriptor();
     FML_DCHECK(td.texture != nullptr);
-    if (!td.used_this_frame && desc == other_desc) {
-      td.used_this_frame = true;
-      return td.texture;
+    if (td.used_this_frame || desc != td.texture->GetTextureDescriptor()) {
+      continue;
+    }
+    if (!match || td.unused_frame_count < match->unused_frame_count) {
+      match = &td;
     }
   }
+  if (match) {
+    match->used_this_frame = true;
+    metrics_.hits++;
+    return match->texture;
+  }
+
+  metrics_.misses++;
   auto result = RenderTargetAllocator::CreateTexture(desc);
   if (result == nullptr) {
     return result;
   }
-  texture_data_.push_back(
-      TextureData{.used_this_frame = true, .texture = result});
+  const auto byte_size = GetTextureByteSize(desc);
+  metrics_.cached_bytes += byte_size;
+  texture_data_.push_back(TextureData{.used_this_frame = true,
+                                      .unused_frame_count = 0u,
+                                      .byte_size = byte_size,
+                                      .texture = result});
   return result;
 }
 
+void RenderTargetCache::TraceMetrics() const {
+  static constexpr int64_t kImpellerRenderTargetCacheTraceID = 1989;
+  FML_TRACE_COUNTER("impeller",                                          //
+                    "RenderTargetCache",                                 //
+                    kImpellerRenderTargetCacheTraceID,                   //
+                    "Hits", metrics_.hits,                               //
+                    "Misses", metrics_.misses,                           //
+                    "CachedBytes", metrics_.cached_bytes                 //
+  );
+}
+
 }  // namespace impeller
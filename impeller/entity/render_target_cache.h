@@ -5,17 +5,40 @@
 #ifndef FLUTTER_IMPELLER_ENTITY_RENDER_TARGET_CACHE_H_
 #define FLUTTER_IMPELLER_ENTITY_RENDER_TARGET_CACHE_H_
 
+#include <cstdint>
+#include <limits>
+
 #include "impeller/renderer/render_target.h"
 
 namespace impeller {
 
 /// @brief An implementation of the [RenderTargetAllocator] that caches all
-///        allocated texture data for one frame.
+///        allocated texture data across frames.
 ///
-///        Any textures unused after a frame are immediately discarded.
+///        Textures unused during a frame are kept for up to
+///        `keep_alive_frame_count` more frames so that passes that skip a
+///        frame (or alternate between sizes) don't reallocate them. Once the
+///        cache holds more than `max_cached_bytes`, the textures that have
+///        gone unused for the longest are discarded first. By default, any
+///        textures unused after a frame are immediately discarded.
 class RenderTargetCache : public RenderTargetAllocator {
  public:
-  explicit RenderTargetCache(std::shared_ptr<Allocator> allocator);
+  static constexpr size_t kUnlimitedBytes = std::numeric_limits<size_t>::max();
+
+  struct Metrics {
+    /// The number of textures returned from the cache.
+    size_t hits = 0u;
+    /// The number of textures that had to be allocated.
+    size_t misses = 0u;
+    /// The number of textures discarded because the byte budget was exceeded.
+    size_t evictions = 0u;
+    /// The size of all textures currently held by the cache.
+    size_t cached_bytes = 0u;
+  };
+
+  explicit RenderTargetCache(std::shared_ptr<Allocator> allocator,
+                             uint32_t keep_alive_frame_count = 0u,
+                             size_t max_cached_bytes = kUnlimitedBytes);
 
   ~RenderTargetCache() = default;
 
@@ -29,16 +52,26 @@ class RenderTargetCache : public RenderTargetAllocator {
   std::shared_ptr<Texture> CreateTexture(
       const TextureDescriptor& desc) override;
 
+  const Metrics& GetMetrics() const;
+
   // visible for testing.
   size_t CachedTextureCount() const;
 
  private:
   struct TextureData {
     bool used_this_frame;
+    // The number of frames that ended without the texture being used.
+    uint32_t unused_frame_count;
+    size_t byte_size;
     std::shared_ptr<Texture> texture;
   };
 
+  const uint32_t keep_alive_frame_count_;
+  const size_t max_cached_bytes_;
   std::vector<TextureData> texture_data_;
+  Metrics metrics_;
+
+  void TraceMetrics() const;
 
   RenderTargetCache(const RenderTargetCache&) = delete;
 
@@ -85,5 +85,75 @@ TEST(RenderTargetCacheTest, DoesNotPersistFailedAllocations) {
   ASSERT_EQ(render_target_cache.CachedTextureCount(), 0u);
 }
 
+TEST(RenderTargetCacheTest, KeepsUnusedTexturesForKeepAliveFrames) {
+  auto allocator = std::make_shared<TestAllocator>();
+  auto render_target_cache =
+      RenderTargetCache(allocator, /*keep_alive_frame_count=*/2u);
+  auto desc = TextureDescriptor{
+      .format = PixelFormat::kR8G8B8A8UNormInt,
+      .size = ISize(100, 100),
+      .usage = static_cast<TextureUsageMask>(TextureUsage::kRenderTarget)};
+
+  render_target_cache.Start();
+  auto texture = render_target_cache.CreateTexture(desc);
+  render_target_cache.End();
+
+  // Unused for two frames, the texture is still cached.
+  for (auto i = 0; i < 2; i++) {
+    render_target_cache.Start();
+    render_target_cache.End();
+    ASSERT_EQ(render_target_cache.CachedTextureCount(), 1u);
+  }
+
+  render_target_cache.Start();
+  ASSERT_EQ(render_target_cache.CreateTexture(desc), texture);
+  render_target_cache.End();
+
+  for (auto i = 0; i < 3; i++) {
+    render_target_cache.Start();
+    render_target_cache.End();
+  }
+  ASSERT_EQ(render_target_cache.CachedTextureCount(), 0u);
+
+  const auto& metrics = render_target_cache.GetMetrics();
+  EXPECT_EQ(metrics.hits, 1u);
+  EXPECT_EQ(metrics.misses, 1u);
+  EXPECT_EQ(metrics.cached_bytes, 0u);
+}
+
+TEST(RenderTargetCacheTest, EvictsLeastRecentlyUsedTexturesOverBudget) {
+  auto allocator = std::make_shared<TestAllocator>();
+  auto small_desc = TextureDescriptor{
+      .format = PixelFormat::kR8G8B8A8UNormInt,
+      .size = ISize(100, 100),
+      .usage = static_cast<TextureUsageMask>(TextureUsage::kRenderTarget)};
+  auto large_desc = small_desc;
+  large_desc.size = ISize(200, 200);
+  const auto small_bytes = small_desc.GetByteSizeOfBaseMipLevel();
+  const auto large_bytes = large_desc.GetByteSizeOfBaseMipLevel();
+  auto render_target_cache =
+      RenderTargetCache(allocator, /*keep_alive_frame_count=*/10u,
+                        /*max_cached_bytes=*/large_bytes);
+
+  // The small texture is unused for one more frame than the large one.
+  render_target_cache.Start();
+  render_target_cache.CreateTexture(small_desc);
+  render_target_cache.End();
+  render_target_cache.Start();
+  auto large = render_target_cache.CreateTexture(large_desc);
+  ASSERT_EQ(render_target_cache.GetMetrics().cached_bytes,
+            small_bytes + large_bytes);
+
+  // Textures used this frame are never evicted.
+  render_target_cache.End();
+  ASSERT_EQ(render_target_cache.CachedTextureCount(), 1u);
+  ASSERT_EQ(render_target_cache.GetMetrics().evictions, 1u);
+  ASSERT_EQ(render_target_cache.GetMetrics().cached_bytes, large_bytes);
+
+  render_target_cache.Start();
+  ASSERT_EQ(render_target_cache.CreateTexture(large_desc), large);
+  render_target_cache.End();
+}
+
 }  // namespace testing
 }  // namespace impeller
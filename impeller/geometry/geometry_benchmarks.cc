@@ -4,6 +4,8 @@
 
 #include "flutter/benchmarking/benchmarking.h"
 
+#include <cmath>
+
 #include "impeller/geometry/path.h"
 #include "impeller/geometry/path_builder.h"
 #include "impeller/tessellator/tessellator.h"
@@ -18,6 +20,11 @@ Path CreateCubic();
 Path CreateQuadratic();
 /// Create a rounded rect.
 Path CreateRRect();
+/// A single simple, concave contour made of cubics, like a typical icon.
+Path CreateHeart();
+/// An area chart with the given number of data points, which changes every
+/// frame in animated charts.
+Path CreateChart(size_t point_count);
 }  // namespace
 
 static Tessellator tess;
@@ -82,11 +89,63 @@ static void BM_Convex(benchmark::State& state, Args&&... args) {
   state.counters["TotalPointCount"] = point_count;
 }
 
+template <class... Args>
+static void BM_Tessellate(benchmark::State& state, Args&&... args) {
+  auto args_tuple = std::make_tuple(std::move(args)...);
+  auto path = std::get<Path>(args_tuple).Clone();
+  bool simple_polygon_fast_path = std::get<bool>(args_tuple);
+
+  Tessellator tessellator;
+  tessellator.SetSimplePolygonFastPathEnabled(simple_polygon_fast_path);
+  size_t single_index_count = 0u;
+  while (state.KeepRunning()) {
+    tessellator.Tessellate(
+        path, 1.0f,
+        [&single_index_count](const float* vertices, size_t vertices_count,
+                              const uint16_t* indices, size_t indices_count) {
+          single_index_count = indices_count;
+          return true;
+        });
+  }
+  state.counters["SingleIndexCount"] = single_index_count;
+}
+
+// The CPU side of stencil-then-cover filling, to compare against
+// |BM_Tessellate|. The GPU then fills the fan triangles, which overlap, and
+// covers the path bounds.
+template <class... Args>
+static void BM_StencilFan(benchmark::State& state, Args&&... args) {
+  auto args_tuple = std::make_tuple(std::move(args)...);
+  auto path = std::get<Path>(args_tuple).Clone();
+
+  Tessellator tessellator;
+  size_t single_point_count = 0u;
+  while (state.KeepRunning()) {
+    auto points = tessellator.TessellateStencilFan(path, 1.0f);
+    single_point_count = points.size();
+  }
+  state.counters["SinglePointCount"] = single_point_count;
+}
+
 BENCHMARK_CAPTURE(BM_Polyline, cubic_polyline, CreateCubic(), false);
 BENCHMARK_CAPTURE(BM_Polyline, cubic_polyline_tess, CreateCubic(), true);
 BENCHMARK_CAPTURE(BM_Polyline, quad_polyline, CreateQuadratic(), false);
 BENCHMARK_CAPTURE(BM_Polyline, quad_polyline_tess, CreateQuadratic(), true);
 BENCHMARK_CAPTURE(BM_Convex, rrect_convex, CreateRRect(), true);
+BENCHMARK_CAPTURE(BM_Tessellate, rrect_ear_clipping, CreateRRect(), true);
+BENCHMARK_CAPTURE(BM_Tessellate, rrect_libtess, CreateRRect(), false);
+BENCHMARK_CAPTURE(BM_Tessellate, heart_ear_clipping, CreateHeart(), true);
+BENCHMARK_CAPTURE(BM_Tessellate, heart_libtess, CreateHeart(), false);
+BENCHMARK_CAPTURE(BM_Tessellate, cubic_tess, CreateCubic(), true);
+
+BENCHMARK_CAPTURE(BM_StencilFan, heart_stencil_fan, CreateHeart());
+BENCHMARK_CAPTURE(BM_StencilFan, cubic_stencil_fan, CreateCubic());
+BENCHMARK_CAPTURE(BM_Tessellate, chart_100_tess, CreateChart(100), true);
+BENCHMARK_CAPTURE(BM_StencilFan, chart_100_stencil_fan, CreateChart(100));
+BENCHMARK_CAPTURE(BM_Tessellate, chart_1000_tess, CreateChart(1000), true);
+BENCHMARK_CAPTURE(BM_StencilFan, chart_1000_stencil_fan, CreateChart(1000));
+BENCHMARK_CAPTURE(BM_Tessellate, chart_10000_tess, CreateChart(10000), true);
+BENCHMARK_CAPTURE(BM_StencilFan, chart_10000_stencil_fan, CreateChart(10000));
 
 namespace {
 
@@ -96,6 +155,31 @@ Path CreateRRect() {
       .TakePath();
 }
 
+Path CreateHeart() {
+  return PathBuilder{}
+      .MoveTo({50, 30})
+      .CubicCurveTo({50, 0}, {0, 0}, {0, 30})
+      .CubicCurveTo({0, 60}, {50, 80}, {50, 100})
+      .CubicCurveTo({50, 80}, {100, 60}, {100, 30})
+      .CubicCurveTo({100, 0}, {50, 0}, {50, 30})
+      .Close()
+      .TakePath();
+}
+
+Path CreateChart(size_t point_count) {
+  PathBuilder builder;
+  builder.MoveTo({0, 400});
+  for (auto i = 0u; i < point_count; i++) {
+    // A deterministic, jagged series.
+    auto x = 1000.0f * i / point_count;
+    auto y = 200.0f + 150.0f * std::sin(i * 0.37f) + 40.0f * std::sin(i * 5.1f);
+    builder.LineTo({x, y});
+  }
+  builder.LineTo({1000, 400});
+  builder.Close();
+  return builder.TakePath();
+}
+
 Path CreateCubic() {
   return PathBuilder{}
       .MoveTo({359.934, 96.6335})
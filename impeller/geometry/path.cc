@@ -7,6 +7,7 @@
 #include <optional>
 #include <variant>
 
+#include "flutter/fml/hash_combine.h"
 #include "flutter/fml/logging.h"
 #include "impeller/geometry/path_component.h"
 #include "impeller/geometry/point.h"
@@ -467,6 +468,39 @@ std::optional<std::pair<Point, Point>> Path::GetMinMaxCoveragePoints() const {
   return std::make_pair(min.value(), max.value());
 }
 
+size_t Path::GetHash() const {
+  size_t hash = fml::HashCombine(fill_, components_.size(), points_.size(),
+                                 contours_.size());
+  for (const auto& component : components_) {
+    fml::HashCombineSeed(hash, component.type, component.index);
+  }
+  for (const auto& point : points_) {
+    fml::HashCombineSeed(hash, point.x, point.y);
+  }
+  for (const auto& contour : contours_) {
+    fml::HashCombineSeed(hash, contour.destination.x, contour.destination.y,
+                         contour.is_closed);
+  }
+  return hash;
+}
+
+bool Path::IsEqual(const Path& other) const {
+  if (this == &other) {
+    return true;
+  }
+  if (fill_ != other.fill_ || components_.size() != other.components_.size() ||
+      points_ != other.points_ || contours_ != other.contours_) {
+    return false;
+  }
+  for (auto i = 0u; i < components_.size(); i++) {
+    if (components_[i].type != other.components_[i].type ||
+        components_[i].index != other.components_[i].index) {
+      return false;
+    }
+  }
+  return true;
+}
+
 void Path::SetBounds(Rect rect) {
   computed_bounds_ = rect;
 }
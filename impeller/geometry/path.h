@@ -181,6 +181,14 @@ class Path {
 
   std::optional<std::pair<Point, Point>> GetMinMaxCoveragePoints() const;
 
+  /// @brief  Compute a hash of the fill type, components and points of this
+  ///         path. Paths for which `IsEqual` returns true hash identically.
+  size_t GetHash() const;
+
+  /// @brief  Whether the other path has the same fill type, components and
+  ///         points, and so tessellates to the same geometry.
+  bool IsEqual(const Path& other) const;
+
  private:
   friend class PathBuilder;
 
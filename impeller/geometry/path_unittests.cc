@@ -485,5 +485,36 @@ TEST(PathTest, CanBeCloned) {
   }
 }
 
+TEST(PathTest, EqualPathsHaveEqualHashes) {
+  auto path_a = PathBuilder{}
+                    .MoveTo({10, 10})
+                    .LineTo({20, 20})
+                    .QuadraticCurveTo({30, 10}, {40, 20})
+                    .Close()
+                    .TakePath();
+  auto path_b = path_a.Clone();
+
+  EXPECT_TRUE(path_a.IsEqual(path_b));
+  EXPECT_EQ(path_a.GetHash(), path_b.GetHash());
+
+  auto moved = PathBuilder{}
+                   .MoveTo({10, 10})
+                   .LineTo({20, 21})
+                   .QuadraticCurveTo({30, 10}, {40, 20})
+                   .Close()
+                   .TakePath();
+  EXPECT_FALSE(path_a.IsEqual(moved));
+  EXPECT_NE(path_a.GetHash(), moved.GetHash());
+
+  auto even_odd = PathBuilder{}
+                      .MoveTo({10, 10})
+                      .LineTo({20, 20})
+                      .QuadraticCurveTo({30, 10}, {40, 20})
+                      .Close()
+                      .TakePath(FillType::kOdd);
+  EXPECT_FALSE(path_a.IsEqual(even_odd));
+  EXPECT_NE(path_a.GetHash(), even_odd.GetHash());
+}
+
 }  // namespace testing
 }  // namespace impeller
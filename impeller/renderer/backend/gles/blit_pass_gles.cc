@@ -81,13 +81,14 @@ bool BlitPassGLES::EncodeCommands(
   }
 
   std::shared_ptr<const BlitPassGLES> shared_this = shared_from_this();
-  return reactor_->AddOperation([transients_allocator,
-                                 blit_pass = std::move(shared_this),
-                                 label = label_](const auto& reactor) {
+  auto encode = [transients_allocator, blit_pass = std::move(shared_this),
+                 label = label_](const auto& reactor) {
     auto result = EncodeCommandsInReactor(transients_allocator, reactor,
                                           blit_pass->commands_, label);
     FML_CHECK(result) << "Must be able to encode GL commands without error.";
-  });
+  };
+  // The command buffer reacts once when it is submitted.
+  return reactor_->AddOperation(std::move(encode), /*defer=*/true);
 }
 
 // |BlitPass|
@@ -40,7 +40,7 @@ bool CommandBufferGLES::OnSubmitCommands(CompletionCallback callback) {
 
 // |CommandBuffer|
 void CommandBufferGLES::OnWaitUntilScheduled() {
-  reactor_->GetProcTable().Flush();
+  [[maybe_unused]] auto flushed = reactor_->Flush();
 }
 
 // |CommandBuffer|
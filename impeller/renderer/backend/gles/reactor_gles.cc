@@ -68,7 +68,7 @@ std::optional<GLuint> ReactorGLES::GetGLHandle(const HandleGLES& handle) const {
   return std::nullopt;
 }
 
-bool ReactorGLES::AddOperation(Operation operation) {
+bool ReactorGLES::AddOperation(Operation operation, bool defer) {
   if (!operation) {
     return false;
   }
@@ -76,6 +76,9 @@ bool ReactorGLES::AddOperation(Operation operation) {
     Lock ops_lock(ops_mutex_);
     ops_.emplace_back(std::move(operation));
   }
+  if (defer) {
+    return true;
+  }
   // Attempt a reaction if able but it is not an error if this isn't possible.
   [[maybe_unused]] auto result = React();
   return true;
@@ -170,6 +173,21 @@ bool ReactorGLES::React() {
   return true;
 }
 
+bool ReactorGLES::Flush() {
+  if (!CanReactOnCurrentThread()) {
+    return false;
+  }
+  {
+    Lock ops_lock(ops_mutex_);
+    if (unflushed_threads_.erase(std::this_thread::get_id()) == 0u) {
+      return false;
+    }
+  }
+  TRACE_EVENT0("impeller", "ReactorGLES::Flush");
+  GetProcTable().Flush();
+  return true;
+}
+
 static DebugResourceType ToDebugResourceType(HandleType type) {
   switch (type) {
     case HandleType::kUnknown:
@@ -251,6 +269,9 @@ bool ReactorGLES::FlushOps() {
   {
     Lock ops_lock(ops_mutex_);
     std::swap(ops_, ops);
+    if (!ops.empty()) {
+      unflushed_threads_.insert(std::this_thread::get_id());
+    }
   }
   for (const auto& op : ops) {
     TRACE_EVENT0("impeller", "ReactorGLES::Operation");
@@ -7,6 +7,8 @@
 
 #include <functional>
 #include <memory>
+#include <set>
+#include <thread>
 #include <vector>
 
 #include "flutter/fml/macros.h"
@@ -204,10 +206,14 @@ class ReactorGLES {
   ///             torn down.
   ///
   /// @param[in]  operation  The operation
+  /// @param[in]  defer      If true, the operation is only queued and runs
+  ///                        on the next reaction instead of attempting one
+  ///                        immediately. Used by passes whose command buffer
+  ///                        reacts once when submitted.
   ///
   /// @return     If the operation was successfully queued for completion.
   ///
-  [[nodiscard]] bool AddOperation(Operation operation);
+  [[nodiscard]] bool AddOperation(Operation operation, bool defer = false);
 
   //----------------------------------------------------------------------------
   /// @brief      Perform a reaction on the current thread if able.
@@ -219,6 +225,17 @@ class ReactorGLES {
   ///
   [[nodiscard]] bool React();
 
+  //----------------------------------------------------------------------------
+  /// @brief      Flush the commands issued by reactions on the current thread
+  ///             to the GPU if able.
+  ///
+  ///             Flushes are coalesced. If no operations were performed on the
+  ///             current thread since its last flush, this does nothing.
+  ///
+  /// @return     If a flush was issued.
+  ///
+  bool Flush();
+
  private:
   struct LiveHandle {
     std::optional<GLuint> name;
@@ -237,6 +254,9 @@ class ReactorGLES {
   Mutex ops_execution_mutex_;
   mutable Mutex ops_mutex_;
   std::vector<Operation> ops_ IPLR_GUARDED_BY(ops_mutex_);
+  // The threads that performed operations since they last flushed. OpenGL
+  // contexts are per-thread so each has its own command stream to flush.
+  std::set<std::thread::id> unflushed_threads_ IPLR_GUARDED_BY(ops_mutex_);
 
   // Make sure the container is one where erasing items during iteration doesn't
   // invalidate other iterators.
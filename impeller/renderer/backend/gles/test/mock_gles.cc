@@ -159,6 +159,13 @@ void mockDeleteQueriesEXT(GLsizei size, const GLuint* queries) {
 static_assert(CheckSameSignature<decltype(mockDeleteQueriesEXT),  //
                                  decltype(glDeleteQueriesEXT)>::value);
 
+void mockFlush() {
+  RecordGLCall("glFlush");
+}
+
+static_assert(CheckSameSignature<decltype(mockFlush),  //
+                                 decltype(glFlush)>::value);
+
 std::shared_ptr<MockGLES> MockGLES::Init(
     const std::optional<std::vector<const unsigned char*>>& extensions) {
   // If we cannot obtain a lock, MockGLES is already being used elsewhere.
@@ -195,6 +202,8 @@ const ProcTableGLES::Resolver kMockResolver = [](const char* name) {
     return reinterpret_cast<void*>(mockGetQueryObjectui64vEXT);
   } else if (strcmp(name, "glGetQueryObjectuivEXT") == 0) {
     return reinterpret_cast<void*>(mockGetQueryObjectuivEXT);
+  } else if (strcmp(name, "glFlush") == 0) {
+    return reinterpret_cast<void*>(&mockFlush);
   } else {
     return reinterpret_cast<void*>(&doNothing);
   }
@@ -202,6 +211,10 @@ const ProcTableGLES::Resolver kMockResolver = [](const char* name) {
 
 MockGLES::MockGLES() : proc_table_(kMockResolver) {}
 
+std::unique_ptr<ProcTableGLES> MockGLES::CreateProcTable() const {
+  return std::make_unique<ProcTableGLES>(kMockResolver);
+}
+
 MockGLES::~MockGLES() {
   g_test_lock.unlock();
 }
@@ -32,6 +32,11 @@ class MockGLES final {
   /// @brief      Returns a configured |ProcTableGLES| instance.
   const ProcTableGLES& GetProcTable() const { return proc_table_; }
 
+  /// @brief      Returns a new |ProcTableGLES| instance for objects that take
+  ///             ownership of one, such as |ReactorGLES|. Its calls are
+  ///             recorded on this instance as well.
+  std::unique_ptr<ProcTableGLES> CreateProcTable() const;
+
   /// @brief      Returns a vector of the names of all recorded calls.
   ///
   /// Calls are cleared after this method is called.
@@ -0,0 +1,80 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <thread>
+
+#include "flutter/testing/testing.h"  // IWYU pragma: keep
+#include "gtest/gtest.h"
+#include "impeller/renderer/backend/gles/reactor_gles.h"
+#include "impeller/renderer/backend/gles/test/mock_gles.h"
+
+namespace impeller {
+namespace testing {
+
+namespace {
+class TestWorker final : public ReactorGLES::Worker {
+ public:
+  // |ReactorGLES::Worker|
+  bool CanReactorReactOnCurrentThreadNow(
+      const ReactorGLES& reactor) const override {
+    return std::this_thread::get_id() == thread_;
+  }
+
+ private:
+  const std::thread::id thread_ = std::this_thread::get_id();
+};
+}  // namespace
+
+TEST(ReactorGLESTest, DeferredOperationsRunOnNextReaction) {
+  auto mock_gles = MockGLES::Init();
+  auto reactor = std::make_shared<ReactorGLES>(mock_gles->CreateProcTable());
+  auto worker = std::make_shared<TestWorker>();
+  reactor->AddWorker(worker);
+
+  auto count = 0;
+  auto operation = [&count](const ReactorGLES&) { count++; };
+  ASSERT_TRUE(reactor->AddOperation(operation, /*defer=*/true));
+  ASSERT_TRUE(reactor->AddOperation(operation, /*defer=*/true));
+  EXPECT_EQ(count, 0);
+
+  EXPECT_TRUE(reactor->React());
+  EXPECT_EQ(count, 2);
+
+  ASSERT_TRUE(reactor->AddOperation(operation));
+  EXPECT_EQ(count, 3);
+}
+
+TEST(ReactorGLESTest, FlushesAreCoalesced) {
+  auto mock_gles = MockGLES::Init();
+  auto reactor = std::make_shared<ReactorGLES>(mock_gles->CreateProcTable());
+  auto worker = std::make_shared<TestWorker>();
+  reactor->AddWorker(worker);
+
+  // Nothing has been done yet.
+  EXPECT_FALSE(reactor->Flush());
+
+  ASSERT_TRUE(reactor->AddOperation([](const ReactorGLES&) {}));
+  mock_gles->GetCapturedCalls();
+  EXPECT_TRUE(reactor->Flush());
+  EXPECT_FALSE(reactor->Flush());
+  EXPECT_EQ(mock_gles->GetCapturedCalls(), std::vector<std::string>{"glFlush"});
+
+  ASSERT_TRUE(reactor->AddOperation([](const ReactorGLES&) {}));
+  EXPECT_TRUE(reactor->Flush());
+}
+
+TEST(ReactorGLESTest, DoesNotFlushOnThreadsThatCannotReact) {
+  auto mock_gles = MockGLES::Init();
+  auto reactor = std::make_shared<ReactorGLES>(mock_gles->CreateProcTable());
+  auto worker = std::make_shared<TestWorker>();
+  reactor->AddWorker(worker);
+
+  ASSERT_TRUE(reactor->AddOperation([](const ReactorGLES&) {}));
+  std::thread thread([&]() { EXPECT_FALSE(reactor->Flush()); });
+  thread.join();
+  EXPECT_TRUE(reactor->Flush());
+}
+
+}  // namespace testing
+}  // namespace impeller
@@ -9,6 +9,7 @@
 #include "flutter/fml/memory/ref_ptr.h"
 #include "flutter/fml/trace_event.h"
 #include "impeller/core/formats.h"
+#include "impeller/core/platform.h"
 #include "impeller/renderer/backend/vulkan/device_buffer_vk.h"
 #include "impeller/renderer/backend/vulkan/formats_vk.h"
 #include "impeller/renderer/backend/vulkan/texture_vk.h"
@@ -16,6 +17,15 @@
 
 namespace impeller {
 
+// The size of the blocks small host visible buffers are sub-allocated from.
+static constexpr size_t kBufferSubAllocationBlockSize = 1024u * 1024u;
+
+// Larger buffers get allocations of their own.
+static constexpr size_t kMaxBufferSubAllocationSize = 128u * 1024u;
+
+// Blocks that have been unused for this many frames are released.
+static constexpr uint32_t kBufferSubAllocationBlockKeepAliveFrameCount = 3u;
+
 static constexpr vk::Flags<vk::MemoryPropertyFlagBits>
 ToVKBufferMemoryPropertyFlags(StorageMode mode) {
   switch (mode) {
@@ -148,6 +158,17 @@ AllocatorVK::AllocatorVK(std::weak_ptr<Context> context,
   supports_memoryless_textures_ =
       capabilities.SupportsDeviceTransientTextures();
   supports_framebuffer_fetch_ = capabilities.SupportsFramebufferFetch();
+  buffer_sub_allocator_ = BufferSubAllocator::Create(
+      [this](size_t block_size) -> std::shared_ptr<DeviceBuffer> {
+        return CreateBufferVMA(
+            DeviceBufferDescriptor{
+                .storage_mode = StorageMode::kHostVisible,
+                .size = block_size,
+            },
+            /*use_staging_buffer_pool=*/false);
+      },
+      kBufferSubAllocationBlockSize,
+      kBufferSubAllocationBlockKeepAliveFrameCount);
   is_valid_ = true;
 }
 
@@ -427,11 +448,41 @@ std::shared_ptr<Texture> AllocatorVK::OnCreateTexture(
 void AllocatorVK::DidAcquireSurfaceFrame() {
   frame_count_++;
   raster_thread_id_ = std::this_thread::get_id();
+  if (buffer_sub_allocator_) {
+    buffer_sub_allocator_->DidAcquireFrame();
+    auto stats = buffer_sub_allocator_->GetStats();
+    auto utilization = static_cast<int64_t>(stats.GetUtilization() * 100);
+    auto fragmentation = static_cast<int64_t>(stats.GetFragmentation() * 100);
+    static constexpr int64_t kImpellerBufferSubAllocatorTraceID = 1990;
+    FML_TRACE_COUNTER("impeller",                               //
+                      "BufferSubAllocator",                     //
+                      kImpellerBufferSubAllocatorTraceID,       //
+                      "ReservedBytes", stats.reserved_bytes,    //
+                      "AllocatedBytes", stats.allocated_bytes,  //
+                      "UtilizationPercent", utilization,        //
+                      "FragmentationPercent", fragmentation     //
+    );
+  }
 }
 
 // |Allocator|
 std::shared_ptr<DeviceBuffer> AllocatorVK::OnCreateBuffer(
     const DeviceBufferDescriptor& desc) {
+  if (buffer_sub_allocator_ &&
+      desc.storage_mode == StorageMode::kHostVisible &&
+      desc.size <= kMaxBufferSubAllocationSize) {
+    if (auto allocation = buffer_sub_allocator_->Allocate(
+            desc.size, DefaultUniformAlignment())) {
+      return std::make_shared<DeviceBufferVK>(desc, context_,
+                                              std::move(allocation));
+    }
+  }
+  return CreateBufferVMA(desc, /*use_staging_buffer_pool=*/true);
+}
+
+std::shared_ptr<DeviceBufferVK> AllocatorVK::CreateBufferVMA(
+    const DeviceBufferDescriptor& desc,
+    bool use_staging_buffer_pool) {
   vk::BufferCreateInfo buffer_info;
   buffer_info.usage = vk::BufferUsageFlagBits::eVertexBuffer |
                       vk::BufferUsageFlagBits::eIndexBuffer |
@@ -449,7 +500,8 @@ std::shared_ptr<DeviceBuffer> AllocatorVK::OnCreateBuffer(
   allocation_info.preferredFlags = static_cast<VkMemoryPropertyFlags>(
       ToVKBufferMemoryPropertyFlags(desc.storage_mode));
   allocation_info.flags = ToVmaAllocationBufferCreateFlags(desc.storage_mode);
-  if (created_buffer_pool_ && desc.storage_mode == StorageMode::kHostVisible &&
+  if (use_staging_buffer_pool && created_buffer_pool_ &&
+      desc.storage_mode == StorageMode::kHostVisible &&
       raster_thread_id_ == std::this_thread::get_id()) {
     allocation_info.pool = staging_buffer_pool_.get().pool;
   }
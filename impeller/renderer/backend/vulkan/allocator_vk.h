@@ -8,6 +8,7 @@
 #include "flutter/fml/macros.h"
 #include "flutter/fml/memory/ref_ptr.h"
 #include "impeller/core/allocator.h"
+#include "impeller/core/buffer_sub_allocator.h"
 #include "impeller/renderer/backend/vulkan/context_vk.h"
 #include "impeller/renderer/backend/vulkan/device_buffer_vk.h"
 #include "impeller/renderer/backend/vulkan/device_holder.h"
@@ -29,6 +30,9 @@ class AllocatorVK final : public Allocator {
 
   UniqueAllocatorVMA allocator_;
   UniquePoolVMA staging_buffer_pool_;
+  // Small host visible buffers are ranges of larger blocks. Declared after the
+  // VMA allocator so that the blocks it holds are released first.
+  std::shared_ptr<BufferSubAllocator> buffer_sub_allocator_;
   std::weak_ptr<Context> context_;
   std::weak_ptr<DeviceHolder> device_holder_;
   ISize max_texture_size_;
@@ -57,6 +61,10 @@ class AllocatorVK final : public Allocator {
   std::shared_ptr<DeviceBuffer> OnCreateBuffer(
       const DeviceBufferDescriptor& desc) override;
 
+  std::shared_ptr<DeviceBufferVK> CreateBufferVMA(
+      const DeviceBufferDescriptor& desc,
+      bool use_staging_buffer_pool);
+
   // |Allocator|
   std::shared_ptr<Texture> OnCreateTexture(
       const TextureDescriptor& desc) override;
@@ -76,7 +76,8 @@ static bool BindBuffers(const Bindings& bindings,
       return false;
     }
 
-    auto buffer = DeviceBufferVK::Cast(*device_buffer).GetBuffer();
+    const auto& device_buffer_vk = DeviceBufferVK::Cast(*device_buffer);
+    auto buffer = device_buffer_vk.GetBuffer();
     if (!buffer) {
       return false;
     }
@@ -85,7 +86,8 @@ static bool BindBuffers(const Bindings& bindings,
       return false;
     }
 
-    uint32_t offset = data.view.resource.range.offset;
+    uint32_t offset =
+        device_buffer_vk.GetBufferOffset() + data.view.resource.range.offset;
 
     vk::DescriptorBufferInfo buffer_info;
     buffer_info.buffer = buffer;
@@ -124,7 +124,7 @@ bool BlitCopyTextureToBufferCommandVK::Encode(CommandEncoderVK& encoder) const {
   const auto& dst = DeviceBufferVK::Cast(*destination);
 
   vk::BufferImageCopy image_copy;
-  image_copy.setBufferOffset(destination_offset);
+  image_copy.setBufferOffset(dst.GetBufferOffset() + destination_offset);
   image_copy.setBufferRowLength(0);
   image_copy.setBufferImageHeight(0);
   image_copy.setImageSubresource(
@@ -180,7 +180,7 @@ bool BlitCopyBufferToTextureCommandVK::Encode(CommandEncoderVK& encoder) const {
                           vk::PipelineStageFlagBits::eTransfer;
 
   vk::BufferImageCopy image_copy;
-  image_copy.setBufferOffset(source.range.offset);
+  image_copy.setBufferOffset(src.GetBufferOffset() + source.range.offset);
   image_copy.setBufferRowLength(0);
   image_copy.setBufferImageHeight(0);
   image_copy.setImageSubresource(
@@ -161,6 +161,8 @@ static const char* GetDeviceExtensionName(OptionalDeviceExtensionVK ext) {
       return VK_ARM_RASTERIZATION_ORDER_ATTACHMENT_ACCESS_EXTENSION_NAME;
     case OptionalDeviceExtensionVK::kEXTRasterizationOrderAttachmentAccess:
       return VK_EXT_RASTERIZATION_ORDER_ATTACHMENT_ACCESS_EXTENSION_NAME;
+    case OptionalDeviceExtensionVK::kKHRTimelineSemaphore:
+      return VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME;
     case OptionalDeviceExtensionVK::kLast:
       return "Unknown";
   }
@@ -418,6 +420,19 @@ bool CapabilitiesVK::SetPhysicalDevice(const vk::PhysicalDevice& device) {
              optional_device_extensions_.end());
   }
 
+  {
+    supports_timeline_semaphores_ = false;
+    if (HasOptionalDeviceExtension(
+            OptionalDeviceExtensionVK::kKHRTimelineSemaphore)) {
+      auto features = device.getFeatures2<
+          vk::PhysicalDeviceFeatures2,
+          vk::PhysicalDeviceTimelineSemaphoreFeaturesKHR>();
+      supports_timeline_semaphores_ =
+          features.get<vk::PhysicalDeviceTimelineSemaphoreFeaturesKHR>()
+              .timelineSemaphore;
+    }
+  }
+
   return true;
 }
 
@@ -497,6 +512,11 @@ CapabilitiesVK::GetPhysicalDeviceProperties() const {
   return device_properties_;
 }
 
+bool CapabilitiesVK::SupportsTimelineSemaphores() const {
+  // Set by |SetPhysicalDevice|.
+  return supports_timeline_semaphores_;
+}
+
 bool CapabilitiesVK::HasOptionalDeviceExtension(
     OptionalDeviceExtensionVK extension) const {
   return optional_device_extensions_.find(extension) !=
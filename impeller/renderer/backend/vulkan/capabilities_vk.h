@@ -24,6 +24,8 @@ enum class OptionalDeviceExtensionVK : uint32_t {
   kEXTPipelineCreationFeedback,
   kARMRasterizationOrderAttachmentAccess,
   kEXTRasterizationOrderAttachmentAccess,
+  // https://registry.khronos.org/vulkan/specs/1.3-extensions/man/html/VK_KHR_timeline_semaphore.html
+  kKHRTimelineSemaphore,
   kLast,
 };
 
@@ -58,6 +60,12 @@ class CapabilitiesVK final : public Capabilities,
 
   const vk::PhysicalDeviceProperties& GetPhysicalDeviceProperties() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Whether the device supports the timeline semaphore feature,
+  ///             which must then be enabled when creating the device.
+  ///
+  bool SupportsTimelineSemaphores() const;
+
   void SetOffscreenFormat(PixelFormat pixel_format) const;
 
   // |Capabilities|
@@ -113,6 +121,7 @@ class CapabilitiesVK final : public Capabilities,
   bool supports_compute_subgroups_ = false;
   bool supports_device_transient_textures_ = false;
   bool supports_framebuffer_fetch_ = false;
+  bool supports_timeline_semaphores_ = false;
   bool is_valid_ = false;
 
   bool HasExtension(const std::string& ext) const;
@@ -4,17 +4,22 @@
 
 #include "impeller/renderer/backend/vulkan/command_buffer_vk.h"
 
+#include <atomic>
+#include <functional>
 #include <memory>
 #include <utility>
 
 #include "flutter/fml/logging.h"
+#include "flutter/fml/trace_event.h"
 #include "impeller/base/validation.h"
 #include "impeller/renderer/backend/vulkan/blit_pass_vk.h"
 #include "impeller/renderer/backend/vulkan/command_encoder_vk.h"
+#include "impeller/renderer/backend/vulkan/command_pool_vk.h"
 #include "impeller/renderer/backend/vulkan/compute_pass_vk.h"
 #include "impeller/renderer/backend/vulkan/context_vk.h"
 #include "impeller/renderer/backend/vulkan/formats_vk.h"
 #include "impeller/renderer/backend/vulkan/render_pass_vk.h"
+#include "impeller/renderer/backend/vulkan/submission_batch_vk.h"
 #include "impeller/renderer/command_buffer.h"
 #include "impeller/renderer/render_target.h"
 
@@ -64,7 +69,141 @@ bool CommandBufferVK::OnSubmitCommands(CompletionCallback callback) {
   });
 }
 
-void CommandBufferVK::OnWaitUntilScheduled() {}
+void CommandBufferVK::OnWaitUntilScheduled() {
+  auto context = context_.lock();
+  if (!context) {
+    return;
+  }
+  // Command buffers batched for the frame are only scheduled once the batch
+  // is flushed.
+  auto submission_batch = ContextVK::Cast(*context).GetSubmissionBatch();
+  if (submission_batch && submission_batch->IsRecordingOnCurrentThread()) {
+    submission_batch->Flush();
+  }
+}
+
+namespace {
+
+// Encodes a render pass on whichever thread gets to it first: the worker it
+// was posted to, or the thread flushing the submission batch.
+class ParallelEncodeJobVK {
+ public:
+  using EncodeCallback = std::function<bool(uint64_t reservation)>;
+
+  ParallelEncodeJobVK(EncodeCallback encode,
+                      std::shared_ptr<SubmissionBatchVK> submission_batch)
+      : encode_(std::move(encode)),
+        submission_batch_(std::move(submission_batch)) {}
+
+  void SetReservation(uint64_t reservation) { reservation_ = reservation; }
+
+  /// Returns false if the pass was already encoded elsewhere.
+  bool TryRun() {
+    if (claimed_.exchange(true)) {
+      return false;
+    }
+    TRACE_EVENT0("impeller", "CommandBufferVK::EncodeInParallel");
+    if (!encode_(reservation_)) {
+      VALIDATION_LOG << "Failed to encode render pass.";
+      submission_batch_->Fulfill(reservation_, {}, nullptr);
+    }
+    // Drop the references to the pass resources as soon as possible.
+    encode_ = nullptr;
+    return true;
+  }
+
+ private:
+  EncodeCallback encode_;
+  const std::shared_ptr<SubmissionBatchVK> submission_batch_;
+  uint64_t reservation_ = 0u;
+  std::atomic_bool claimed_ = false;
+
+  ParallelEncodeJobVK(const ParallelEncodeJobVK&) = delete;
+
+  ParallelEncodeJobVK& operator=(const ParallelEncodeJobVK&) = delete;
+};
+
+}  // namespace
+
+bool CommandBufferVK::EncodeAndSubmit(
+    const std::shared_ptr<RenderPass>& render_pass) {
+  TRACE_EVENT0("impeller", "CommandBufferVK::EncodeAndSubmit");
+  if (!render_pass->IsValid() || !IsValid()) {
+    return false;
+  }
+  auto context = context_.lock();
+  if (!context) {
+    return false;
+  }
+  const auto& context_vk = ContextVK::Cast(*context);
+  auto submission_batch = context_vk.GetSubmissionBatch();
+  auto worker_task_runner = context_vk.GetConcurrentWorkerTaskRunner();
+
+  // Encoding is only moved off this thread while a frame is being recorded on
+  // it, since that is when submissions can be held back until the worker is
+  // done.
+  if (!submission_batch || !worker_task_runner ||
+      !submission_batch->IsRecordingOnCurrentThread() ||
+      render_pass->GetCommands().size() < kMinParallelEncodingCommandCount) {
+    return CommandBuffer::EncodeAndSubmit(render_pass);
+  }
+
+  auto render_pass_vk = std::static_pointer_cast<RenderPassVK>(render_pass);
+
+  // The host buffers the commands refer to are written to again while the
+  // worker encodes.
+  if (!render_pass_vk->ResolveDeviceBuffers(*context->GetResourceAllocator())) {
+    return false;
+  }
+
+  // Layout transitions depend on the passes submitted before this one, so
+  // they are recorded here into this command buffer, which runs right before
+  // the worker's.
+  auto prepared =
+      render_pass_vk->PrepareEncoding(context_vk, shared_from_this());
+  if (!prepared.has_value() || !SubmitCommands()) {
+    return false;
+  }
+
+  auto encode = [render_pass_vk = std::move(render_pass_vk),
+                 prepared = std::move(prepared.value()),
+                 encoder_factory = encoder_factory_,
+                 weak_context = context_](uint64_t reservation) -> bool {
+    auto context = weak_context.lock();
+    if (!context) {
+      return false;
+    }
+    // The encoder allocates its command buffer from the pool of the calling
+    // thread.
+    auto encoder = encoder_factory->Create();
+    if (!encoder) {
+      return false;
+    }
+    return render_pass_vk->EncodeRenderPass(ContextVK::Cast(*context),
+                                            encoder, prepared) &&
+           encoder->SubmitToReservation(reservation);
+  };
+  auto job = std::make_shared<ParallelEncodeJobVK>(std::move(encode),
+                                                   submission_batch);
+  auto reservation = submission_batch->Reserve([job]() { job->TryRun(); });
+  if (!reservation.has_value()) {
+    return false;
+  }
+  job->SetReservation(reservation.value());
+
+  worker_task_runner->PostTask(
+      [job, weak_context = context_vk.weak_from_this()]() {
+        if (!job->TryRun()) {
+          return;
+        }
+        // Let the command pool of this worker be recycled once the GPU is done
+        // with it instead of holding on to it until the next pass.
+        if (auto context = weak_context.lock()) {
+          ContextVK::Cast(*context).GetCommandPoolRecycler()->Dispose();
+        }
+      });
+  return true;
+}
 
 std::shared_ptr<RenderPass> CommandBufferVK::OnCreateRenderPass(
     RenderTarget target) {
@@ -21,11 +21,20 @@ class CommandBufferVK final
       public BackendCast<CommandBufferVK, CommandBuffer>,
       public std::enable_shared_from_this<CommandBufferVK> {
  public:
+  /// Render passes with fewer commands than this are encoded on the calling
+  /// thread, as handing them to a worker would cost more than it saves.
+  static constexpr size_t kMinParallelEncodingCommandCount = 16u;
+
   // |CommandBuffer|
   ~CommandBufferVK() override;
 
   const std::shared_ptr<CommandEncoderVK>& GetEncoder();
 
+  using CommandBuffer::EncodeAndSubmit;
+
+  // |CommandBuffer|
+  bool EncodeAndSubmit(const std::shared_ptr<RenderPass>& render_pass) override;
+
  private:
   friend class ContextVK;
 
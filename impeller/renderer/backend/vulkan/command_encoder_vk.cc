@@ -10,7 +10,9 @@
 #include "impeller/renderer/backend/vulkan/context_vk.h"
 #include "impeller/renderer/backend/vulkan/fence_waiter_vk.h"
 #include "impeller/renderer/backend/vulkan/gpu_tracer_vk.h"
+#include "impeller/renderer/backend/vulkan/submission_batch_vk.h"
 #include "impeller/renderer/backend/vulkan/texture_vk.h"
+#include "impeller/renderer/backend/vulkan/timeline_waiter_vk.h"
 
 namespace impeller {
 
@@ -142,20 +144,25 @@ std::shared_ptr<CommandEncoderVK> CommandEncoderFactoryVK::Create() {
   tracked_objects->GetGPUProbe().RecordCmdBufferStart(
       tracked_objects->GetCommandBuffer());
 
-  return std::make_shared<CommandEncoderVK>(context->GetDeviceHolder(),
-                                            tracked_objects, queue,
-                                            context->GetFenceWaiter());
+  return std::make_shared<CommandEncoderVK>(
+      context->GetDeviceHolder(), tracked_objects, queue,
+      context->GetFenceWaiter(), context->GetTimelineWaiter(),
+      context->GetSubmissionBatch());
 }
 
 CommandEncoderVK::CommandEncoderVK(
     std::weak_ptr<const DeviceHolder> device_holder,
     std::shared_ptr<TrackedObjectsVK> tracked_objects,
     const std::shared_ptr<QueueVK>& queue,
-    std::shared_ptr<FenceWaiterVK> fence_waiter)
+    std::shared_ptr<FenceWaiterVK> fence_waiter,
+    std::shared_ptr<TimelineWaiterVK> timeline_waiter,
+    std::shared_ptr<SubmissionBatchVK> submission_batch)
     : device_holder_(std::move(device_holder)),
       tracked_objects_(std::move(tracked_objects)),
       queue_(queue),
-      fence_waiter_(std::move(fence_waiter)) {}
+      fence_waiter_(std::move(fence_waiter)),
+      timeline_waiter_(std::move(timeline_waiter)),
+      submission_batch_(std::move(submission_batch)) {}
 
 CommandEncoderVK::~CommandEncoderVK() = default;
 
@@ -198,15 +205,54 @@ bool CommandEncoderVK::Submit(SubmitCallback callback) {
     VALIDATION_LOG << "Device lost.";
     return false;
   }
+
+  // While a frame is being recorded on this thread, the command buffer is
+  // submitted along with the rest of the frame.
+  if (submission_batch_ &&
+      submission_batch_->Append(
+          command_buffer, [callback, tracked_objects = tracked_objects_](
+                              bool submitted) mutable {
+            // Ensure tracked objects are destructed before calling any final
+            // callbacks.
+            tracked_objects.reset();
+            if (callback) {
+              callback(submitted);
+            }
+          })) {
+    fail_callback = false;
+    return true;
+  }
+
+  vk::SubmitInfo submit_info;
+  std::vector<vk::CommandBuffer> buffers = {command_buffer};
+  submit_info.setCommandBuffers(buffers);
+
+  // Prefer tracking completion on the queue's timeline semaphore, which
+  // doesn't need a fence per submission.
+  if (timeline_waiter_) {
+    status = timeline_waiter_->Submit(
+        submit_info, [callback, tracked_objects = tracked_objects_]() mutable {
+          // Ensure tracked objects are destructed before calling any final
+          // callbacks.
+          tracked_objects.reset();
+          if (callback) {
+            callback(true);
+          }
+        });
+    if (status != vk::Result::eSuccess) {
+      VALIDATION_LOG << "Failed to submit queue: " << vk::to_string(status);
+      return false;
+    }
+    fail_callback = false;
+    return true;
+  }
+
   auto [fence_result, fence] = strong_device->GetDevice().createFenceUnique({});
   if (fence_result != vk::Result::eSuccess) {
     VALIDATION_LOG << "Failed to create fence: " << vk::to_string(fence_result);
     return false;
   }
 
-  vk::SubmitInfo submit_info;
-  std::vector<vk::CommandBuffer> buffers = {command_buffer};
-  submit_info.setCommandBuffers(buffers);
   status = queue_->Submit(submit_info, *fence);
   if (status != vk::Result::eSuccess) {
     VALIDATION_LOG << "Failed to submit queue: " << vk::to_string(status);
@@ -228,6 +274,33 @@ bool CommandEncoderVK::Submit(SubmitCallback callback) {
       });
 }
 
+bool CommandEncoderVK::SubmitToReservation(uint64_t reservation) {
+  if (!IsValid() || !submission_batch_) {
+    VALIDATION_LOG << "Cannot submit invalid CommandEncoderVK.";
+    return false;
+  }
+
+  // Success or failure, you only get to submit once.
+  fml::ScopedCleanupClosure reset([&]() { Reset(); });
+
+  auto command_buffer = GetCommandBuffer();
+
+  tracked_objects_->GetGPUProbe().RecordCmdBufferEnd(command_buffer);
+
+  auto status = command_buffer.end();
+  if (status != vk::Result::eSuccess) {
+    VALIDATION_LOG << "Failed to end command buffer: " << vk::to_string(status);
+    return false;
+  }
+
+  return submission_batch_->Fulfill(
+      reservation, command_buffer,
+      [tracked_objects = tracked_objects_](bool) mutable {
+        // Release the tracked objects once the GPU is done with them.
+        tracked_objects.reset();
+      });
+}
+
 vk::CommandBuffer CommandEncoderVK::GetCommandBuffer() const {
   if (tracked_objects_) {
     return tracked_objects_->GetCommandBuffer();
@@ -26,6 +26,8 @@ class Texture;
 class TextureSourceVK;
 class TrackedObjectsVK;
 class FenceWaiterVK;
+class TimelineWaiterVK;
+class SubmissionBatchVK;
 class GPUProbe;
 
 class CommandEncoderFactoryVK {
@@ -51,10 +53,13 @@ class CommandEncoderVK {
   using SubmitCallback = std::function<void(bool)>;
 
   // Visible for testing.
-  CommandEncoderVK(std::weak_ptr<const DeviceHolder> device_holder,
-                   std::shared_ptr<TrackedObjectsVK> tracked_objects,
-                   const std::shared_ptr<QueueVK>& queue,
-                   std::shared_ptr<FenceWaiterVK> fence_waiter);
+  CommandEncoderVK(
+      std::weak_ptr<const DeviceHolder> device_holder,
+      std::shared_ptr<TrackedObjectsVK> tracked_objects,
+      const std::shared_ptr<QueueVK>& queue,
+      std::shared_ptr<FenceWaiterVK> fence_waiter,
+      std::shared_ptr<TimelineWaiterVK> timeline_waiter = nullptr,
+      std::shared_ptr<SubmissionBatchVK> submission_batch = nullptr);
 
   ~CommandEncoderVK();
 
@@ -62,6 +67,16 @@ class CommandEncoderVK {
 
   bool Submit(SubmitCallback callback = {});
 
+  //----------------------------------------------------------------------------
+  /// @brief      End the command buffer and hand it to the submission batch in
+  ///             place of a reservation made by the thread recording the
+  ///             batch. May be called from any thread.
+  ///
+  /// @return     If the reservation was fulfilled. If not, the caller is
+  ///             responsible for giving it up.
+  ///
+  bool SubmitToReservation(uint64_t reservation);
+
   bool Track(std::shared_ptr<SharedObjectVK> object);
 
   bool Track(std::shared_ptr<const Buffer> buffer);
@@ -95,6 +110,10 @@ class CommandEncoderVK {
   std::shared_ptr<TrackedObjectsVK> tracked_objects_;
   std::shared_ptr<QueueVK> queue_;
   const std::shared_ptr<FenceWaiterVK> fence_waiter_;
+  // If set, used instead of |fence_waiter_|.
+  const std::shared_ptr<TimelineWaiterVK> timeline_waiter_;
+  // If recording on the submitting thread, submissions are deferred to it.
+  const std::shared_ptr<SubmissionBatchVK> submission_batch_;
   bool is_valid_ = true;
 
   void Reset();
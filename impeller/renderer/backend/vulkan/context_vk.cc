@@ -30,7 +30,9 @@
 #include "impeller/renderer/backend/vulkan/fence_waiter_vk.h"
 #include "impeller/renderer/backend/vulkan/gpu_tracer_vk.h"
 #include "impeller/renderer/backend/vulkan/resource_manager_vk.h"
+#include "impeller/renderer/backend/vulkan/submission_batch_vk.h"
 #include "impeller/renderer/backend/vulkan/surface_context_vk.h"
+#include "impeller/renderer/backend/vulkan/timeline_waiter_vk.h"
 #include "impeller/renderer/capabilities.h"
 
 VULKAN_HPP_DEFAULT_DISPATCH_LOADER_DYNAMIC_STORAGE
@@ -266,6 +268,13 @@ void ContextVK::Setup(Settings settings) {
     device_holder->physical_device = physical_device.value();
   }
 
+  // The capabilities determine which optional device features are enabled
+  // when creating the logical device below.
+  if (!caps->SetPhysicalDevice(device_holder->physical_device)) {
+    VALIDATION_LOG << "Capabilities could not be updated.";
+    return;
+  }
+
   //----------------------------------------------------------------------------
   /// Pick device queues.
   ///
@@ -316,7 +325,18 @@ void ContextVK::Setup(Settings settings) {
     return;
   }
 
-  vk::DeviceCreateInfo device_info;
+  vk::StructureChain<vk::DeviceCreateInfo,
+                     vk::PhysicalDeviceTimelineSemaphoreFeaturesKHR>
+      device_chain;
+
+  if (caps->SupportsTimelineSemaphores()) {
+    device_chain.get<vk::PhysicalDeviceTimelineSemaphoreFeaturesKHR>()
+        .setTimelineSemaphore(true);
+  } else {
+    device_chain.unlink<vk::PhysicalDeviceTimelineSemaphoreFeaturesKHR>();
+  }
+
+  auto& device_info = device_chain.get<vk::DeviceCreateInfo>();
 
   device_info.setQueueCreateInfos(queue_create_infos);
   device_info.setPEnabledExtensionNames(enabled_device_extensions_c);
@@ -333,11 +353,6 @@ void ContextVK::Setup(Settings settings) {
     device_holder->device = std::move(device_result.value);
   }
 
-  if (!caps->SetPhysicalDevice(device_holder->physical_device)) {
-    VALIDATION_LOG << "Capabilities could not be updated.";
-    return;
-  }
-
   //----------------------------------------------------------------------------
   /// Create the allocator.
   ///
@@ -425,6 +440,26 @@ void ContextVK::Setup(Settings settings) {
     return;
   }
 
+  //----------------------------------------------------------------------------
+  /// Create the timeline waiter if the device supports timeline semaphores.
+  /// Submissions fall back to the fence waiter otherwise.
+  ///
+  std::shared_ptr<TimelineWaiterVK> timeline_waiter;
+  if (caps->SupportsTimelineSemaphores()) {
+    timeline_waiter = std::shared_ptr<TimelineWaiterVK>(
+        new TimelineWaiterVK(device_holder, queues.graphics_queue));
+    if (!timeline_waiter->IsValid()) {
+      FML_LOG(INFO) << "Timeline semaphores unavailable, using fences.";
+      timeline_waiter.reset();
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  /// Create the batch that collects the submissions of a frame.
+  ///
+  auto submission_batch = std::make_shared<SubmissionBatchVK>(
+      device_holder, queues.graphics_queue, fence_waiter, timeline_waiter);
+
   VkPhysicalDeviceProperties physical_device_properties;
   dispatcher.vkGetPhysicalDeviceProperties(device_holder->physical_device,
                                            &physical_device_properties);
@@ -441,6 +476,8 @@ void ContextVK::Setup(Settings settings) {
   queues_ = std::move(queues);
   device_capabilities_ = std::move(caps);
   fence_waiter_ = std::move(fence_waiter);
+  timeline_waiter_ = std::move(timeline_waiter);
+  submission_batch_ = std::move(submission_batch);
   resource_manager_ = std::move(resource_manager);
   command_pool_recycler_ = std::move(command_pool_recycler);
   descriptor_pool_recycler_ = std::move(descriptor_pool_recycler);
@@ -517,7 +554,9 @@ void ContextVK::Shutdown() {
   // pointers ensures that cleanup happens in a correct order.
   //
   // tl;dr: Without it, we get thread::join failures on shutdown.
+  submission_batch_.reset();
   fence_waiter_.reset();
+  timeline_waiter_.reset();
   resource_manager_.reset();
 
   queue_submit_thread_->Join();
@@ -544,6 +583,14 @@ std::shared_ptr<FenceWaiterVK> ContextVK::GetFenceWaiter() const {
   return fence_waiter_;
 }
 
+std::shared_ptr<TimelineWaiterVK> ContextVK::GetTimelineWaiter() const {
+  return timeline_waiter_;
+}
+
+std::shared_ptr<SubmissionBatchVK> ContextVK::GetSubmissionBatch() const {
+  return submission_batch_;
+}
+
 std::shared_ptr<ResourceManagerVK> ContextVK::GetResourceManager() const {
   return resource_manager_;
 }
@@ -32,6 +32,8 @@ class CommandEncoderVK;
 class CommandPoolRecyclerVK;
 class DebugReportVK;
 class FenceWaiterVK;
+class TimelineWaiterVK;
+class SubmissionBatchVK;
 class ResourceManagerVK;
 class SurfaceContextVK;
 class GPUTracerVK;
@@ -156,6 +158,16 @@ class ContextVK final : public Context,
 
   std::shared_ptr<FenceWaiterVK> GetFenceWaiter() const;
 
+  /// @brief  The waiter used to track submissions to the graphics queue with
+  ///         a timeline semaphore, or nullptr if the device does not support
+  ///         them.
+  std::shared_ptr<TimelineWaiterVK> GetTimelineWaiter() const;
+
+  /// @brief  The batch that collects the command buffers of the frame being
+  ///         recorded so that they are submitted to the graphics queue
+  ///         together.
+  std::shared_ptr<SubmissionBatchVK> GetSubmissionBatch() const;
+
   std::shared_ptr<ResourceManagerVK> GetResourceManager() const;
 
   std::shared_ptr<CommandPoolRecyclerVK> GetCommandPoolRecycler() const;
@@ -191,6 +203,8 @@ class ContextVK final : public Context,
   QueuesVK queues_;
   std::shared_ptr<const Capabilities> device_capabilities_;
   std::shared_ptr<FenceWaiterVK> fence_waiter_;
+  std::shared_ptr<TimelineWaiterVK> timeline_waiter_;
+  std::shared_ptr<SubmissionBatchVK> submission_batch_;
   std::shared_ptr<ResourceManagerVK> resource_manager_;
   std::shared_ptr<CommandPoolRecyclerVK> command_pool_recycler_;
   std::string device_name_;
@@ -20,15 +20,37 @@ DeviceBufferVK::DeviceBufferVK(DeviceBufferDescriptor desc,
                     info                //
                 }) {}
 
+DeviceBufferVK::DeviceBufferVK(
+    DeviceBufferDescriptor desc,
+    std::weak_ptr<Context> context,
+    std::unique_ptr<BufferSubAllocator::Allocation> allocation)
+    : DeviceBuffer(desc),
+      context_(std::move(context)),
+      resource_(ContextVK::Cast(*context_.lock().get()).GetResourceManager()),
+      allocation_(std::move(allocation)) {
+  FML_DCHECK(allocation_);
+}
+
 DeviceBufferVK::~DeviceBufferVK() = default;
 
 uint8_t* DeviceBufferVK::OnGetContents() const {
+  if (allocation_) {
+    auto block_contents = allocation_->GetBlock()->OnGetContents();
+    return block_contents ? block_contents + allocation_->GetOffset()
+                          : nullptr;
+  }
   return static_cast<uint8_t*>(resource_->info.pMappedData);
 }
 
 bool DeviceBufferVK::OnCopyHostBuffer(const uint8_t* source,
                                       Range source_range,
                                       size_t offset) {
+  if (allocation_) {
+    return DeviceBufferVK::Cast(*allocation_->GetBlock())
+        .OnCopyHostBuffer(source, source_range,
+                          allocation_->GetOffset() + offset);
+  }
+
   TRACE_EVENT0("impeller", "CopyToDeviceBuffer");
   uint8_t* dest = OnGetContents();
 
@@ -47,6 +69,10 @@ bool DeviceBufferVK::OnCopyHostBuffer(const uint8_t* source,
 }
 
 bool DeviceBufferVK::SetLabel(const std::string& label) {
+  if (allocation_) {
+    // The block is shared with other buffers and keeps its own name.
+    return true;
+  }
   auto context = context_.lock();
   if (!context || !resource_->buffer.is_valid()) {
     // The context could have died at this point.
@@ -68,7 +94,14 @@ bool DeviceBufferVK::SetLabel(const std::string& label, Range range) {
 }
 
 vk::Buffer DeviceBufferVK::GetBuffer() const {
+  if (allocation_) {
+    return DeviceBufferVK::Cast(*allocation_->GetBlock()).GetBuffer();
+  }
   return resource_->buffer.get().buffer;
 }
 
+vk::DeviceSize DeviceBufferVK::GetBufferOffset() const {
+  return allocation_ ? allocation_->GetOffset() : 0u;
+}
+
 }  // namespace impeller
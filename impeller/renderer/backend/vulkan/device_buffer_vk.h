@@ -10,6 +10,7 @@
 #include "flutter/fml/macros.h"
 #include "flutter/fml/trace_event.h"
 #include "impeller/base/backend_cast.h"
+#include "impeller/core/buffer_sub_allocator.h"
 #include "impeller/core/device_buffer.h"
 #include "impeller/renderer/backend/vulkan/context_vk.h"
 #include "impeller/renderer/backend/vulkan/resource_manager_vk.h"
@@ -25,11 +26,26 @@ class DeviceBufferVK final : public DeviceBuffer,
                  UniqueBufferVMA buffer,
                  VmaAllocationInfo info);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Create a device buffer that is a range of a larger block
+  ///             owned by a sub-allocator.
+  ///
+  DeviceBufferVK(DeviceBufferDescriptor desc,
+                 std::weak_ptr<Context> context,
+                 std::unique_ptr<BufferSubAllocator::Allocation> allocation);
+
   // |DeviceBuffer|
   ~DeviceBufferVK() override;
 
   vk::Buffer GetBuffer() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      The offset of this buffer within the buffer returned by
+  ///             |GetBuffer|. Must be added to every offset this buffer is
+  ///             bound or copied at.
+  ///
+  vk::DeviceSize GetBufferOffset() const;
+
  private:
   friend class AllocatorVK;
 
@@ -54,6 +70,9 @@ class DeviceBufferVK final : public DeviceBuffer,
 
   std::weak_ptr<Context> context_;
   UniqueResourceVKT<BufferResource> resource_;
+  // Only set if this buffer is a range of a sub-allocated block, in which
+  // case the resource is empty.
+  std::unique_ptr<BufferSubAllocator::Allocation> allocation_;
 
   // |DeviceBuffer|
   uint8_t* OnGetContents() const override;
@@ -16,6 +16,9 @@ namespace impeller {
 static constexpr const char* kPipelineCacheFileName =
     "flutter.impeller.vkcache";
 
+static constexpr const char* kVariantManifestFileName =
+    "flutter.impeller.vkvariants";
+
 static bool VerifyExistingCache(const fml::Mapping& mapping,
                                 const CapabilitiesVK& caps) {
   return true;
@@ -187,6 +190,25 @@ void PipelineCacheVK::PersistCacheToDisk() const {
   }
 }
 
+std::shared_ptr<fml::Mapping> PipelineCacheVK::LoadVariantManifest() const {
+  if (!cache_directory_.is_valid()) {
+    return nullptr;
+  }
+  return fml::FileMapping::CreateReadOnly(cache_directory_,
+                                          kVariantManifestFileName);
+}
+
+void PipelineCacheVK::PersistVariantManifestToDisk(
+    const fml::Mapping& manifest) const {
+  if (!cache_directory_.is_valid()) {
+    return;
+  }
+  if (!fml::WriteAtomically(cache_directory_, kVariantManifestFileName,
+                            manifest)) {
+    VALIDATION_LOG << "Could not persist pipeline variant manifest to disk.";
+  }
+}
+
 const CapabilitiesVK* PipelineCacheVK::GetCapabilities() const {
   return CapabilitiesVK::Cast(caps_.get());
 }
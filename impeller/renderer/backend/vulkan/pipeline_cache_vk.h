@@ -34,6 +34,10 @@ class PipelineCacheVK {
 
   void PersistCacheToDisk() const;
 
+  std::shared_ptr<fml::Mapping> LoadVariantManifest() const;
+
+  void PersistVariantManifestToDisk(const fml::Mapping& manifest) const;
+
  private:
   const std::shared_ptr<const Capabilities> caps_;
   std::weak_ptr<DeviceHolder> device_holder_;
@@ -730,14 +730,39 @@ void PipelineLibraryVK::DidAcquireSurfaceFrame() {
   }
 }
 
+// |PipelineLibrary|
+std::shared_ptr<fml::Mapping> PipelineLibraryVK::LoadVariantManifest() const {
+  return pso_cache_->LoadVariantManifest();
+}
+
+// |PipelineLibrary|
+void PipelineLibraryVK::SetVariantManifestProvider(
+    VariantManifestProvider provider) {
+  Lock lock(variant_manifest_provider_mutex_);
+  variant_manifest_provider_ = std::move(provider);
+}
+
 void PipelineLibraryVK::PersistPipelineCacheToDisk() {
+  VariantManifestProvider variant_manifest_provider;
+  {
+    Lock lock(variant_manifest_provider_mutex_);
+    variant_manifest_provider = variant_manifest_provider_;
+  }
   worker_task_runner_->PostTask(
-      [weak_cache = decltype(pso_cache_)::weak_type(pso_cache_)]() {
+      [weak_cache = decltype(pso_cache_)::weak_type(pso_cache_),
+       variant_manifest_provider = std::move(variant_manifest_provider)]() {
         auto cache = weak_cache.lock();
         if (!cache) {
           return;
         }
         cache->PersistCacheToDisk();
+        // By now, the variants used by the application have been recorded
+        // as well.
+        if (variant_manifest_provider) {
+          if (auto manifest = variant_manifest_provider()) {
+            cache->PersistVariantManifestToDisk(*manifest);
+          }
+        }
       });
 }
 
@@ -45,6 +45,9 @@ class PipelineLibraryVK final
   ComputePipelineMap compute_pipelines_
       IPLR_GUARDED_BY(compute_pipelines_mutex_);
   std::atomic_size_t frames_acquired_ = 0u;
+  Mutex variant_manifest_provider_mutex_;
+  VariantManifestProvider variant_manifest_provider_
+      IPLR_GUARDED_BY(variant_manifest_provider_mutex_);
   bool is_valid_ = false;
 
   PipelineLibraryVK(
@@ -68,6 +71,12 @@ class PipelineLibraryVK final
   void RemovePipelinesWithEntryPoint(
       std::shared_ptr<const ShaderFunction> function) override;
 
+  // |PipelineLibrary|
+  std::shared_ptr<fml::Mapping> LoadVariantManifest() const override;
+
+  // |PipelineLibrary|
+  void SetVariantManifestProvider(VariantManifestProvider provider) override;
+
   std::unique_ptr<PipelineVK> CreatePipeline(const PipelineDescriptor& desc);
 
   std::unique_ptr<ComputePipelineVK> CreateComputePipeline(
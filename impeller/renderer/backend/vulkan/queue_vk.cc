@@ -23,6 +23,12 @@ vk::Result QueueVK::Submit(const vk::SubmitInfo& submit_info,
   return queue_.submit(submit_info, fence);
 }
 
+vk::Result QueueVK::Submit(const std::vector<vk::SubmitInfo>& submit_infos,
+                           const vk::Fence& fence) const {
+  Lock lock(queue_mutex_);
+  return queue_.submit(submit_infos, fence);
+}
+
 void QueueVK::InsertDebugMarker(const char* label) const {
   if (!HasValidationLayers()) {
     return;
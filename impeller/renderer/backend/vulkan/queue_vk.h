@@ -6,6 +6,7 @@
 #define FLUTTER_IMPELLER_RENDERER_BACKEND_VULKAN_QUEUE_VK_H_
 
 #include <memory>
+#include <vector>
 
 #include "flutter/fml/macros.h"
 #include "impeller/base/thread.h"
@@ -40,6 +41,14 @@ class QueueVK {
   vk::Result Submit(const vk::SubmitInfo& submit_info,
                     const vk::Fence& fence) const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Submit multiple batches in a single call. The batches execute
+  ///             in order and the fence is signalled once all of them have
+  ///             completed.
+  ///
+  vk::Result Submit(const std::vector<vk::SubmitInfo>& submit_infos,
+                    const vk::Fence& fence) const;
+
   void InsertDebugMarker(const char* label) const;
 
  private:
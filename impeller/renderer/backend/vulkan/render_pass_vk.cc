@@ -6,6 +6,7 @@
 
 #include <array>
 #include <cstdint>
+#include <optional>
 #include <vector>
 
 #include "flutter/fml/trace_event.h"
@@ -423,9 +424,10 @@ static bool EncodeCommand(const Context& context,
   }
 
   // Bind the vertex buffer.
-  auto vertex_buffer_handle = DeviceBufferVK::Cast(*vertex_buffer).GetBuffer();
-  vk::Buffer vertex_buffers[] = {vertex_buffer_handle};
-  vk::DeviceSize vertex_buffer_offsets[] = {vertex_buffer_view.range.offset};
+  const auto& vertex_buffer_vk = DeviceBufferVK::Cast(*vertex_buffer);
+  vk::Buffer vertex_buffers[] = {vertex_buffer_vk.GetBuffer()};
+  vk::DeviceSize vertex_buffer_offsets[] = {
+      vertex_buffer_vk.GetBufferOffset() + vertex_buffer_view.range.offset};
   cmd_buffer.bindVertexBuffers(0u, 1u, vertex_buffers, vertex_buffer_offsets);
 
   if (command.vertex_buffer.index_type != IndexType::kNone) {
@@ -446,10 +448,11 @@ static bool EncodeCommand(const Context& context,
       return false;
     }
 
-    auto index_buffer_handle = DeviceBufferVK::Cast(*index_buffer).GetBuffer();
-    cmd_buffer.bindIndexBuffer(index_buffer_handle,
-                               index_buffer_view.range.offset,
-                               ToVKIndexType(command.vertex_buffer.index_type));
+    const auto& index_buffer_vk = DeviceBufferVK::Cast(*index_buffer);
+    cmd_buffer.bindIndexBuffer(
+        index_buffer_vk.GetBuffer(),
+        index_buffer_vk.GetBufferOffset() + index_buffer_view.range.offset,
+        ToVKIndexType(command.vertex_buffer.index_type));
 
     // Engage!
     cmd_buffer.drawIndexed(command.vertex_buffer.vertex_count,  // index count
@@ -486,18 +489,24 @@ bool RenderPassVK::OnEncodeCommands(const Context& context) const {
     return false;
   }
 
-  fml::ScopedCleanupClosure pop_marker(
-      [&encoder]() { encoder->PopDebugGroup(); });
-  if (!debug_label_.empty()) {
-    encoder->PushDebugGroup(debug_label_.c_str());
-  } else {
-    pop_marker.Release();
+  auto prepared = PrepareEncoding(vk_context, command_buffer);
+  if (!prepared.has_value()) {
+    return false;
   }
+  return EncodeRenderPass(vk_context, encoder, prepared.value());
+}
 
-  auto cmd_buffer = encoder->GetCommandBuffer();
+std::optional<RenderPassVK::PreparedPassVK> RenderPassVK::PrepareEncoding(
+    const ContextVK& context,
+    const std::shared_ptr<CommandBufferVK>& command_buffer) const {
+  TRACE_EVENT0("impeller", "RenderPassVK::PrepareEncoding");
+  const auto& encoder = command_buffer->GetEncoder();
+  if (!encoder) {
+    return std::nullopt;
+  }
 
-  if (!UpdateBindingLayouts(commands_, cmd_buffer)) {
-    return false;
+  if (!UpdateBindingLayouts(commands_, encoder->GetCommandBuffer())) {
+    return std::nullopt;
   }
 
   render_target_.IterateAllAttachments(
@@ -507,31 +516,55 @@ bool RenderPassVK::OnEncodeCommands(const Context& context) const {
         return true;
       });
 
-  const auto& target_size = render_target_.GetRenderTargetSize();
-
-  auto render_pass = CreateVKRenderPass(
-      vk_context, command_buffer,
-      vk_context.GetCapabilities()->SupportsFramebufferFetch());
-  if (!render_pass) {
+  PreparedPassVK prepared;
+  prepared.render_pass = CreateVKRenderPass(
+      context, command_buffer,
+      context.GetCapabilities()->SupportsFramebufferFetch());
+  if (!prepared.render_pass) {
     VALIDATION_LOG << "Could not create renderpass.";
-    return false;
+    return std::nullopt;
   }
 
-  auto framebuffer = CreateVKFramebuffer(vk_context, *render_pass);
-  if (!framebuffer) {
+  prepared.framebuffer = CreateVKFramebuffer(context, *prepared.render_pass);
+  if (!prepared.framebuffer) {
     VALIDATION_LOG << "Could not create framebuffer.";
-    return false;
+    return std::nullopt;
+  }
+  return prepared;
+}
+
+bool RenderPassVK::EncodeRenderPass(
+    const ContextVK& context,
+    const std::shared_ptr<CommandEncoderVK>& encoder,
+    const PreparedPassVK& prepared) const {
+  fml::ScopedCleanupClosure pop_marker(
+      [&encoder]() { encoder->PopDebugGroup(); });
+  if (!debug_label_.empty()) {
+    encoder->PushDebugGroup(debug_label_.c_str());
+  } else {
+    pop_marker.Release();
   }
 
-  if (!encoder->Track(framebuffer) || !encoder->Track(render_pass)) {
+  auto cmd_buffer = encoder->GetCommandBuffer();
+
+  render_target_.IterateAllAttachments(
+      [&encoder](const auto& attachment) -> bool {
+        encoder->Track(attachment.texture);
+        encoder->Track(attachment.resolve_texture);
+        return true;
+      });
+
+  if (!encoder->Track(prepared.framebuffer) ||
+      !encoder->Track(prepared.render_pass)) {
     return false;
   }
 
+  const auto& target_size = render_target_.GetRenderTargetSize();
   auto clear_values = GetVKClearValues(render_target_);
 
   vk::RenderPassBeginInfo pass_info;
-  pass_info.renderPass = *render_pass;
-  pass_info.framebuffer = *framebuffer;
+  pass_info.renderPass = *prepared.render_pass;
+  pass_info.framebuffer = *prepared.framebuffer;
   pass_info.renderArea.extent.width = static_cast<uint32_t>(target_size.width);
   pass_info.renderArea.extent.height =
       static_cast<uint32_t>(target_size.height);
@@ -540,7 +573,7 @@ bool RenderPassVK::OnEncodeCommands(const Context& context) const {
   const auto& color_image_vk = TextureVK::Cast(
       *render_target_.GetColorAttachments().find(0u)->second.texture);
   auto desc_sets_result = AllocateAndBindDescriptorSets(
-      vk_context, encoder, commands_, color_image_vk);
+      context, encoder, commands_, color_image_vk);
   if (!desc_sets_result.ok()) {
     return false;
   }
@@ -566,4 +599,40 @@ bool RenderPassVK::OnEncodeCommands(const Context& context) const {
   return true;
 }
 
+static bool ResolveDeviceBuffer(BufferView& view, Allocator& allocator) {
+  if (!view) {
+    return true;
+  }
+  auto device_buffer = view.buffer->GetDeviceBuffer(allocator);
+  if (!device_buffer) {
+    return false;
+  }
+  view.buffer = std::move(device_buffer);
+  return true;
+}
+
+static bool ResolveDeviceBuffers(Bindings& bindings, Allocator& allocator) {
+  for (auto& data : bindings.buffers) {
+    if (!ResolveDeviceBuffer(data.view.resource, allocator)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool RenderPassVK::ResolveDeviceBuffers(Allocator& allocator) {
+  TRACE_EVENT0("impeller", "RenderPassVK::ResolveDeviceBuffers");
+  for (auto& command : commands_) {
+    if (!ResolveDeviceBuffer(command.vertex_buffer.vertex_buffer, allocator) ||
+        !ResolveDeviceBuffer(command.vertex_buffer.index_buffer, allocator) ||
+        !impeller::ResolveDeviceBuffers(command.vertex_bindings, allocator) ||
+        !impeller::ResolveDeviceBuffers(command.fragment_bindings,
+                                        allocator)) {
+      VALIDATION_LOG << "Failed to acquire a device buffer for a command.";
+      return false;
+    }
+  }
+  return true;
+}
+
 }  // namespace impeller
@@ -5,6 +5,9 @@
 #ifndef FLUTTER_IMPELLER_RENDERER_BACKEND_VULKAN_RENDER_PASS_VK_H_
 #define FLUTTER_IMPELLER_RENDERER_BACKEND_VULKAN_RENDER_PASS_VK_H_
 
+#include <memory>
+#include <optional>
+
 #include "flutter/fml/macros.h"
 #include "impeller/renderer/backend/vulkan/context_vk.h"
 #include "impeller/renderer/backend/vulkan/pass_bindings_cache.h"
@@ -15,6 +18,7 @@
 namespace impeller {
 
 class CommandBufferVK;
+class CommandEncoderVK;
 
 class RenderPassVK final : public RenderPass {
  public:
@@ -42,6 +46,40 @@ class RenderPassVK final : public RenderPass {
   // |RenderPass|
   bool OnEncodeCommands(const Context& context) const override;
 
+  // The Vulkan objects a pass is encoded with. Creating them transitions the
+  // layouts of the attachments, so this must happen in submission order.
+  struct PreparedPassVK {
+    SharedHandleVK<vk::RenderPass> render_pass;
+    SharedHandleVK<vk::Framebuffer> framebuffer;
+  };
+
+  //----------------------------------------------------------------------------
+  /// @brief      Record the layout transitions of the attachments and sampled
+  ///             textures into the command buffer of this pass and create the
+  ///             render pass and framebuffer. Must be called on the thread
+  ///             that submits the pass, in submission order.
+  ///
+  std::optional<PreparedPassVK> PrepareEncoding(
+      const ContextVK& context,
+      const std::shared_ptr<CommandBufferVK>& command_buffer) const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Record the commands of a prepared pass into the given
+  ///             encoder. This does not depend on the layout state of any
+  ///             texture and may be called on any thread, as long as the
+  ///             buffers bound by the commands are device buffers.
+  ///
+  bool EncodeRenderPass(const ContextVK& context,
+                        const std::shared_ptr<CommandEncoderVK>& encoder,
+                        const PreparedPassVK& prepared) const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Replace the host buffers bound by the commands with the
+  ///             device buffers they are uploaded to, so that the commands can
+  ///             be encoded while the host buffers are written to again.
+  ///
+  bool ResolveDeviceBuffers(Allocator& allocator);
+
   SharedHandleVK<vk::RenderPass> CreateVKRenderPass(
       const ContextVK& context,
       const std::shared_ptr<CommandBufferVK>& command_buffer,
@@ -0,0 +1,259 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/renderer/backend/vulkan/submission_batch_vk.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "flutter/fml/trace_event.h"
+#include "impeller/base/validation.h"
+#include "impeller/renderer/backend/vulkan/fence_waiter_vk.h"
+#include "impeller/renderer/backend/vulkan/timeline_waiter_vk.h"
+
+namespace impeller {
+
+SubmissionBatchVK::SubmissionBatchVK(
+    std::weak_ptr<const DeviceHolder> device_holder,
+    std::shared_ptr<QueueVK> queue,
+    std::shared_ptr<FenceWaiterVK> fence_waiter,
+    std::shared_ptr<TimelineWaiterVK> timeline_waiter)
+    : device_holder_(std::move(device_holder)),
+      queue_(std::move(queue)),
+      fence_waiter_(std::move(fence_waiter)),
+      timeline_waiter_(std::move(timeline_waiter)) {}
+
+SubmissionBatchVK::~SubmissionBatchVK() {
+  // Outstanding reservations are held by whoever fulfills them, who also
+  // holds a reference to the batch. So there are none left here.
+  std::vector<PendingSubmission> pending;
+  {
+    std::scoped_lock lock(mutex_);
+    std::swap(pending, pending_);
+  }
+  for (auto& submission : pending) {
+    if (submission.callback) {
+      submission.callback(false);
+    }
+  }
+}
+
+void SubmissionBatchVK::Begin() {
+  Flush();
+  std::scoped_lock lock(mutex_);
+  owner_ = std::this_thread::get_id();
+}
+
+bool SubmissionBatchVK::End() {
+  auto result = Flush();
+  std::scoped_lock lock(mutex_);
+  owner_ = std::nullopt;
+  return result;
+}
+
+bool SubmissionBatchVK::IsRecordingOnCurrentThread() const {
+  std::scoped_lock lock(mutex_);
+  return owner_ == std::this_thread::get_id();
+}
+
+bool SubmissionBatchVK::Append(vk::CommandBuffer buffer,
+                               CompletionCallback callback) {
+  if (!buffer || !callback) {
+    return false;
+  }
+  std::scoped_lock lock(mutex_);
+  if (owner_ != std::this_thread::get_id()) {
+    return false;
+  }
+  pending_.push_back(PendingSubmission{
+      .buffer = buffer,
+      .callback = std::move(callback),
+  });
+  return true;
+}
+
+std::optional<uint64_t> SubmissionBatchVK::Reserve(
+    fml::closure run_if_pending) {
+  std::scoped_lock lock(mutex_);
+  if (owner_ != std::this_thread::get_id()) {
+    return std::nullopt;
+  }
+  const auto reservation = next_reservation_++;
+  pending_.push_back(PendingSubmission{
+      .reservation = reservation,
+      .run_if_pending = std::move(run_if_pending),
+  });
+  outstanding_reservations_++;
+  return reservation;
+}
+
+bool SubmissionBatchVK::Fulfill(uint64_t reservation,
+                                vk::CommandBuffer buffer,
+                                CompletionCallback callback) {
+  {
+    std::scoped_lock lock(mutex_);
+    auto found = std::find_if(pending_.begin(), pending_.end(),
+                              [reservation](const auto& submission) {
+                                return submission.reservation == reservation;
+                              });
+    if (found == pending_.end()) {
+      return false;
+    }
+    found->buffer = buffer;
+    found->callback = std::move(callback);
+    found->reservation = std::nullopt;
+    found->run_if_pending = nullptr;
+    outstanding_reservations_--;
+  }
+  fulfilled_cv_.notify_all();
+  return true;
+}
+
+std::vector<SubmissionBatchVK::PendingSubmission>
+SubmissionBatchVK::TakePending() {
+  std::vector<fml::closure> run_if_pending;
+  {
+    std::scoped_lock lock(mutex_);
+    for (const auto& submission : pending_) {
+      if (submission.reservation.has_value() && submission.run_if_pending) {
+        run_if_pending.push_back(submission.run_if_pending);
+      }
+    }
+  }
+  // Work that hasn't been picked up yet is done here rather than waiting for
+  // a worker to become available.
+  for (const auto& run : run_if_pending) {
+    run();
+  }
+
+  std::vector<PendingSubmission> pending;
+  std::unique_lock lock(mutex_);
+  if (outstanding_reservations_ > 0u) {
+    TRACE_EVENT0("impeller", "SubmissionBatchVK::WaitForReservations");
+    fulfilled_cv_.wait(lock, [&]() { return outstanding_reservations_ == 0u; });
+  }
+  std::swap(pending, pending_);
+  return pending;
+}
+
+size_t SubmissionBatchVK::GetPendingCount() const {
+  std::scoped_lock lock(mutex_);
+  return pending_.size();
+}
+
+static void CompleteSubmissions(
+    std::vector<SubmissionBatchVK::CompletionCallback>& calls,
+    bool success) {
+  for (auto& call : calls) {
+    call(success);
+  }
+  calls.clear();
+}
+
+bool SubmissionBatchVK::Flush(std::optional<vk::SubmitInfo> trailing_info,
+                              const vk::Fence& fence) {
+  std::vector<PendingSubmission> pending;
+  for (auto& submission : TakePending()) {
+    // Reservations that were given up leave no command buffer behind.
+    if (submission.buffer) {
+      pending.push_back(std::move(submission));
+    } else if (submission.callback) {
+      submission.callback(false);
+    }
+  }
+  if (pending.empty() && !trailing_info.has_value()) {
+    return true;
+  }
+  TRACE_EVENT0("impeller", "SubmissionBatchVK::Flush");
+
+  // Shared so that the callbacks (and the objects they keep alive) are only
+  // ever owned by one place, whichever way the submission goes.
+  std::vector<vk::CommandBuffer> buffers;
+  auto callbacks = std::make_shared<std::vector<CompletionCallback>>();
+  buffers.reserve(pending.size());
+  callbacks->reserve(pending.size());
+  for (auto& submission : pending) {
+    buffers.push_back(submission.buffer);
+    callbacks->push_back(std::move(submission.callback));
+  }
+
+  auto device = device_holder_.lock();
+  if (!device) {
+    VALIDATION_LOG << "Device lost.";
+    CompleteSubmissions(*callbacks, false);
+    return false;
+  }
+
+  // The pending command buffers go into their own batch so that semaphore
+  // waits of the trailing batch don't hold them back.
+  std::vector<vk::SubmitInfo> submit_infos;
+  if (!buffers.empty()) {
+    vk::SubmitInfo submit_info;
+    submit_info.setCommandBuffers(buffers);
+    submit_infos.push_back(submit_info);
+  }
+
+  if (callbacks->empty()) {
+    submit_infos.push_back(trailing_info.value());
+    auto result = queue_->Submit(submit_infos, fence);
+    if (result != vk::Result::eSuccess) {
+      VALIDATION_LOG << "Failed to submit queue: " << vk::to_string(result);
+      return false;
+    }
+    return true;
+  }
+
+  if (timeline_waiter_) {
+    if (trailing_info.has_value()) {
+      submit_infos.push_back(trailing_info.value());
+    }
+    auto result = timeline_waiter_->SubmitBatches(
+        submit_infos, [callbacks]() { CompleteSubmissions(*callbacks, true); },
+        fence);
+    if (result != vk::Result::eSuccess) {
+      VALIDATION_LOG << "Failed to submit queue: " << vk::to_string(result);
+      CompleteSubmissions(*callbacks, false);
+      return false;
+    }
+    return true;
+  }
+
+  // Without a timeline, completion is tracked with a fence of our own. A call
+  // to submit only takes one fence, so if the trailing batch comes with its
+  // own, it is submitted separately.
+  auto [fence_result, batch_fence] = device->GetDevice().createFenceUnique({});
+  if (fence_result != vk::Result::eSuccess) {
+    VALIDATION_LOG << "Failed to create fence: " << vk::to_string(fence_result);
+    CompleteSubmissions(*callbacks, false);
+    return false;
+  }
+  const bool merge_trailing = trailing_info.has_value() && !fence;
+  if (merge_trailing) {
+    submit_infos.push_back(trailing_info.value());
+  }
+  auto result = queue_->Submit(submit_infos, *batch_fence);
+  if (result != vk::Result::eSuccess) {
+    VALIDATION_LOG << "Failed to submit queue: " << vk::to_string(result);
+    CompleteSubmissions(*callbacks, false);
+    return false;
+  }
+  if (!fence_waiter_->AddFence(std::move(batch_fence), [callbacks]() {
+        CompleteSubmissions(*callbacks, true);
+      })) {
+    VALIDATION_LOG << "Failed to wait on the batch fence.";
+    CompleteSubmissions(*callbacks, false);
+    return false;
+  }
+
+  if (trailing_info.has_value() && !merge_trailing) {
+    result = queue_->Submit(trailing_info.value(), fence);
+    if (result != vk::Result::eSuccess) {
+      VALIDATION_LOG << "Failed to submit queue: " << vk::to_string(result);
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace impeller
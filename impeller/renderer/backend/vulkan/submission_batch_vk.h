@@ -0,0 +1,170 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_IMPELLER_RENDERER_BACKEND_VULKAN_SUBMISSION_BATCH_VK_H_
+#define FLUTTER_IMPELLER_RENDERER_BACKEND_VULKAN_SUBMISSION_BATCH_VK_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "flutter/fml/closure.h"
+#include "impeller/renderer/backend/vulkan/device_holder.h"
+#include "impeller/renderer/backend/vulkan/queue_vk.h"
+#include "impeller/renderer/backend/vulkan/vk.h"
+
+namespace impeller {
+
+class FenceWaiterVK;
+class TimelineWaiterVK;
+
+//------------------------------------------------------------------------------
+/// @brief      Collects the command buffers submitted on a single thread
+///             during a frame and submits them to the queue together.
+///
+///             A frame typically encodes several command buffers (offscreen
+///             subpasses, blits, the onscreen pass). Instead of one queue
+///             submission and one fence per command buffer, the batch records
+///             them in order and issues a single submission when flushed. The
+///             swapchain flushes the batch along with the presentation
+///             submission so that a frame takes one call into the driver.
+///
+///             Only command buffers submitted on the thread that began the
+///             batch are collected. Submissions from other threads (such as
+///             image uploads) go straight to the queue. The recording thread
+///             may however reserve a place in the batch for a command buffer
+///             that is encoded on another thread. The batch is not flushed
+///             until all reservations have been fulfilled.
+///
+class SubmissionBatchVK {
+ public:
+  using CompletionCallback = std::function<void(bool)>;
+
+  SubmissionBatchVK(std::weak_ptr<const DeviceHolder> device_holder,
+                    std::shared_ptr<QueueVK> queue,
+                    std::shared_ptr<FenceWaiterVK> fence_waiter,
+                    std::shared_ptr<TimelineWaiterVK> timeline_waiter);
+
+  ~SubmissionBatchVK();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Start collecting submissions made on the calling thread. Any
+  ///             submissions still pending from a previous frame are flushed
+  ///             first.
+  ///
+  void Begin();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Flush pending submissions and stop collecting.
+  ///
+  bool End();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Whether submissions made on the calling thread are collected.
+  ///
+  bool IsRecordingOnCurrentThread() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Add an ended command buffer to the batch.
+  ///
+  /// @param[in]  buffer    The command buffer. It must stay alive until the
+  ///                       callback is invoked.
+  /// @param[in]  callback  Invoked with true once the command buffer has
+  ///                       completed, or with false if it could not be
+  ///                       submitted.
+  ///
+  /// @return     If the command buffer was added. This fails if the batch is
+  ///             not recording on the calling thread, in which case the
+  ///             caller must submit the command buffer itself.
+  ///
+  bool Append(vk::CommandBuffer buffer, CompletionCallback callback);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Reserve the next place in the batch for a command buffer that
+  ///             will be provided later, possibly from another thread, via
+  ///             |Fulfill|.
+  ///
+  /// @param[in]  run_if_pending  Invoked on the flushing thread if the
+  ///                             reservation is still outstanding when the
+  ///                             batch is flushed. It should do the work that
+  ///                             fulfills the reservation unless that work
+  ///                             has already started elsewhere.
+  ///
+  /// @return     The reservation, or std::nullopt if the batch is not
+  ///             recording on the calling thread.
+  ///
+  std::optional<uint64_t> Reserve(fml::closure run_if_pending = nullptr);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Provide the command buffer for a reservation. May be called
+  ///             from any thread.
+  ///
+  /// @param[in]  reservation  The reservation returned by |Reserve|.
+  /// @param[in]  buffer       The ended command buffer, or a null buffer to
+  ///                          give up the reservation.
+  /// @param[in]  callback     Invoked as for |Append|. May be null if the
+  ///                          reservation is given up.
+  ///
+  /// @return     If the reservation was outstanding.
+  ///
+  bool Fulfill(uint64_t reservation,
+               vk::CommandBuffer buffer,
+               CompletionCallback callback);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Submit all pending command buffers in a single queue
+  ///             submission.
+  ///
+  /// @param[in]  trailing_info  An optional batch submitted after the pending
+  ///                            command buffers in the same call. Its
+  ///                            semaphores only apply to its own command
+  ///                            buffers.
+  /// @param[in]  fence          An optional fence signalled once the trailing
+  ///                            batch has completed.
+  ///
+  /// @return     If the submission succeeded.
+  ///
+  bool Flush(std::optional<vk::SubmitInfo> trailing_info = std::nullopt,
+             const vk::Fence& fence = {});
+
+  // Visible for testing.
+  size_t GetPendingCount() const;
+
+ private:
+  struct PendingSubmission {
+    vk::CommandBuffer buffer;
+    CompletionCallback callback;
+    // Set while the submission is reserved but not yet fulfilled.
+    std::optional<uint64_t> reservation;
+    fml::closure run_if_pending;
+  };
+
+  const std::weak_ptr<const DeviceHolder> device_holder_;
+  const std::shared_ptr<QueueVK> queue_;
+  const std::shared_ptr<FenceWaiterVK> fence_waiter_;
+  const std::shared_ptr<TimelineWaiterVK> timeline_waiter_;
+  mutable std::mutex mutex_;
+  std::condition_variable fulfilled_cv_;
+  std::optional<std::thread::id> owner_;
+  std::vector<PendingSubmission> pending_;
+  uint64_t next_reservation_ = 0u;
+  size_t outstanding_reservations_ = 0u;
+
+  // Run the work of outstanding reservations on the calling thread and wait
+  // for the rest to be fulfilled. Returns the pending submissions.
+  std::vector<PendingSubmission> TakePending();
+
+  SubmissionBatchVK(const SubmissionBatchVK&) = delete;
+
+  SubmissionBatchVK& operator=(const SubmissionBatchVK&) = delete;
+};
+
+}  // namespace impeller
+
+#endif  // FLUTTER_IMPELLER_RENDERER_BACKEND_VULKAN_SUBMISSION_BATCH_VK_H_
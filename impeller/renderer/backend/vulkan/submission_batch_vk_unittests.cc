@@ -0,0 +1,234 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <algorithm>
+#include <optional>
+#include <thread>
+
+#include "flutter/testing/testing.h"  // IWYU pragma: keep
+#include "fml/synchronization/count_down_latch.h"
+#include "fml/synchronization/waitable_event.h"
+#include "impeller/renderer/backend/vulkan/command_encoder_vk.h"
+#include "impeller/renderer/backend/vulkan/submission_batch_vk.h"
+#include "impeller/renderer/backend/vulkan/surface_vk.h"
+#include "impeller/renderer/backend/vulkan/swapchain_image_vk.h"
+#include "impeller/renderer/backend/vulkan/test/mock_vulkan.h"
+
+namespace impeller {
+namespace testing {
+
+static size_t CountQueueSubmits(const std::shared_ptr<ContextVK>& context) {
+  auto functions = GetMockVulkanFunctions(context->GetDevice());
+  return std::count(functions->begin(), functions->end(), "vkQueueSubmit");
+}
+
+TEST(SubmissionBatchVKTest, SubmitsFrameInOneCall) {
+  auto const context = MockVulkanContextBuilder().Build();
+  auto const batch = context->GetSubmissionBatch();
+  ASSERT_NE(batch, nullptr);
+  CommandEncoderFactoryVK factory(context);
+
+  batch->Begin();
+  auto latch = std::make_shared<fml::CountDownLatch>(3u);
+  for (auto i = 0; i < 3; i++) {
+    auto encoder = factory.Create();
+    ASSERT_NE(encoder, nullptr);
+    EXPECT_TRUE(encoder->Submit([latch](bool success) {
+      EXPECT_TRUE(success);
+      latch->CountDown();
+    }));
+  }
+  EXPECT_EQ(batch->GetPendingCount(), 3u);
+
+  auto const submits = CountQueueSubmits(context);
+  EXPECT_TRUE(batch->End());
+  latch->Wait();
+
+  EXPECT_EQ(batch->GetPendingCount(), 0u);
+  EXPECT_EQ(CountQueueSubmits(context), submits + 1u);
+}
+
+TEST(SubmissionBatchVKTest, SubmitsDirectlyFromOtherThreads) {
+  auto const context = MockVulkanContextBuilder().Build();
+  auto const batch = context->GetSubmissionBatch();
+  batch->Begin();
+
+  fml::AutoResetWaitableEvent submitted;
+  std::thread thread([&]() {
+    EXPECT_FALSE(batch->IsRecordingOnCurrentThread());
+    CommandEncoderFactoryVK factory(context);
+    auto encoder = factory.Create();
+    EXPECT_TRUE(encoder->Submit([&submitted](bool success) {
+      EXPECT_TRUE(success);
+      submitted.Signal();
+    }));
+  });
+  thread.join();
+  submitted.Wait();
+
+  EXPECT_EQ(batch->GetPendingCount(), 0u);
+  EXPECT_TRUE(batch->End());
+}
+
+TEST(SubmissionBatchVKTest, TrailingBatchIsSubmittedInSameCall) {
+  std::vector<std::string> extensions = {"VK_KHR_swapchain",
+                                         "VK_KHR_timeline_semaphore"};
+  auto const context =
+      MockVulkanContextBuilder().SetDeviceExtensions(extensions).Build();
+  auto const batch = context->GetSubmissionBatch();
+  CommandEncoderFactoryVK factory(context);
+
+  batch->Begin();
+  fml::AutoResetWaitableEvent completed;
+  auto encoder = factory.Create();
+  EXPECT_TRUE(encoder->Submit([&completed](bool success) {
+    EXPECT_TRUE(success);
+    completed.Signal();
+  }));
+
+  auto const submits = CountQueueSubmits(context);
+  EXPECT_TRUE(batch->Flush(vk::SubmitInfo{}));
+  EXPECT_TRUE(batch->End());
+  completed.Wait();
+
+  EXPECT_EQ(CountQueueSubmits(context), submits + 1u);
+}
+
+TEST(SubmissionBatchVKTest, FailsPendingSubmissionsIfFenceCannotBeWaitedOn) {
+  auto const context = MockVulkanContextBuilder().Build();
+  auto const batch = context->GetSubmissionBatch();
+  CommandEncoderFactoryVK factory(context);
+
+  batch->Begin();
+  bool called = false;
+  auto encoder = factory.Create();
+  EXPECT_TRUE(encoder->Submit([&called](bool success) {
+    EXPECT_FALSE(success);
+    called = true;
+  }));
+
+  // A terminated fence waiter refuses new fences.
+  context->GetFenceWaiter()->Terminate();
+  EXPECT_FALSE(batch->End());
+  EXPECT_TRUE(called);
+}
+
+TEST(SubmissionBatchVKTest, WaitUntilScheduledFlushesBatch) {
+  auto const context = MockVulkanContextBuilder().Build();
+  auto const batch = context->GetSubmissionBatch();
+  batch->Begin();
+
+  auto cmd_buffer = context->CreateCommandBuffer();
+  ASSERT_TRUE(cmd_buffer->SubmitCommands());
+  EXPECT_EQ(batch->GetPendingCount(), 1u);
+
+  cmd_buffer->WaitUntilScheduled();
+  EXPECT_EQ(batch->GetPendingCount(), 0u);
+  EXPECT_TRUE(batch->End());
+}
+
+TEST(SubmissionBatchVKTest, FlushWaitsForReservationsFulfilledElsewhere) {
+  auto const context = MockVulkanContextBuilder().Build();
+  auto const batch = context->GetSubmissionBatch();
+  batch->Begin();
+
+  auto reservation = batch->Reserve();
+  ASSERT_TRUE(reservation.has_value());
+  EXPECT_EQ(batch->GetPendingCount(), 1u);
+
+  fml::AutoResetWaitableEvent completed;
+  std::thread thread([&]() {
+    EXPECT_FALSE(batch->Reserve().has_value());
+    CommandEncoderFactoryVK factory(context);
+    auto encoder = factory.Create();
+    EXPECT_TRUE(encoder->SubmitToReservation(reservation.value()));
+    // Each reservation can only be fulfilled once.
+    EXPECT_FALSE(batch->Fulfill(reservation.value(), {}, nullptr));
+  });
+
+  auto const submits = CountQueueSubmits(context);
+  EXPECT_TRUE(batch->Flush());
+  thread.join();
+
+  EXPECT_EQ(batch->GetPendingCount(), 0u);
+  EXPECT_EQ(CountQueueSubmits(context), submits + 1u);
+  EXPECT_TRUE(batch->End());
+}
+
+TEST(SubmissionBatchVKTest, FlushRunsPendingReservationWork) {
+  auto const context = MockVulkanContextBuilder().Build();
+  auto const batch = context->GetSubmissionBatch();
+  batch->Begin();
+
+  std::optional<uint64_t> reservation;
+  auto ran = false;
+  reservation = batch->Reserve([&]() {
+    ran = true;
+    // Give up the reservation, which must not be submitted.
+    EXPECT_TRUE(batch->Fulfill(reservation.value(), {}, nullptr));
+  });
+  ASSERT_TRUE(reservation.has_value());
+
+  auto const submits = CountQueueSubmits(context);
+  EXPECT_TRUE(batch->Flush());
+  EXPECT_TRUE(ran);
+  EXPECT_EQ(batch->GetPendingCount(), 0u);
+  EXPECT_EQ(CountQueueSubmits(context), submits);
+  EXPECT_TRUE(batch->End());
+}
+
+static std::unique_ptr<Surface> WrapMockSwapchainImage(
+    const std::shared_ptr<ContextVK>& context,
+    SurfaceVK::DiscardCallback discard_callback) {
+  TextureDescriptor desc;
+  desc.format = PixelFormat::kB8G8R8A8UNormInt;
+  desc.size = {1, 1};
+  desc.usage = static_cast<TextureUsageMask>(TextureUsage::kRenderTarget);
+  auto image = std::make_shared<SwapchainImageVK>(
+      desc, context->GetDevice(), vk::Image{reinterpret_cast<VkImage>(0x1)});
+  return SurfaceVK::WrapSwapchainImage(
+      context, image, []() { return true; }, std::move(discard_callback));
+}
+
+TEST(SubmissionBatchVKTest, DiscardedSurfaceEndsBatch) {
+  auto const context = MockVulkanContextBuilder().Build();
+  auto const batch = context->GetSubmissionBatch();
+  // What the swapchain does on acquisition.
+  batch->Begin();
+  auto surface = WrapMockSwapchainImage(context, [batch]() { batch->End(); });
+  ASSERT_NE(surface, nullptr);
+
+  CommandEncoderFactoryVK factory(context);
+  fml::AutoResetWaitableEvent completed;
+  auto encoder = factory.Create();
+  EXPECT_TRUE(encoder->Submit([&completed](bool success) {
+    EXPECT_TRUE(success);
+    completed.Signal();
+  }));
+  EXPECT_EQ(batch->GetPendingCount(), 1u);
+
+  auto const submits = CountQueueSubmits(context);
+  // Drop the frame without presenting it.
+  surface.reset();
+  completed.Wait();
+
+  EXPECT_EQ(batch->GetPendingCount(), 0u);
+  EXPECT_EQ(CountQueueSubmits(context), submits + 1u);
+  EXPECT_FALSE(batch->IsRecordingOnCurrentThread());
+}
+
+TEST(SubmissionBatchVKTest, PresentedSurfaceIsNotDiscarded) {
+  auto const context = MockVulkanContextBuilder().Build();
+  auto discarded = false;
+  auto surface =
+      WrapMockSwapchainImage(context, [&discarded]() { discarded = true; });
+  ASSERT_NE(surface, nullptr);
+
+  EXPECT_TRUE(surface->Present());
+  surface.reset();
+  EXPECT_FALSE(discarded);
+}
+
+}  // namespace testing
+}  // namespace impeller
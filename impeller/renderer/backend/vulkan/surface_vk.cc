@@ -13,7 +13,8 @@ namespace impeller {
 std::unique_ptr<SurfaceVK> SurfaceVK::WrapSwapchainImage(
     const std::shared_ptr<Context>& context,
     std::shared_ptr<SwapchainImageVK>& swapchain_image,
-    SwapCallback swap_callback) {
+    SwapCallback swap_callback,
+    DiscardCallback discard_callback) {
   if (!context || !swapchain_image || !swap_callback) {
     return nullptr;
   }
@@ -71,15 +72,25 @@ std::unique_ptr<SurfaceVK> SurfaceVK::WrapSwapchainImage(
 
   // The constructor is private. So make_unique may not be used.
   return std::unique_ptr<SurfaceVK>(
-      new SurfaceVK(render_target_desc, std::move(swap_callback)));
+      new SurfaceVK(render_target_desc, std::move(swap_callback),
+                    std::move(discard_callback)));
 }
 
-SurfaceVK::SurfaceVK(const RenderTarget& target, SwapCallback swap_callback)
-    : Surface(target), swap_callback_(std::move(swap_callback)) {}
+SurfaceVK::SurfaceVK(const RenderTarget& target,
+                     SwapCallback swap_callback,
+                     DiscardCallback discard_callback)
+    : Surface(target),
+      swap_callback_(std::move(swap_callback)),
+      discard_callback_(std::move(discard_callback)) {}
 
-SurfaceVK::~SurfaceVK() = default;
+SurfaceVK::~SurfaceVK() {
+  if (discard_callback_) {
+    discard_callback_();
+  }
+}
 
 bool SurfaceVK::Present() const {
+  discard_callback_ = nullptr;
   return swap_callback_ ? swap_callback_() : false;
 }
 
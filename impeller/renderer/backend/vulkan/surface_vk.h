@@ -17,19 +17,34 @@ namespace impeller {
 class SurfaceVK final : public Surface {
  public:
   using SwapCallback = std::function<bool(void)>;
-
+  using DiscardCallback = std::function<void(void)>;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Wrap a swapchain image in a surface.
+  ///
+  /// @param[in]  context           The context.
+  /// @param[in]  swapchain_image   The acquired swapchain image.
+  /// @param[in]  swap_callback     Invoked when the surface is presented.
+  /// @param[in]  discard_callback  Invoked when the surface is destroyed
+  ///                               without having been presented.
+  ///
   static std::unique_ptr<SurfaceVK> WrapSwapchainImage(
       const std::shared_ptr<Context>& context,
       std::shared_ptr<SwapchainImageVK>& swapchain_image,
-      SwapCallback swap_callback);
+      SwapCallback swap_callback,
+      DiscardCallback discard_callback = nullptr);
 
   // |Surface|
   ~SurfaceVK() override;
 
  private:
   SwapCallback swap_callback_;
+  // Cleared once the surface is presented.
+  mutable DiscardCallback discard_callback_;
 
-  SurfaceVK(const RenderTarget& target, SwapCallback swap_callback);
+  SurfaceVK(const RenderTarget& target,
+            SwapCallback swap_callback,
+            DiscardCallback discard_callback);
 
   // |Surface|
   bool Present() const override;
@@ -4,6 +4,7 @@
 
 #include "impeller/renderer/backend/vulkan/swapchain_impl_vk.h"
 
+#include "fml/closure.h"
 #include "fml/synchronization/count_down_latch.h"
 #include "impeller/base/validation.h"
 #include "impeller/renderer/backend/vulkan/command_buffer_vk.h"
@@ -11,6 +12,7 @@
 #include "impeller/renderer/backend/vulkan/context_vk.h"
 #include "impeller/renderer/backend/vulkan/formats_vk.h"
 #include "impeller/renderer/backend/vulkan/gpu_tracer_vk.h"
+#include "impeller/renderer/backend/vulkan/submission_batch_vk.h"
 #include "impeller/renderer/backend/vulkan/surface_vk.h"
 #include "impeller/renderer/backend/vulkan/swapchain_image_vk.h"
 #include "impeller/renderer/context.h"
@@ -410,6 +412,10 @@ SwapchainImplVK::AcquireResult SwapchainImplVK::AcquireNextDrawable() {
   /// Record all subsequent cmd buffers as part of the current frame.
   context.GetGPUTracer()->MarkFrameStart();
 
+  /// Collect the command buffers of this frame so they can be submitted along
+  /// with the presentation.
+  context.GetSubmissionBatch()->Begin();
+
   auto image = images_[index % images_.size()];
   uint32_t image_index = index;
   return AcquireResult{SurfaceVK::WrapSwapchainImage(
@@ -421,7 +427,14 @@ SwapchainImplVK::AcquireResult SwapchainImplVK::AcquireNextDrawable() {
           return false;
         }
         return swapchain->Present(image, image_index);
-      }  // swap callback
+      },  // swap callback
+      [weak_context = context_]() {
+        // The frame was dropped. Submit whatever it encoded and stop
+        // collecting so that later submissions are not held back.
+        if (auto context = weak_context.lock()) {
+          ContextVK::Cast(*context).GetSubmissionBatch()->End();
+        }
+      }  // discard callback
       )};
 }
 
@@ -434,6 +447,13 @@ bool SwapchainImplVK::Present(const std::shared_ptr<SwapchainImageVK>& image,
 
   const auto& context = ContextVK::Cast(*context_strong);
   const auto& sync = synchronizers_[current_frame_];
+  auto submission_batch = context.GetSubmissionBatch();
+
+  // The batch was begun when the image was acquired. Make sure it is ended on
+  // every path out of here, else the frame's command buffers are never
+  // submitted and later submissions on this thread are held back.
+  fml::ScopedCleanupClosure end_batch(
+      [submission_batch]() { submission_batch->End(); });
 
   //----------------------------------------------------------------------------
   /// Transition the image to color-attachment-optimal.
@@ -475,11 +495,11 @@ bool SwapchainImplVK::Present(const std::shared_ptr<SwapchainImageVK>& image,
     submit_info.setWaitSemaphores(*sync->render_ready);
     submit_info.setSignalSemaphores(*sync->present_ready);
     submit_info.setCommandBuffers(vk_final_cmd_buffer);
-    auto result =
-        context.GetGraphicsQueue()->Submit(submit_info, *sync->acquire);
-    if (result != vk::Result::eSuccess) {
-      VALIDATION_LOG << "Could not wait on render semaphore: "
-                     << vk::to_string(result);
+    // The command buffers of the frame are submitted in the same call, ahead
+    // of this one.
+    auto submitted = submission_batch->Flush(submit_info, *sync->acquire);
+    if (!submitted) {
+      VALIDATION_LOG << "Could not wait on render semaphore.";
       return false;
     }
   }
@@ -180,20 +180,40 @@ void vkGetPhysicalDeviceQueueFamilyProperties(
   }
 }
 
+FML_THREAD_LOCAL std::vector<std::string> g_device_extensions;
+
 VkResult vkEnumerateDeviceExtensionProperties(
     VkPhysicalDevice physicalDevice,
     const char* pLayerName,
     uint32_t* pPropertyCount,
     VkExtensionProperties* pProperties) {
   if (!pProperties) {
-    *pPropertyCount = 1;
+    *pPropertyCount = g_device_extensions.size();
   } else {
-    strcpy(pProperties[0].extensionName, "VK_KHR_swapchain");
-    pProperties[0].specVersion = 0;
+    uint32_t count = 0;
+    for (const std::string& ext : g_device_extensions) {
+      strncpy(pProperties[count].extensionName, ext.c_str(),
+              sizeof(VkExtensionProperties::extensionName));
+      pProperties[count].specVersion = 0;
+      count++;
+    }
   }
   return VK_SUCCESS;
 }
 
+void vkGetPhysicalDeviceFeatures2(VkPhysicalDevice physicalDevice,
+                                  VkPhysicalDeviceFeatures2* pFeatures) {
+  auto next = reinterpret_cast<VkBaseOutStructure*>(pFeatures->pNext);
+  while (next) {
+    if (next->sType ==
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES) {
+      reinterpret_cast<VkPhysicalDeviceTimelineSemaphoreFeatures*>(next)
+          ->timelineSemaphore = VK_TRUE;
+    }
+    next = next->pNext;
+  }
+}
+
 VkResult vkCreateDevice(VkPhysicalDevice physicalDevice,
                         const VkDeviceCreateInfo* pCreateInfo,
                         const VkAllocationCallbacks* pAllocator,
@@ -303,6 +323,13 @@ VkResult vkCreateImageView(VkDevice device,
   return VK_SUCCESS;
 }
 
+void vkDestroyImageView(VkDevice device,
+                        VkImageView imageView,
+                        const VkAllocationCallbacks* pAllocator) {
+  MockDevice* mock_device = reinterpret_cast<MockDevice*>(device);
+  mock_device->AddCalledFunction("vkDestroyImageView");
+}
+
 VkResult vkCreateBuffer(VkDevice device,
                         const VkBufferCreateInfo* pCreateInfo,
                         const VkAllocationCallbacks* pAllocator,
@@ -472,10 +499,75 @@ VkResult vkDestroyFence(VkDevice device,
   return VK_SUCCESS;
 }
 
+VkResult vkCreateSemaphore(VkDevice device,
+                           const VkSemaphoreCreateInfo* pCreateInfo,
+                           const VkAllocationCallbacks* pAllocator,
+                           VkSemaphore* pSemaphore) {
+  *pSemaphore = reinterpret_cast<VkSemaphore>(new MockSemaphore());
+  return VK_SUCCESS;
+}
+
+void vkDestroySemaphore(VkDevice device,
+                        VkSemaphore semaphore,
+                        const VkAllocationCallbacks* pAllocator) {
+  delete reinterpret_cast<MockSemaphore*>(semaphore);
+}
+
+void vkGetDeviceQueue(VkDevice device,
+                      uint32_t queueFamilyIndex,
+                      uint32_t queueIndex,
+                      VkQueue* pQueue) {
+  // Queues record their calls on the device they belong to.
+  *pQueue = reinterpret_cast<VkQueue>(device);
+}
+
+FML_THREAD_LOCAL bool g_submissions_complete = true;
+
 VkResult vkQueueSubmit(VkQueue queue,
                        uint32_t submitCount,
                        const VkSubmitInfo* pSubmits,
                        VkFence fence) {
+  if (queue) {
+    reinterpret_cast<MockDevice*>(queue)->AddCalledFunction("vkQueueSubmit");
+  }
+  if (!g_submissions_complete) {
+    return VK_SUCCESS;
+  }
+  // Submissions complete immediately, signal any timeline semaphores.
+  for (auto i = 0u; i < submitCount; i++) {
+    auto next = reinterpret_cast<const VkBaseInStructure*>(pSubmits[i].pNext);
+    while (next) {
+      if (next->sType == VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO) {
+        auto timeline_info =
+            reinterpret_cast<const VkTimelineSemaphoreSubmitInfo*>(next);
+        for (auto j = 0u; j < timeline_info->signalSemaphoreValueCount; j++) {
+          reinterpret_cast<MockSemaphore*>(pSubmits[i].pSignalSemaphores[j])
+              ->SetValue(timeline_info->pSignalSemaphoreValues[j]);
+        }
+      }
+      next = next->pNext;
+    }
+  }
+  return VK_SUCCESS;
+}
+
+VkResult vkGetSemaphoreCounterValue(VkDevice device,
+                                    VkSemaphore semaphore,
+                                    uint64_t* pValue) {
+  *pValue = reinterpret_cast<MockSemaphore*>(semaphore)->GetValue();
+  return VK_SUCCESS;
+}
+
+VkResult vkWaitSemaphores(VkDevice device,
+                          const VkSemaphoreWaitInfo* pWaitInfo,
+                          uint64_t timeout) {
+  for (auto i = 0u; i < pWaitInfo->semaphoreCount; i++) {
+    auto semaphore =
+        reinterpret_cast<MockSemaphore*>(pWaitInfo->pSemaphores[i]);
+    if (semaphore->GetValue() < pWaitInfo->pValues[i]) {
+      return VK_TIMEOUT;
+    }
+  }
   return VK_SUCCESS;
 }
 
@@ -616,6 +708,8 @@ PFN_vkVoidFunction GetMockVulkanProcAddress(VkInstance instance,
     return (PFN_vkVoidFunction)vkBindImageMemory;
   } else if (strcmp("vkCreateImageView", pName) == 0) {
     return (PFN_vkVoidFunction)vkCreateImageView;
+  } else if (strcmp("vkDestroyImageView", pName) == 0) {
+    return (PFN_vkVoidFunction)vkDestroyImageView;
   } else if (strcmp("vkCreateBuffer", pName) == 0) {
     return (PFN_vkVoidFunction)vkCreateBuffer;
   } else if (strcmp("vkGetBufferMemoryRequirements2KHR", pName) == 0 ||
@@ -659,8 +753,23 @@ PFN_vkVoidFunction GetMockVulkanProcAddress(VkInstance instance,
     return (PFN_vkVoidFunction)vkCreateFence;
   } else if (strcmp("vkDestroyFence", pName) == 0) {
     return (PFN_vkVoidFunction)vkDestroyFence;
+  } else if (strcmp("vkGetDeviceQueue", pName) == 0) {
+    return (PFN_vkVoidFunction)vkGetDeviceQueue;
   } else if (strcmp("vkQueueSubmit", pName) == 0) {
     return (PFN_vkVoidFunction)vkQueueSubmit;
+  } else if (strcmp("vkCreateSemaphore", pName) == 0) {
+    return (PFN_vkVoidFunction)vkCreateSemaphore;
+  } else if (strcmp("vkDestroySemaphore", pName) == 0) {
+    return (PFN_vkVoidFunction)vkDestroySemaphore;
+  } else if (strcmp("vkGetSemaphoreCounterValueKHR", pName) == 0 ||
+             strcmp("vkGetSemaphoreCounterValue", pName) == 0) {
+    return (PFN_vkVoidFunction)vkGetSemaphoreCounterValue;
+  } else if (strcmp("vkWaitSemaphoresKHR", pName) == 0 ||
+             strcmp("vkWaitSemaphores", pName) == 0) {
+    return (PFN_vkVoidFunction)vkWaitSemaphores;
+  } else if (strcmp("vkGetPhysicalDeviceFeatures2KHR", pName) == 0 ||
+             strcmp("vkGetPhysicalDeviceFeatures2", pName) == 0) {
+    return (PFN_vkVoidFunction)vkGetPhysicalDeviceFeatures2;
   } else if (strcmp("vkWaitForFences", pName) == 0) {
     return (PFN_vkVoidFunction)vkWaitForFences;
   } else if (strcmp("vkGetFenceStatus", pName) == 0) {
@@ -686,7 +795,8 @@ PFN_vkVoidFunction GetMockVulkanProcAddress(VkInstance instance,
 }  // namespace
 
 MockVulkanContextBuilder::MockVulkanContextBuilder()
-    : instance_extensions_({"VK_KHR_surface", "VK_MVK_macos_surface"}) {}
+    : instance_extensions_({"VK_KHR_surface", "VK_MVK_macos_surface"}),
+      device_extensions_({"VK_KHR_swapchain"}) {}
 
 std::shared_ptr<ContextVK> MockVulkanContextBuilder::Build() {
   auto message_loop = fml::ConcurrentMessageLoop::Create();
@@ -697,6 +807,8 @@ std::shared_ptr<ContextVK> MockVulkanContextBuilder::Build() {
   }
   g_instance_extensions = instance_extensions_;
   g_instance_layers = instance_layers_;
+  g_device_extensions = device_extensions_;
+  g_submissions_complete = submissions_complete_;
   std::shared_ptr<ContextVK> result = ContextVK::Create(std::move(settings));
   return result;
 }
@@ -55,6 +55,23 @@ class MockFence final {
   MockFence& operator=(const MockFence&) = delete;
 };
 
+// A test-controlled version of a timeline |vk::Semaphore|.
+class MockSemaphore final {
+ public:
+  MockSemaphore() = default;
+
+  uint64_t GetValue() const { return value_.load(); }
+
+  void SetValue(uint64_t value) { value_ = value; }
+
+ private:
+  std::atomic<uint64_t> value_ = 0u;
+
+  MockSemaphore(const MockSemaphore&) = delete;
+
+  MockSemaphore& operator=(const MockSemaphore&) = delete;
+};
+
 class MockVulkanContextBuilder {
  public:
   MockVulkanContextBuilder();
@@ -88,10 +105,25 @@ class MockVulkanContextBuilder {
     return *this;
   }
 
+  MockVulkanContextBuilder& SetDeviceExtensions(
+      const std::vector<std::string>& device_extensions) {
+    device_extensions_ = device_extensions;
+    return *this;
+  }
+
+  /// Whether queue submissions complete and signal their timeline semaphores.
+  /// Defaults to true.
+  MockVulkanContextBuilder& SetSubmissionsComplete(bool submissions_complete) {
+    submissions_complete_ = submissions_complete;
+    return *this;
+  }
+
  private:
   std::function<void(ContextVK::Settings&)> settings_callback_;
   std::vector<std::string> instance_extensions_;
   std::vector<std::string> instance_layers_;
+  std::vector<std::string> device_extensions_;
+  bool submissions_complete_ = true;
 };
 
 }  // namespace testing
@@ -83,8 +83,10 @@ bool TextureVK::OnSetContents(const uint8_t* contents,
     return false;
   }
 
+  const auto& staging_buffer_vk = DeviceBufferVK::Cast(*staging_buffer);
+
   vk::BufferImageCopy copy;
-  copy.bufferOffset = 0u;
+  copy.bufferOffset = staging_buffer_vk.GetBufferOffset();
   copy.bufferRowLength = 0u;    // 0u means tightly packed per spec.
   copy.bufferImageHeight = 0u;  // 0u means tightly packed per spec.
   copy.imageOffset.x = 0u;
@@ -100,7 +102,7 @@ bool TextureVK::OnSetContents(const uint8_t* contents,
   copy.imageSubresource.layerCount = 1u;
 
   vk_cmd_buffer.copyBufferToImage(
-      DeviceBufferVK::Cast(*staging_buffer).GetBuffer(),  // src buffer
+      staging_buffer_vk.GetBuffer(),                      // src buffer
       GetImage(),                                         // dst image
       barrier.new_layout,                                 // dst image layout
       1u,                                                 // region count
@@ -0,0 +1,238 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "impeller/renderer/backend/vulkan/timeline_waiter_vk.h"
+
+#include <chrono>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "flutter/fml/cpu_affinity.h"
+#include "flutter/fml/logging.h"
+#include "flutter/fml/thread.h"
+#include "flutter/fml/trace_event.h"
+#include "impeller/base/validation.h"
+
+namespace impeller {
+
+// How long the waiter thread keeps waiting on pending submissions once the
+// waiter has been terminated.
+static constexpr std::chrono::milliseconds kTerminateDrainTimeout{1000};
+
+TimelineWaiterVK::TimelineWaiterVK(std::weak_ptr<DeviceHolder> device_holder,
+                                   std::shared_ptr<QueueVK> queue)
+    : device_holder_(std::move(device_holder)), queue_(std::move(queue)) {
+  auto strong_device = device_holder_.lock();
+  if (!strong_device || !queue_) {
+    return;
+  }
+
+  vk::StructureChain<vk::SemaphoreCreateInfo, vk::SemaphoreTypeCreateInfoKHR>
+      semaphore_chain;
+  auto& type_info = semaphore_chain.get<vk::SemaphoreTypeCreateInfoKHR>();
+  type_info.setSemaphoreType(vk::SemaphoreType::eTimeline);
+  type_info.setInitialValue(0u);
+
+  auto [result, semaphore] = strong_device->GetDevice().createSemaphoreUnique(
+      semaphore_chain.get<vk::SemaphoreCreateInfo>());
+  if (result != vk::Result::eSuccess) {
+    VALIDATION_LOG << "Could not create timeline semaphore: "
+                   << vk::to_string(result);
+    return;
+  }
+  semaphore_ = std::move(semaphore);
+  waiter_thread_ = std::make_unique<std::thread>([&]() { Main(); });
+  is_valid_ = true;
+}
+
+TimelineWaiterVK::~TimelineWaiterVK() {
+  Terminate();
+  if (waiter_thread_) {
+    waiter_thread_->join();
+  }
+  // A submission racing with |Terminate| may have been added after the waiter
+  // thread exited.
+  RetireAllPendingCallbacks();
+}
+
+bool TimelineWaiterVK::IsValid() const {
+  return is_valid_;
+}
+
+vk::Result TimelineWaiterVK::Submit(vk::SubmitInfo submit_info,
+                                    const fml::closure& callback) {
+  return SubmitBatches({submit_info}, callback);
+}
+
+vk::Result TimelineWaiterVK::SubmitBatches(
+    std::vector<vk::SubmitInfo> submit_infos,
+    const fml::closure& callback,
+    const vk::Fence& fence) {
+  if (!IsValid() || submit_infos.empty()) {
+    return vk::Result::eErrorInitializationFailed;
+  }
+
+  std::scoped_lock submit_lock(submit_mutex_);
+  {
+    std::scoped_lock lock(pending_mutex_);
+    if (terminate_) {
+      return vk::Result::eErrorDeviceLost;
+    }
+  }
+  const uint64_t value = last_submitted_value_ + 1u;
+
+  // Batches complete in submission order, so only the last one needs to
+  // signal the timeline. Any binary semaphores signalled by the caller ignore
+  // their values, but the value count must match the semaphore count.
+  auto& submit_info = submit_infos.back();
+  std::vector<vk::Semaphore> signal_semaphores(
+      submit_info.pSignalSemaphores,
+      submit_info.pSignalSemaphores + submit_info.signalSemaphoreCount);
+  signal_semaphores.push_back(semaphore_.get());
+  std::vector<uint64_t> signal_values(signal_semaphores.size(), 0u);
+  signal_values.back() = value;
+
+  vk::TimelineSemaphoreSubmitInfoKHR timeline_info;
+  timeline_info.setSignalSemaphoreValues(signal_values);
+  timeline_info.setPNext(submit_info.pNext);
+  submit_info.setSignalSemaphores(signal_semaphores);
+  submit_info.setPNext(&timeline_info);
+
+  auto result = queue_->Submit(submit_infos, fence);
+  if (result != vk::Result::eSuccess) {
+    return result;
+  }
+
+  {
+    std::scoped_lock lock(pending_mutex_);
+    last_submitted_value_ = value;
+    if (callback) {
+      pending_.push_back(PendingCallback{
+          .value = value,
+          .callback = fml::ScopedCleanupClosure(callback),
+      });
+    }
+  }
+  pending_cv_.notify_one();
+  return vk::Result::eSuccess;
+}
+
+uint64_t TimelineWaiterVK::GetLastSubmittedValue() const {
+  std::scoped_lock lock(pending_mutex_);
+  return last_submitted_value_;
+}
+
+void TimelineWaiterVK::Main() {
+  fml::Thread::SetCurrentThreadName(
+      fml::Thread::ThreadConfig{"io.flutter.impeller.timeline_waiter"});
+  // Since this thread mostly waits on the semaphore, it doesn't need to be
+  // fast.
+  fml::RequestAffinity(fml::CpuAffinity::kEfficiency);
+
+  std::optional<std::chrono::steady_clock::time_point> drain_deadline;
+  while (true) {
+    uint64_t wait_value = 0u;
+    {
+      std::unique_lock lock(pending_mutex_);
+      pending_cv_.wait(lock,
+                       [&]() { return !pending_.empty() || terminate_; });
+      if (pending_.empty()) {
+        break;
+      }
+      // Once terminated, keep going until every pending callback is retired,
+      // but don't wait forever on a submission that is never going to
+      // complete (for instance, if the device was lost).
+      if (terminate_) {
+        const auto now = std::chrono::steady_clock::now();
+        if (!drain_deadline.has_value()) {
+          drain_deadline = now + kTerminateDrainTimeout;
+        } else if (now >= drain_deadline.value()) {
+          FML_LOG(ERROR) << "Timeline waiter gave up on " << pending_.size()
+                         << " submission(s) that did not complete.";
+          break;
+        }
+      }
+      wait_value = pending_.front().value;
+    }
+
+    if (!Wait(wait_value)) {
+      break;
+    }
+  }
+
+  // Whatever is left is never going to be retired by the semaphore. Still run
+  // the callbacks so that the resources they hold on to are released.
+  RetireAllPendingCallbacks();
+}
+
+void TimelineWaiterVK::RetireAllPendingCallbacks() {
+  std::deque<PendingCallback> abandoned;
+  {
+    std::scoped_lock lock(pending_mutex_);
+    abandoned.swap(pending_);
+  }
+  abandoned.clear();
+}
+
+bool TimelineWaiterVK::Wait(uint64_t value) {
+  using namespace std::literals::chrono_literals;
+
+  // Check if the context had died in the meantime.
+  auto device_holder = device_holder_.lock();
+  if (!device_holder) {
+    return false;
+  }
+  const auto& device = device_holder->GetDevice();
+
+  // Wait for the oldest pending submission. If it is going to be signaled at
+  // an abnormally long deadline, a timeout will bail out the wait.
+  vk::SemaphoreWaitInfoKHR wait_info;
+  wait_info.setSemaphores(semaphore_.get());
+  wait_info.setValues(value);
+  auto result = device.waitSemaphoresKHR(
+      wait_info, /*timeout=*/std::chrono::nanoseconds{100ms}.count());
+  if (!(result == vk::Result::eSuccess || result == vk::Result::eTimeout)) {
+    VALIDATION_LOG << "Timeline waiter encountered an unexpected error. "
+                      "Tearing down the waiter thread.";
+    return false;
+  }
+
+  auto [counter_result, completed_value] =
+      device.getSemaphoreCounterValueKHR(semaphore_.get());
+  if (counter_result != vk::Result::eSuccess) {
+    VALIDATION_LOG << "Could not read the timeline semaphore value: "
+                   << vk::to_string(counter_result);
+    return false;
+  }
+
+  // Every submission up to the counter value has completed, not just the one
+  // waited on. Retire all of them at once, outside the lock since the
+  // callbacks might touch allocators.
+  std::deque<PendingCallback> retired;
+  {
+    std::scoped_lock lock(pending_mutex_);
+    while (!pending_.empty() && pending_.front().value <= completed_value) {
+      retired.push_back(std::move(pending_.front()));
+      pending_.pop_front();
+    }
+  }
+
+  {
+    TRACE_EVENT0("impeller", "RetireTimelineSubmissions");
+    retired.clear();
+  }
+
+  return true;
+}
+
+void TimelineWaiterVK::Terminate() {
+  {
+    std::scoped_lock lock(pending_mutex_);
+    terminate_ = true;
+  }
+  pending_cv_.notify_one();
+}
+
+}  // namespace impeller
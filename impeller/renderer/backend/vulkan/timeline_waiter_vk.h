@@ -0,0 +1,109 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_IMPELLER_RENDERER_BACKEND_VULKAN_TIMELINE_WAITER_VK_H_
+#define FLUTTER_IMPELLER_RENDERER_BACKEND_VULKAN_TIMELINE_WAITER_VK_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "flutter/fml/closure.h"
+#include "impeller/renderer/backend/vulkan/device_holder.h"
+#include "impeller/renderer/backend/vulkan/queue_vk.h"
+#include "impeller/renderer/backend/vulkan/vk.h"
+
+namespace impeller {
+
+//------------------------------------------------------------------------------
+/// @brief      Tracks the completion of submissions to a single queue using a
+///             timeline semaphore instead of a fence per submission.
+///
+///             Every submission signals the next value of a monotonically
+///             increasing counter. Callbacks are tagged with that value and
+///             are all invoked together once the counter reaches it, so a
+///             single wakeup retires every submission that completed in the
+///             meantime.
+///
+///             Only created by |ContextVK| when the device supports
+///             VK_KHR_timeline_semaphore. Otherwise |FenceWaiterVK| is used.
+///
+class TimelineWaiterVK {
+ public:
+  ~TimelineWaiterVK();
+
+  bool IsValid() const;
+
+  void Terminate();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Submit to the queue, signalling the next value of the
+  ///             timeline, and invoke the callback once the submission has
+  ///             completed.
+  ///
+  ///             The callback is invoked even if the submission never
+  ///             completes. Once the waiter is terminated, pending
+  ///             submissions are given a bounded amount of time to complete
+  ///             before their callbacks are invoked anyway. Callbacks are
+  ///             usually invoked on the waiter thread, but may also be invoked
+  ///             on the thread that destroys the waiter.
+  ///
+  vk::Result Submit(vk::SubmitInfo submit_info, const fml::closure& callback);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Submit several batches to the queue in one call. The last
+  ///             batch signals the timeline, and the optional fence is
+  ///             signalled along with it.
+  ///
+  vk::Result SubmitBatches(std::vector<vk::SubmitInfo> submit_infos,
+                           const fml::closure& callback,
+                           const vk::Fence& fence = {});
+
+  // Visible for testing.
+  uint64_t GetLastSubmittedValue() const;
+
+ private:
+  friend class ContextVK;
+
+  struct PendingCallback {
+    uint64_t value;
+    fml::ScopedCleanupClosure callback;
+  };
+
+  std::weak_ptr<DeviceHolder> device_holder_;
+  std::shared_ptr<QueueVK> queue_;
+  vk::UniqueSemaphore semaphore_;
+  std::unique_ptr<std::thread> waiter_thread_;
+  // Held while submitting so that the signalled values increase in the order
+  // the queue executes them.
+  std::mutex submit_mutex_;
+  mutable std::mutex pending_mutex_;
+  std::condition_variable pending_cv_;
+  // Ordered by value.
+  std::deque<PendingCallback> pending_;
+  uint64_t last_submitted_value_ = 0u;
+  bool terminate_ = false;
+  bool is_valid_ = false;
+
+  TimelineWaiterVK(std::weak_ptr<DeviceHolder> device_holder,
+                   std::shared_ptr<QueueVK> queue);
+
+  void Main();
+
+  bool Wait(uint64_t value);
+
+  void RetireAllPendingCallbacks();
+
+  TimelineWaiterVK(const TimelineWaiterVK&) = delete;
+
+  TimelineWaiterVK& operator=(const TimelineWaiterVK&) = delete;
+};
+
+}  // namespace impeller
+
+#endif  // FLUTTER_IMPELLER_RENDERER_BACKEND_VULKAN_TIMELINE_WAITER_VK_H_
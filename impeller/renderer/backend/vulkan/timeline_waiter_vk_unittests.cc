@@ -0,0 +1,99 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "fml/synchronization/waitable_event.h"
+#include "gtest/gtest.h"  // IWYU pragma: keep
+#include "impeller/renderer/backend/vulkan/command_encoder_vk.h"
+#include "impeller/renderer/backend/vulkan/test/mock_vulkan.h"
+#include "impeller/renderer/backend/vulkan/timeline_waiter_vk.h"  // IWYU pragma: keep
+
+namespace impeller {
+namespace testing {
+
+static std::shared_ptr<ContextVK> CreateContextWithTimelineSemaphores() {
+  return MockVulkanContextBuilder()
+      .SetDeviceExtensions({"VK_KHR_swapchain", "VK_KHR_timeline_semaphore"})
+      .Build();
+}
+
+TEST(TimelineWaiterVKTest, IsNotCreatedWithoutTimelineSemaphores) {
+  auto const context = MockVulkanContextBuilder().Build();
+  EXPECT_EQ(context->GetTimelineWaiter(), nullptr);
+}
+
+TEST(TimelineWaiterVKTest, IsCreatedWithTimelineSemaphores) {
+  auto const context = CreateContextWithTimelineSemaphores();
+  ASSERT_NE(context->GetTimelineWaiter(), nullptr);
+  EXPECT_TRUE(context->GetTimelineWaiter()->IsValid());
+}
+
+TEST(TimelineWaiterVKTest, SubmissionsSignalIncreasingValues) {
+  auto const context = CreateContextWithTimelineSemaphores();
+  auto const waiter = context->GetTimelineWaiter();
+  ASSERT_NE(waiter, nullptr);
+
+  EXPECT_EQ(waiter->GetLastSubmittedValue(), 0u);
+  EXPECT_EQ(waiter->Submit({}, nullptr), vk::Result::eSuccess);
+  EXPECT_EQ(waiter->GetLastSubmittedValue(), 1u);
+  EXPECT_EQ(waiter->Submit({}, nullptr), vk::Result::eSuccess);
+  EXPECT_EQ(waiter->GetLastSubmittedValue(), 2u);
+}
+
+TEST(TimelineWaiterVKTest, ExecutesCallbacksOnceValueIsReached) {
+  auto const context = CreateContextWithTimelineSemaphores();
+  auto const waiter = context->GetTimelineWaiter();
+  ASSERT_NE(waiter, nullptr);
+
+  auto signal = fml::ManualResetWaitableEvent();
+  auto signal2 = fml::ManualResetWaitableEvent();
+  waiter->Submit({}, [&signal]() { signal.Signal(); });
+  waiter->Submit({}, [&signal2]() { signal2.Signal(); });
+
+  signal.Wait();
+  signal2.Wait();
+}
+
+TEST(TimelineWaiterVKTest, CommandEncoderSubmitsOnTimeline) {
+  auto const context = CreateContextWithTimelineSemaphores();
+  auto const waiter = context->GetTimelineWaiter();
+  ASSERT_NE(waiter, nullptr);
+
+  CommandEncoderFactoryVK factory(context);
+  auto encoder = factory.Create();
+  ASSERT_NE(encoder, nullptr);
+
+  auto signal = fml::ManualResetWaitableEvent();
+  bool success = false;
+  EXPECT_TRUE(encoder->Submit([&signal, &success](bool result) {
+    success = result;
+    signal.Signal();
+  }));
+  signal.Wait();
+
+  EXPECT_TRUE(success);
+  EXPECT_EQ(waiter->GetLastSubmittedValue(), 1u);
+}
+
+TEST(TimelineWaiterVKTest, ExecutesCallbacksOfSubmissionsThatNeverComplete) {
+  auto const context = MockVulkanContextBuilder()
+                           .SetDeviceExtensions({"VK_KHR_swapchain",
+                                                 "VK_KHR_timeline_semaphore"})
+                           .SetSubmissionsComplete(false)
+                           .Build();
+  ASSERT_NE(context->GetTimelineWaiter(), nullptr);
+
+  bool called = false;
+  EXPECT_EQ(
+      context->GetTimelineWaiter()->Submit({}, [&called]() { called = true; }),
+      vk::Result::eSuccess);
+  EXPECT_FALSE(called);
+
+  // Tearing down the waiter must not hang on the submission, and must still
+  // invoke its callback.
+  context->Shutdown();
+  EXPECT_TRUE(called);
+}
+
+}  // namespace testing
+}  // namespace impeller
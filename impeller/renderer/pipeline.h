@@ -5,6 +5,7 @@
 #ifndef FLUTTER_IMPELLER_RENDERER_PIPELINE_H_
 #define FLUTTER_IMPELLER_RENDERER_PIPELINE_H_
 
+#include <chrono>
 #include <future>
 
 #include "compute_pipeline_descriptor.h"
@@ -28,6 +29,13 @@ struct PipelineFuture {
   const std::shared_ptr<Pipeline<T>> Get() const { return future.get(); }
 
   bool IsValid() const { return future.valid(); }
+
+  /// Whether the pipeline has finished compiling (successfully or not), so
+  /// that |Get| returns without blocking.
+  bool IsReady() const {
+    return IsValid() && future.wait_for(std::chrono::seconds(0)) ==
+                            std::future_status::ready;
+  }
 };
 
 //------------------------------------------------------------------------------
@@ -32,4 +32,11 @@ PipelineFuture<ComputePipelineDescriptor> PipelineLibrary::GetPipeline(
   return {descriptor, promise->get_future()};
 }
 
+std::shared_ptr<fml::Mapping> PipelineLibrary::LoadVariantManifest() const {
+  return nullptr;
+}
+
+void PipelineLibrary::SetVariantManifestProvider(
+    VariantManifestProvider provider) {}
+
 }  // namespace impeller
@@ -5,10 +5,12 @@
 #ifndef FLUTTER_IMPELLER_RENDERER_PIPELINE_LIBRARY_H_
 #define FLUTTER_IMPELLER_RENDERER_PIPELINE_LIBRARY_H_
 
+#include <functional>
 #include <optional>
 
 #include "compute_pipeline_descriptor.h"
 #include "flutter/fml/macros.h"
+#include "flutter/fml/mapping.h"
 #include "impeller/renderer/pipeline.h"
 #include "impeller/renderer/pipeline_descriptor.h"
 
@@ -29,6 +31,9 @@ using ComputePipelineMap =
 
 class PipelineLibrary : public std::enable_shared_from_this<PipelineLibrary> {
  public:
+  using VariantManifestProvider =
+      std::function<std::shared_ptr<fml::Mapping>()>;
+
   virtual ~PipelineLibrary();
 
   PipelineFuture<PipelineDescriptor> GetPipeline(
@@ -48,6 +53,22 @@ class PipelineLibrary : public std::enable_shared_from_this<PipelineLibrary> {
   virtual void RemovePipelinesWithEntryPoint(
       std::shared_ptr<const ShaderFunction> function) = 0;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Load the manifest of pipeline variants persisted along with
+  ///             the pipeline cache of a previous launch.
+  ///
+  /// @return     The manifest, or `nullptr` if there is none or the backend
+  ///             does not persist its pipeline cache.
+  ///
+  virtual std::shared_ptr<fml::Mapping> LoadVariantManifest() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Set the callback invoked to get the manifest of pipeline
+  ///             variants to persist whenever the pipeline cache is persisted.
+  ///             It may be invoked on any thread.
+  ///
+  virtual void SetVariantManifestProvider(VariantManifestProvider provider);
+
  protected:
   PipelineLibrary();
 
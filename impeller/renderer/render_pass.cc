@@ -65,6 +65,17 @@ bool RenderPass::AddCommand(Command&& command) {
     return false;
   }
 
+  if (scissor_.has_value()) {
+    auto scissor = command.scissor.has_value()
+                       ? command.scissor->Intersection(scissor_.value())
+                       : scissor_;
+    if (!scissor.has_value()) {
+      // Nothing would be drawn.
+      return true;
+    }
+    command.scissor = scissor;
+  }
+
   if (command.scissor.has_value()) {
     auto target_rect = IRect::MakeSize(render_target_.GetRenderTargetSize());
     if (!target_rect.Contains(command.scissor.value())) {
@@ -85,6 +96,14 @@ bool RenderPass::AddCommand(Command&& command) {
   return true;
 }
 
+void RenderPass::SetScissor(std::optional<IRect> scissor) {
+  scissor_ = scissor;
+}
+
+const std::optional<IRect>& RenderPass::GetScissor() const {
+  return scissor_;
+}
+
 bool RenderPass::EncodeCommands() const {
   auto context = context_.lock();
   // The context could have been collected in the meantime.
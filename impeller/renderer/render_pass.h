@@ -60,6 +60,21 @@ class RenderPass {
   ///
   bool AddCommand(Command&& command);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Restrict the commands added to this pass from now on to the
+  ///             given rectangle, in addition to their own scissor.
+  ///
+  ///             Commands whose scissor doesn't intersect the rectangle are
+  ///             dropped.
+  ///
+  /// @param[in]  scissor  The rectangle, which must lie within the render
+  ///                      target, or std::nullopt to stop restricting
+  ///                      commands.
+  ///
+  void SetScissor(std::optional<IRect> scissor);
+
+  const std::optional<IRect>& GetScissor() const;
+
   //----------------------------------------------------------------------------
   /// @brief      Encode the recorded commands to the underlying command buffer.
   ///
@@ -101,6 +116,7 @@ class RenderPass {
   const RenderTarget render_target_;
   std::shared_ptr<HostBuffer> transients_buffer_;
   std::vector<Command> commands_;
+  std::optional<IRect> scissor_;
 
   RenderPass(std::weak_ptr<const Context> context, const RenderTarget& target);
 
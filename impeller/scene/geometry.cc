@@ -6,6 +6,7 @@
 
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <ostream>
 
 #include "impeller/core/device_buffer_descriptor.h"
@@ -16,6 +17,7 @@
 #include "impeller/geometry/vector.h"
 #include "impeller/renderer/sampler_library.h"
 #include "impeller/renderer/vertex_buffer_builder.h"
+#include "impeller/scene/importer/conversions.h"
 #include "impeller/scene/importer/scene_flatbuffers.h"
 #include "impeller/scene/shaders/skinned.vert.h"
 #include "impeller/scene/shaders/unskinned.vert.h"
@@ -27,6 +29,34 @@ namespace scene {
 /// Geometry
 ///
 
+//------------------------------------------------------------------------------
+/// BoundingBox
+///
+
+bool BoundingBox::IntersectsFrustum(const Matrix& mvp) const {
+  // Count the corners outside each clip plane. Clip space depth is in [0, w].
+  int outside_left = 0, outside_right = 0, outside_bottom = 0, outside_top = 0,
+      outside_near = 0, outside_far = 0;
+  for (int i = 0; i < 8; i++) {
+    Vector4 corner = mvp * Vector4((i & 1) ? max.x : min.x,  //
+                                   (i & 2) ? max.y : min.y,  //
+                                   (i & 4) ? max.z : min.z,  //
+                                   1.0f);
+    outside_left += corner.x < -corner.w;
+    outside_right += corner.x > corner.w;
+    outside_bottom += corner.y < -corner.w;
+    outside_top += corner.y > corner.w;
+    outside_near += corner.z < 0.0f;
+    outside_far += corner.z > corner.w;
+  }
+  return outside_left < 8 && outside_right < 8 && outside_bottom < 8 &&
+         outside_top < 8 && outside_near < 8 && outside_far < 8;
+}
+
+//------------------------------------------------------------------------------
+/// Geometry
+///
+
 Geometry::~Geometry() = default;
 
 std::shared_ptr<CuboidGeometry> Geometry::MakeCuboid(Vector3 size) {
@@ -35,8 +65,10 @@ std::shared_ptr<CuboidGeometry> Geometry::MakeCuboid(Vector3 size) {
   return result;
 }
 
-std::shared_ptr<Geometry> Geometry::MakeVertexBuffer(VertexBuffer vertex_buffer,
-                                                     bool is_skinned) {
+std::shared_ptr<Geometry> Geometry::MakeVertexBuffer(
+    VertexBuffer vertex_buffer,
+    bool is_skinned,
+    std::optional<BoundingBox> bounds) {
   if (is_skinned) {
     auto result = std::make_shared<SkinnedVertexBufferGeometry>();
     result->SetVertexBuffer(std::move(vertex_buffer));
@@ -44,6 +76,7 @@ std::shared_ptr<Geometry> Geometry::MakeVertexBuffer(VertexBuffer vertex_buffer,
   } else {
     auto result = std::make_shared<UnskinnedVertexBufferGeometry>();
     result->SetVertexBuffer(std::move(vertex_buffer));
+    result->SetBounds(bounds);
     return result;
   }
 }
@@ -64,6 +97,7 @@ std::shared_ptr<Geometry> Geometry::MakeFromFlatbuffer(
   const uint8_t* vertices_start;
   size_t vertices_bytes;
   bool is_skinned;
+  std::optional<BoundingBox> bounds;
 
   switch (mesh.vertices_type()) {
     case fb::VertexBuffer::UnskinnedVertexBuffer: {
@@ -72,6 +106,13 @@ std::shared_ptr<Geometry> Geometry::MakeFromFlatbuffer(
       vertices_start = reinterpret_cast<const uint8_t*>(vertices->Get(0));
       vertices_bytes = vertices->size() * sizeof(fb::Vertex);
       is_skinned = false;
+      for (const auto* vertex : *vertices) {
+        auto position = importer::ToVector3(vertex->position());
+        bounds = bounds.has_value()
+                     ? BoundingBox{.min = bounds->min.Min(position),
+                                   .max = bounds->max.Max(position)}
+                     : BoundingBox{.min = position, .max = position};
+      }
       break;
     }
     case fb::VertexBuffer::SkinnedVertexBuffer: {
@@ -116,7 +157,11 @@ std::shared_ptr<Geometry> Geometry::MakeFromFlatbuffer(
       .vertex_count = mesh.indices()->count(),
       .index_type = index_type,
   };
-  return MakeVertexBuffer(std::move(vertex_buffer), is_skinned);
+  return MakeVertexBuffer(std::move(vertex_buffer), is_skinned, bounds);
+}
+
+std::optional<BoundingBox> Geometry::GetBounds() const {
+  return std::nullopt;
 }
 
 void Geometry::SetJointsTexture(const std::shared_ptr<Texture>& texture) {}
@@ -160,6 +205,11 @@ VertexBuffer CuboidGeometry::GetVertexBuffer(Allocator& allocator) const {
   return builder.CreateVertexBuffer(allocator);
 }
 
+// |Geometry|
+std::optional<BoundingBox> CuboidGeometry::GetBounds() const {
+  return BoundingBox{.min = Vector3(0, 0, 0), .max = Vector3(1, 1, 0)};
+}
+
 // |Geometry|
 void CuboidGeometry::BindToCommand(const SceneContext& scene_context,
                                    HostBuffer& buffer,
@@ -186,6 +236,11 @@ void UnskinnedVertexBufferGeometry::SetVertexBuffer(
   vertex_buffer_ = std::move(vertex_buffer);
 }
 
+void UnskinnedVertexBufferGeometry::SetBounds(
+    std::optional<BoundingBox> bounds) {
+  bounds_ = bounds;
+}
+
 // |Geometry|
 GeometryType UnskinnedVertexBufferGeometry::GetGeometryType() const {
   return GeometryType::kUnskinned;
@@ -197,6 +252,11 @@ VertexBuffer UnskinnedVertexBufferGeometry::GetVertexBuffer(
   return vertex_buffer_;
 }
 
+// |Geometry|
+std::optional<BoundingBox> UnskinnedVertexBufferGeometry::GetBounds() const {
+  return bounds_;
+}
+
 // |Geometry|
 void UnskinnedVertexBufferGeometry::BindToCommand(
     const SceneContext& scene_context,
@@ -6,6 +6,7 @@
 #define FLUTTER_IMPELLER_SCENE_GEOMETRY_H_
 
 #include <memory>
+#include <optional>
 
 #include "flutter/fml/macros.h"
 #include "impeller/core/allocator.h"
@@ -25,14 +26,37 @@ namespace scene {
 class CuboidGeometry;
 class UnskinnedVertexBufferGeometry;
 
+//------------------------------------------------------------------------------
+/// @brief      An axis aligned box bounding the vertices of a geometry in its
+///             local space.
+///
+struct BoundingBox {
+  Vector3 min;
+  Vector3 max;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Whether any part of the box may be visible once transformed by
+  ///             the given model view projection.
+  ///
+  ///             Boxes are only rejected when all of their corners are outside
+  ///             the same plane of the view frustum, so boxes near the edges of
+  ///             the frustum may be reported as visible when they are not.
+  ///
+  bool IntersectsFrustum(const Matrix& mvp) const;
+};
+
 class Geometry {
  public:
   virtual ~Geometry();
 
   static std::shared_ptr<CuboidGeometry> MakeCuboid(Vector3 size);
 
-  static std::shared_ptr<Geometry> MakeVertexBuffer(VertexBuffer vertex_buffer,
-                                                    bool is_skinned);
+  /// @param[in]  bounds  The bounds of the vertices. Only used for unskinned
+  ///                     geometry, as skinned geometry moves with its joints.
+  static std::shared_ptr<Geometry> MakeVertexBuffer(
+      VertexBuffer vertex_buffer,
+      bool is_skinned,
+      std::optional<BoundingBox> bounds = std::nullopt);
 
   static std::shared_ptr<Geometry> MakeFromFlatbuffer(
       const fb::MeshPrimitive& mesh,
@@ -42,6 +66,15 @@ class Geometry {
 
   virtual VertexBuffer GetVertexBuffer(Allocator& allocator) const = 0;
 
+  //----------------------------------------------------------------------------
+  /// @brief      The bounds of the vertices in the local space of the geometry,
+  ///             used to cull geometry outside the view.
+  ///
+  /// @return     The bounds, or std::nullopt if they are unknown. Geometry
+  ///             without bounds is never culled.
+  ///
+  virtual std::optional<BoundingBox> GetBounds() const;
+
   virtual void BindToCommand(const SceneContext& scene_context,
                              HostBuffer& buffer,
                              const Matrix& transform,
@@ -64,6 +97,9 @@ class CuboidGeometry final : public Geometry {
   // |Geometry|
   VertexBuffer GetVertexBuffer(Allocator& allocator) const override;
 
+  // |Geometry|
+  std::optional<BoundingBox> GetBounds() const override;
+
   // |Geometry|
   void BindToCommand(const SceneContext& scene_context,
                      HostBuffer& buffer,
@@ -86,12 +122,17 @@ class UnskinnedVertexBufferGeometry final : public Geometry {
 
   void SetVertexBuffer(VertexBuffer vertex_buffer);
 
+  void SetBounds(std::optional<BoundingBox> bounds);
+
   // |Geometry|
   GeometryType GetGeometryType() const override;
 
   // |Geometry|
   VertexBuffer GetVertexBuffer(Allocator& allocator) const override;
 
+  // |Geometry|
+  std::optional<BoundingBox> GetBounds() const override;
+
   // |Geometry|
   void BindToCommand(const SceneContext& scene_context,
                      HostBuffer& buffer,
@@ -100,6 +141,7 @@ class UnskinnedVertexBufferGeometry final : public Geometry {
 
  private:
   VertexBuffer vertex_buffer_;
+  std::optional<BoundingBox> bounds_;
 
   UnskinnedVertexBufferGeometry(const UnskinnedVertexBufferGeometry&) = delete;
 
@@ -59,6 +59,10 @@ void Material::SetTranslucent(bool is_translucent) {
   is_translucent_ = is_translucent;
 }
 
+bool Material::IsTranslucent() const {
+  return is_translucent_;
+}
+
 SceneContextOptions Material::GetContextOptions(const RenderPass& pass) const {
   // TODO(bdero): Pipeline blend and stencil config.
   return {.sample_count = pass.GetRenderTarget().GetSampleCount()};
@@ -2,6 +2,10 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+#include <tuple>
+#include <unordered_map>
+
 #include "flutter/fml/macros.h"
 
 #include "flutter/fml/logging.h"
@@ -16,32 +20,101 @@ namespace scene {
 SceneEncoder::SceneEncoder() = default;
 
 void SceneEncoder::Add(const SceneCommand& command) {
-  // TODO(bdero): Manage multi-pass translucency ordering.
   commands_.push_back(command);
 }
 
-static void EncodeCommand(const SceneContext& scene_context,
-                          const Matrix& view_transform,
-                          RenderPass& render_pass,
-                          const SceneCommand& scene_command) {
+/// Whether two commands draw the same geometry with the same material, which
+/// lets them share their pipeline and material bindings.
+static bool CanShareBindings(const SceneCommand& a, const SceneCommand& b) {
+  return a.geometry == b.geometry && a.material == b.material;
+}
+
+/// Encodes commands that can share their bindings. Everything but the
+/// per-instance transform is bound once.
+static void EncodeBatch(const SceneContext& scene_context,
+                        const Matrix& view_transform,
+                        RenderPass& render_pass,
+                        const SceneCommand* const* scene_commands,
+                        size_t count) {
   auto& host_buffer = render_pass.GetTransientsBuffer();
+  const auto& first = *scene_commands[0];
 
-  Command cmd;
-  DEBUG_COMMAND_INFO(cmd, scene_command.label);
-  cmd.stencil_reference =
+  Command shared_cmd;
+  shared_cmd.stencil_reference =
       0;  // TODO(bdero): Configurable stencil ref per-command.
+  shared_cmd.pipeline = scene_context.GetPipeline(
+      PipelineKey{first.geometry->GetGeometryType(),
+                  first.material->GetMaterialType()},
+      first.material->GetContextOptions(render_pass));
+  first.material->BindToCommand(scene_context, host_buffer, shared_cmd);
+
+  for (size_t i = 0; i < count; i++) {
+    const auto& scene_command = *scene_commands[i];
+    Command cmd = shared_cmd;
+    DEBUG_COMMAND_INFO(cmd, scene_command.label);
+    scene_command.geometry->BindToCommand(
+        scene_context, host_buffer, view_transform * scene_command.transform,
+        cmd);
+    render_pass.AddCommand(std::move(cmd));
+  }
+}
 
-  cmd.pipeline = scene_context.GetPipeline(
-      PipelineKey{scene_command.geometry->GetGeometryType(),
-                  scene_command.material->GetMaterialType()},
-      scene_command.material->GetContextOptions(render_pass));
+std::vector<const SceneCommand*> SceneEncoder::GetSortedVisibleCommands(
+    const Matrix& camera_transform) const {
+  std::vector<const SceneCommand*> commands;
+  commands.reserve(commands_.size());
+  for (const auto& command : commands_) {
+    auto bounds = command.geometry->GetBounds();
+    if (bounds.has_value() &&
+        !bounds->IntersectsFrustum(camera_transform * command.transform)) {
+      continue;
+    }
+    commands.push_back(&command);
+  }
 
-  scene_command.geometry->BindToCommand(
-      scene_context, host_buffer, view_transform * scene_command.transform,
-      cmd);
-  scene_command.material->BindToCommand(scene_context, host_buffer, cmd);
+  // Commands sharing a material and geometry are grouped by the order in
+  // which the material and geometry were first added, which keeps the
+  // encoding order the same from run to run.
+  std::unordered_map<const Material*, size_t> material_indices;
+  std::unordered_map<const Geometry*, size_t> geometry_indices;
+  for (const auto* command : commands) {
+    material_indices.try_emplace(command->material, material_indices.size());
+    geometry_indices.try_emplace(command->geometry, geometry_indices.size());
+  }
+  auto sort_key = [&](const SceneCommand* command) {
+    return std::make_tuple(command->geometry->GetGeometryType(),
+                           command->material->GetMaterialType(),
+                           material_indices[command->material],
+                           geometry_indices[command->geometry]);
+  };
+  std::stable_sort(
+      commands.begin(), commands.end(),
+      [&sort_key](const SceneCommand* a, const SceneCommand* b) {
+        auto a_translucent = a->material->IsTranslucent();
+        auto b_translucent = b->material->IsTranslucent();
+        if (a_translucent || b_translucent) {
+          // TODO(bdero): Manage multi-pass translucency ordering.
+          return !a_translucent && b_translucent;
+        }
+        return sort_key(a) < sort_key(b);
+      });
+  return commands;
+}
 
-  render_pass.AddCommand(std::move(cmd));
+void SceneEncoder::EncodeCommands(const SceneContext& scene_context,
+                                  const Matrix& camera_transform,
+                                  RenderPass& render_pass) const {
+  auto commands = GetSortedVisibleCommands(camera_transform);
+  for (size_t i = 0; i < commands.size();) {
+    size_t count = 1u;
+    while (i + count < commands.size() &&
+           CanShareBindings(*commands[i], *commands[i + count])) {
+      count++;
+    }
+    EncodeBatch(scene_context, camera_transform, render_pass,
+                commands.data() + i, count);
+    i += count;
+  }
 }
 
 std::shared_ptr<CommandBuffer> SceneEncoder::BuildSceneCommandBuffer(
@@ -90,9 +163,7 @@ std::shared_ptr<CommandBuffer> SceneEncoder::BuildSceneCommandBuffer(
     return nullptr;
   }
 
-  for (auto& command : commands_) {
-    EncodeCommand(scene_context, camera_transform, *render_pass, command);
-  }
+  EncodeCommands(scene_context, camera_transform, *render_pass);
 
   if (!render_pass->EncodeCommands()) {
     FML_LOG(ERROR) << "Failed to encode render pass commands.";
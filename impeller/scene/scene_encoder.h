@@ -29,11 +29,37 @@ struct SceneCommand {
 
 class SceneEncoder {
  public:
+  SceneEncoder();
+
   void Add(const SceneCommand& command);
 
- private:
-  SceneEncoder();
+  //----------------------------------------------------------------------------
+  /// @brief      The commands to encode for the given camera, in order.
+  ///
+  ///             Commands whose geometry is outside the view frustum are
+  ///             culled. Opaque commands are sorted so that commands sharing a
+  ///             pipeline, material and geometry are adjacent and can share
+  ///             their bindings. Ties are broken by the order in which
+  ///             materials and geometry were first added. Translucent commands
+  ///             are drawn afterwards in the order they were added.
+  ///
+  /// @details    Visible for testing.
+  ///
+  std::vector<const SceneCommand*> GetSortedVisibleCommands(
+      const Matrix& camera_transform) const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Add the sorted visible commands to the render pass. Adjacent
+  ///             commands sharing a material and geometry share their
+  ///             pipeline and material bindings.
+  ///
+  /// @details    Visible for testing.
+  ///
+  void EncodeCommands(const SceneContext& scene_context,
+                      const Matrix& camera_transform,
+                      RenderPass& render_pass) const;
 
+ private:
   std::shared_ptr<CommandBuffer> BuildSceneCommandBuffer(
       const SceneContext& scene_context,
       const Matrix& camera_transform,
@@ -4,6 +4,7 @@
 
 #include <cmath>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "flutter/fml/mapping.h"
@@ -24,6 +25,7 @@
 #include "impeller/scene/material.h"
 #include "impeller/scene/mesh.h"
 #include "impeller/scene/scene.h"
+#include "impeller/scene/scene_encoder.h"
 #include "third_party/flatbuffers/include/flatbuffers/verifier.h"
 #include "third_party/imgui/imgui.h"
 
@@ -34,6 +36,144 @@ namespace testing {
 using SceneTest = PlaygroundTest;
 INSTANTIATE_PLAYGROUND_SUITE(SceneTest);
 
+TEST(BoundingBoxTest, IntersectsFrustum) {
+  auto camera = Camera::MakePerspective(Degrees(60), {0, 0, -5})
+                    .LookAt({0, 0, 0}, {0, -1, 0})
+                    .GetTransform(ISize(100, 100));
+  BoundingBox box = {.min = Vector3(-1, -1, -1), .max = Vector3(1, 1, 1)};
+
+  EXPECT_TRUE(box.IntersectsFrustum(camera));
+  // Straddling the edge of the view.
+  EXPECT_TRUE(
+      box.IntersectsFrustum(camera * Matrix::MakeTranslation({3, 0, 0})));
+  // Off to the side, behind the camera and beyond the far plane.
+  EXPECT_FALSE(
+      box.IntersectsFrustum(camera * Matrix::MakeTranslation({100, 0, 0})));
+  EXPECT_FALSE(
+      box.IntersectsFrustum(camera * Matrix::MakeTranslation({0, 0, -10})));
+  EXPECT_FALSE(
+      box.IntersectsFrustum(camera * Matrix::MakeTranslation({0, 0, 2000})));
+}
+
+static Matrix GetTestCameraTransform() {
+  return Camera::MakePerspective(Degrees(60), {0, 0, -5})
+      .LookAt({0, 0, 0}, {0, -1, 0})
+      .GetTransform(ISize(100, 100));
+}
+
+TEST(SceneEncoderTest, CullsCommandsOutsideTheView) {
+  auto cuboid = Geometry::MakeCuboid(Vector3(1, 1, 1));
+  auto unbounded = Geometry::MakeVertexBuffer({}, /*is_skinned=*/false);
+  auto material = Material::MakeUnlit();
+
+  SceneEncoder encoder;
+  encoder.Add({.label = "Visible",
+               .transform = Matrix(),
+               .geometry = cuboid.get(),
+               .material = material.get()});
+  encoder.Add({.label = "Culled",
+               .transform = Matrix::MakeTranslation({100, 0, 0}),
+               .geometry = cuboid.get(),
+               .material = material.get()});
+  // Geometry without bounds is never culled.
+  encoder.Add({.label = "Unbounded",
+               .transform = Matrix::MakeTranslation({100, 0, 0}),
+               .geometry = unbounded.get(),
+               .material = material.get()});
+
+  auto commands = encoder.GetSortedVisibleCommands(GetTestCameraTransform());
+  ASSERT_EQ(commands.size(), 2u);
+  EXPECT_EQ(commands[0]->label, "Visible");
+  EXPECT_EQ(commands[1]->label, "Unbounded");
+}
+
+TEST(SceneEncoderTest, SortsOpaqueCommandsBeforeTranslucentCommands) {
+  auto cuboid = Geometry::MakeCuboid(Vector3(1, 1, 1));
+  auto opaque_a = Material::MakeUnlit();
+  auto opaque_b = Material::MakeUnlit();
+  auto translucent = Material::MakeUnlit();
+  translucent->SetTranslucent(true);
+
+  SceneEncoder encoder;
+  auto add = [&](const std::string& label, Material* material) {
+    encoder.Add({.label = label,
+                 .transform = Matrix(),
+                 .geometry = cuboid.get(),
+                 .material = material});
+  };
+  add("Translucent 1", translucent.get());
+  add("B 1", opaque_b.get());
+  add("A 1", opaque_a.get());
+  add("B 2", opaque_b.get());
+  add("Translucent 2", translucent.get());
+
+  // Opaque commands sharing a material are grouped in the order their
+  // materials were first added. Translucent commands keep their order.
+  auto commands = encoder.GetSortedVisibleCommands(GetTestCameraTransform());
+  std::vector<std::string> labels;
+  for (const auto* command : commands) {
+    labels.push_back(command->label);
+  }
+  EXPECT_EQ(labels, (std::vector<std::string>{"B 1", "B 2", "A 1",
+                                               "Translucent 1",
+                                               "Translucent 2"}));
+}
+
+TEST_P(SceneTest, EncoderSharesBindingsOfBatchedCommands) {
+  auto context = GetContext();
+  auto scene_context = std::make_shared<SceneContext>(context);
+  ASSERT_TRUE(scene_context->IsValid());
+
+  auto cuboid = Geometry::MakeCuboid(Vector3(1, 1, 1));
+  auto material_a = Material::MakeUnlit();
+  auto material_b = Material::MakeUnlit();
+
+  SceneEncoder encoder;
+  encoder.Add({.label = "A 1",
+               .transform = Matrix(),
+               .geometry = cuboid.get(),
+               .material = material_a.get()});
+  encoder.Add({.label = "B",
+               .transform = Matrix::MakeTranslation({0.1, 0, 0}),
+               .geometry = cuboid.get(),
+               .material = material_b.get()});
+  encoder.Add({.label = "A 2",
+               .transform = Matrix::MakeTranslation({0.2, 0, 0}),
+               .geometry = cuboid.get(),
+               .material = material_a.get()});
+
+  auto render_target_allocator =
+      std::make_shared<RenderTargetAllocator>(context->GetResourceAllocator());
+  auto render_target = RenderTarget::CreateOffscreen(
+      *context, *render_target_allocator, {100, 100});
+  auto command_buffer = context->CreateCommandBuffer();
+  auto render_pass = command_buffer->CreateRenderPass(render_target);
+  ASSERT_TRUE(render_pass);
+
+  encoder.EncodeCommands(*scene_context, GetTestCameraTransform(),
+                         *render_pass);
+
+  const auto& commands = render_pass->GetCommands();
+  ASSERT_EQ(commands.size(), 3u);
+  auto frag_info_offset = [](const Command& command) {
+    return command.fragment_bindings.buffers[0].view.resource.range.offset;
+  };
+  auto transform_offset = [](const Command& command) {
+    return command.vertex_bindings.buffers[0].view.resource.range.offset;
+  };
+  for (const auto& command : commands) {
+    ASSERT_FALSE(command.fragment_bindings.buffers.empty());
+    ASSERT_FALSE(command.vertex_bindings.buffers.empty());
+    EXPECT_EQ(command.pipeline, commands[0].pipeline);
+  }
+
+  // Both commands drawing with material A are batched and share the material
+  // uniforms, but each has its own transform.
+  EXPECT_EQ(frag_info_offset(commands[0]), frag_info_offset(commands[1]));
+  EXPECT_NE(transform_offset(commands[0]), transform_offset(commands[1]));
+  EXPECT_NE(frag_info_offset(commands[1]), frag_info_offset(commands[2]));
+}
+
 TEST_P(SceneTest, CuboidUnlit) {
   auto scene_context = std::make_shared<SceneContext>(GetContext());
 
@@ -4,6 +4,8 @@
 
 #include "impeller/tessellator/tessellator.h"
 
+#include <algorithm>
+
 #include "third_party/libtess2/Include/tesselator.h"
 
 namespace impeller {
@@ -81,6 +83,16 @@ Tessellator::Result Tessellator::Tessellate(const Path& path,
     return Result::kInputError;
   }
 
+  // A single simple contour covers the same area under both of these fill
+  // types, and does not need libtess2 to resolve its winding.
+  if (simple_polygon_fast_path_enabled_ &&
+      (fill_type == FillType::kNonZero || fill_type == FillType::kOdd)) {
+    if (auto result = TessellateSimplePolygon(polyline, callback);
+        result.has_value()) {
+      return result.value();
+    }
+  }
+
   auto tessellator = c_tessellator_.get();
   if (!tessellator) {
     return Result::kTessellationError;
@@ -170,6 +182,201 @@ Tessellator::Result Tessellator::Tessellate(const Path& path,
   return Result::kSuccess;
 }
 
+void Tessellator::SetSimplePolygonFastPathEnabled(bool enabled) {
+  simple_polygon_fast_path_enabled_ = enabled;
+}
+
+// Whether the segments a0-a1 and b0-b1 cross or touch.
+static bool SegmentsIntersect(Point a0, Point a1, Point b0, Point b1) {
+  auto d0 = (a1 - a0).Cross(b0 - a0);
+  auto d1 = (a1 - a0).Cross(b1 - a0);
+  auto d2 = (b1 - b0).Cross(a0 - b0);
+  auto d3 = (b1 - b0).Cross(a1 - b0);
+  if (((d0 > 0 && d1 < 0) || (d0 < 0 && d1 > 0)) &&
+      ((d2 > 0 && d3 < 0) || (d2 < 0 && d3 > 0))) {
+    return true;
+  }
+  // Collinear endpoints only intersect if they lie within the other segment.
+  auto within = [](Point p, Point q, Point r) {
+    return std::min(p.x, q.x) <= r.x && r.x <= std::max(p.x, q.x) &&
+           std::min(p.y, q.y) <= r.y && r.y <= std::max(p.y, q.y);
+  };
+  return (d0 == 0 && within(a0, a1, b0)) || (d1 == 0 && within(a0, a1, b1)) ||
+         (d2 == 0 && within(b0, b1, a0)) || (d3 == 0 && within(b0, b1, a1));
+}
+
+// Whether the closed polygon has no crossing, touching or overlapping edges.
+//
+// Edges are swept in order of their top so that each edge is only tested
+// against the edges that overlap it vertically.
+static bool IsSimplePolygon(const std::vector<Point>& points,
+                            std::vector<uint16_t>& edges,
+                            std::vector<uint16_t>& active_edges) {
+  auto count = points.size();
+  auto top = [&points, count](uint16_t edge) {
+    return std::min(points[edge].y, points[(edge + 1) % count].y);
+  };
+  auto bottom = [&points, count](uint16_t edge) {
+    return std::max(points[edge].y, points[(edge + 1) % count].y);
+  };
+
+  edges.resize(count);
+  for (auto i = 0u; i < count; i++) {
+    edges[i] = static_cast<uint16_t>(i);
+  }
+  std::sort(edges.begin(), edges.end(),
+            [&top](uint16_t a, uint16_t b) { return top(a) < top(b); });
+
+  active_edges.clear();
+  for (auto edge : edges) {
+    auto edge_top = top(edge);
+    active_edges.erase(std::remove_if(active_edges.begin(), active_edges.end(),
+                                      [&bottom, edge_top](uint16_t other) {
+                                        return bottom(other) < edge_top;
+                                      }),
+                       active_edges.end());
+
+    auto p0 = points[edge];
+    auto p1 = points[(edge + 1) % count];
+    for (auto other : active_edges) {
+      auto q0 = points[other];
+      auto q1 = points[(other + 1) % count];
+      if ((other + 1) % count == edge) {
+        // Consecutive edges share p0, and only intersect if they fold back
+        // onto each other.
+        if ((q0 - p0).Cross(p1 - p0) == 0 && (q0 - p0).Dot(p1 - p0) > 0) {
+          return false;
+        }
+      } else if ((edge + 1) % count == other) {
+        if ((p0 - q0).Cross(q1 - q0) == 0 && (p0 - q0).Dot(q1 - q0) > 0) {
+          return false;
+        }
+      } else if (SegmentsIntersect(p0, p1, q0, q1)) {
+        return false;
+      }
+    }
+    active_edges.push_back(edge);
+  }
+  return true;
+}
+
+std::optional<Tessellator::Result> Tessellator::TessellateSimplePolygon(
+    const Path::Polyline& polyline,
+    const BuilderCallback& callback) {
+  if (polyline.contours.size() != 1u) {
+    return std::nullopt;
+  }
+  auto [start, end] = polyline.GetContourPointBounds(0);
+  if (end - start > kMaxSimplePolygonPoints) {
+    return std::nullopt;
+  }
+
+  // Drop repeated points, including the closing point of the contour.
+  auto& points = simple_polygon_points_;
+  points.clear();
+  for (auto i = start; i < end; i++) {
+    auto point = polyline.GetPoint(i);
+    if (points.empty() || points.back() != point) {
+      points.push_back(point);
+    }
+  }
+  while (points.size() > 1 && points.back() == points.front()) {
+    points.pop_back();
+  }
+  auto count = points.size();
+  if (count < 3u) {
+    return std::nullopt;
+  }
+  if (!IsSimplePolygon(points, simple_polygon_edges_,
+                       simple_polygon_active_edges_)) {
+    return std::nullopt;
+  }
+
+  Scalar area = 0;
+  for (auto i = 0u; i < count; i++) {
+    area += points[i].Cross(points[(i + 1) % count]);
+  }
+  if (area == 0) {
+    return std::nullopt;
+  }
+  // Ears are convex in the winding direction of the contour.
+  Scalar orientation = area > 0 ? 1 : -1;
+
+  auto& prev = simple_polygon_prev_;
+  auto& next = simple_polygon_next_;
+  prev.resize(count);
+  next.resize(count);
+  for (auto i = 0u; i < count; i++) {
+    prev[i] = static_cast<uint16_t>((i + count - 1) % count);
+    next[i] = static_cast<uint16_t>((i + 1) % count);
+  }
+
+  auto is_ear = [&](uint16_t vertex) {
+    auto a = points[prev[vertex]];
+    auto b = points[vertex];
+    auto c = points[next[vertex]];
+    if ((b - a).Cross(c - b) * orientation <= 0) {
+      return false;
+    }
+    auto min = a.Min(b).Min(c);
+    auto max = a.Max(b).Max(c);
+    for (auto other = next[next[vertex]]; other != prev[vertex];
+         other = next[other]) {
+      auto p = points[other];
+      if (p.x < min.x || p.y < min.y || p.x > max.x || p.y > max.y) {
+        continue;
+      }
+      if ((b - a).Cross(p - a) * orientation >= 0 &&
+          (c - b).Cross(p - b) * orientation >= 0 &&
+          (a - c).Cross(p - c) * orientation >= 0) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  auto& indices = simple_polygon_indices_;
+  indices.clear();
+  indices.reserve((count - 2) * 3);
+  uint16_t vertex = 0;
+  size_t remaining = count;
+  size_t misses = 0;
+  while (remaining > 3) {
+    auto a = points[prev[vertex]];
+    auto b = points[vertex];
+    auto c = points[next[vertex]];
+    bool collinear = (b - a).Cross(c - b) == 0;
+    if (collinear || is_ear(vertex)) {
+      if (!collinear) {
+        indices.push_back(prev[vertex]);
+        indices.push_back(vertex);
+        indices.push_back(next[vertex]);
+      }
+      next[prev[vertex]] = next[vertex];
+      prev[next[vertex]] = prev[vertex];
+      vertex = next[vertex];
+      remaining--;
+      misses = 0;
+      continue;
+    }
+    vertex = next[vertex];
+    // Rounding can leave a polygon without ears, libtess2 handles those.
+    if (++misses > remaining) {
+      return std::nullopt;
+    }
+  }
+  indices.push_back(prev[vertex]);
+  indices.push_back(vertex);
+  indices.push_back(next[vertex]);
+
+  static_assert(sizeof(Point) == 2 * sizeof(float));
+  if (!callback(reinterpret_cast<const float*>(points.data()), count,
+                indices.data(), indices.size())) {
+    return Result::kInputError;
+  }
+  return Result::kSuccess;
+}
+
 std::vector<Point> Tessellator::TessellateConvex(const Path& path,
                                                  Scalar tolerance) {
   std::vector<Point> output;
@@ -218,6 +425,38 @@ std::vector<Point> Tessellator::TessellateConvex(const Path& path,
   return output;
 }
 
+std::vector<Point> Tessellator::TessellateStencilFan(const Path& path,
+                                                     Scalar tolerance) {
+  std::vector<Point> output;
+
+  point_buffer_->clear();
+  auto polyline =
+      path.CreatePolyline(tolerance, std::move(point_buffer_),
+                          [this](Path::Polyline::PointBufferPtr point_buffer) {
+                            point_buffer_ = std::move(point_buffer);
+                          });
+
+  output.reserve(polyline.points->size() * 3);
+  for (auto j = 0u; j < polyline.contours.size(); j++) {
+    auto [start, end] = polyline.GetContourPointBounds(j);
+    if (end - start < 3) {
+      continue;
+    }
+    // Contours are filled as if closed whether or not they are, so the
+    // closing edge back to the first point is implied by the fan.
+    auto first_point = polyline.GetPoint(start);
+    if (polyline.GetPoint(end - 1) == first_point) {
+      end--;
+    }
+    for (auto i = start + 1; i + 1 < end; i++) {
+      output.emplace_back(first_point);
+      output.emplace_back(polyline.GetPoint(i));
+      output.emplace_back(polyline.GetPoint(i + 1));
+    }
+  }
+  return output;
+}
+
 void DestroyTessellator(TESStesselator* tessellator) {
   if (tessellator != nullptr) {
     ::tessDeleteTess(tessellator);
@@ -7,6 +7,7 @@
 
 #include <functional>
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include "flutter/fml/macros.h"
@@ -192,6 +193,11 @@ class Tessellator {
   /// @brief      Generates filled triangles from the path. A callback is
   ///             invoked once for the entire tessellation.
   ///
+  ///             Paths made of a single simple (non self-intersecting)
+  ///             contour with a non-zero or even-odd fill are triangulated
+  ///             by ear clipping into scratch buffers owned by this object.
+  ///             All other paths are tessellated by libtess2.
+  ///
   /// @param[in]  path  The path to tessellate.
   /// @param[in]  tolerance  The tolerance value for conversion of the path to
   ///                        a polyline. This value is often derived from the
@@ -218,6 +224,38 @@ class Tessellator {
   ///
   std::vector<Point> TessellateConvex(const Path& path, Scalar tolerance);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Given any path, create triangle fans of its contours for
+  ///             stencil-then-cover filling.
+  ///
+  ///             Each contour is fanned out from its first point. The
+  ///             triangles overlap and are wound in either direction, so
+  ///             they only describe the fill once their coverage is counted
+  ///             in the stencil buffer according to the fill type.
+  ///
+  /// @param[in]  path  The path to tessellate.
+  /// @param[in]  tolerance  The tolerance value for conversion of the path to
+  ///                        a polyline. This value is often derived from the
+  ///                        Matrix::GetMaxBasisLength of the CTM applied to the
+  ///                        path for rendering.
+  ///
+  /// @return A point vector containing the vertices in triangle list format.
+  ///
+  std::vector<Point> TessellateStencilFan(const Path& path, Scalar tolerance);
+
+  /// @brief  The largest number of points in a contour that is considered
+  ///         for triangulation by ear clipping instead of libtess2.
+  static constexpr size_t kMaxSimplePolygonPoints = 512u;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Enable or disable the ear clipping fast path for simple
+  ///             polygons used by |Tessellate|. It is enabled by default.
+  ///
+  ///             Disabling it is only useful to compare against libtess2 in
+  ///             tests and benchmarks.
+  ///
+  void SetSimplePolygonFastPathEnabled(bool enabled);
+
   /// @brief   The pixel tolerance used by the algorighm to determine how
   ///          many divisions to create for a circle.
   ///
@@ -299,6 +337,15 @@ class Tessellator {
   std::unique_ptr<std::vector<Point>> point_buffer_;
   CTessellator c_tessellator_;
 
+  /// Scratch storage reused by the simple polygon fast path.
+  bool simple_polygon_fast_path_enabled_ = true;
+  std::vector<Point> simple_polygon_points_;
+  std::vector<uint16_t> simple_polygon_indices_;
+  std::vector<uint16_t> simple_polygon_edges_;
+  std::vector<uint16_t> simple_polygon_active_edges_;
+  std::vector<uint16_t> simple_polygon_prev_;
+  std::vector<uint16_t> simple_polygon_next_;
+
   // Data for variouos Circle/EllipseGenerator classes, cached per
   // Tessellator instance which is usually the foreground life of an app
   // if not longer.
@@ -307,6 +354,12 @@ class Tessellator {
 
   Trigs GetTrigsForDivisions(size_t divisions);
 
+  /// Triangulate the polyline by ear clipping if it is a single simple
+  /// contour, otherwise return std::nullopt so that libtess2 is used.
+  std::optional<Result> TessellateSimplePolygon(
+      const Path::Polyline& polyline,
+      const BuilderCallback& callback);
+
   static void GenerateFilledCircle(const Trigs& trigs,
                                    const EllipticalVertexGenerator::Data& data,
                                    const TessellatedVertexProc& proc);
@@ -134,6 +134,147 @@ TEST(TessellatorTest, TessellateConvex) {
   }
 }
 
+TEST(TessellatorTest, TessellateStencilFan) {
+  Tessellator t;
+  auto pts = t.TessellateStencilFan(PathBuilder{}
+                                        .AddRect(Rect::MakeLTRB(0, 0, 10, 10))
+                                        .AddRect(Rect::MakeLTRB(20, 20, 30, 30))
+                                        .TakePath(),
+                                    1.0);
+
+  std::vector<Point> expected = {
+      {0, 0},   {10, 0},  {10, 10},  //
+      {0, 0},   {10, 10}, {0, 10},   //
+      {20, 20}, {30, 20}, {30, 30},  //
+      {20, 20}, {30, 30}, {20, 30},  //
+  };
+  EXPECT_EQ(pts, expected);
+
+  // Contours that can't enclose any area are skipped.
+  pts = t.TessellateStencilFan(
+      PathBuilder{}.MoveTo({0, 0}).LineTo({10, 10}).TakePath(), 1.0);
+  EXPECT_TRUE(pts.empty());
+}
+
+// Sums the area of the indexed triangles produced by |Tessellate|, counting
+// triangles wound against the majority as negative area.
+static Scalar TessellatedArea(Tessellator& tessellator, const Path& path) {
+  Scalar area = 0;
+  auto result = tessellator.Tessellate(
+      path, 1.0f,
+      [&area](const float* vertices, size_t vertices_count,
+              const uint16_t* indices, size_t indices_count) {
+        auto points = reinterpret_cast<const Point*>(vertices);
+        Scalar signed_area = 0;
+        Scalar absolute_area = 0;
+        for (auto i = 0u; i < indices_count; i += 3) {
+          auto a = points[indices[i]];
+          auto b = points[indices[i + 1]];
+          auto c = points[indices[i + 2]];
+          auto triangle_area = (b - a).Cross(c - a) / 2;
+          signed_area += triangle_area;
+          absolute_area += std::abs(triangle_area);
+        }
+        EXPECT_NEAR(std::abs(signed_area), absolute_area, 1e-3);
+        area = absolute_area;
+        return true;
+      });
+  EXPECT_EQ(result, Tessellator::Result::kSuccess);
+  return area;
+}
+
+TEST(TessellatorTest, SimplePolygonFastPathMatchesLibtess) {
+  std::vector<Path> paths;
+  // Concave, in both winding directions.
+  paths.push_back(PathBuilder{}
+                      .MoveTo({0, 0})
+                      .LineTo({10, 0})
+                      .LineTo({10, 2})
+                      .LineTo({2, 2})
+                      .LineTo({2, 10})
+                      .LineTo({0, 10})
+                      .Close()
+                      .TakePath());
+  paths.push_back(PathBuilder{}
+                      .MoveTo({0, 0})
+                      .LineTo({0, 10})
+                      .LineTo({2, 10})
+                      .LineTo({2, 2})
+                      .LineTo({10, 2})
+                      .LineTo({10, 0})
+                      .Close()
+                      .TakePath(FillType::kOdd));
+  // Collinear points.
+  paths.push_back(PathBuilder{}
+                      .MoveTo({0, 0})
+                      .LineTo({5, 0})
+                      .LineTo({10, 0})
+                      .LineTo({10, 10})
+                      .LineTo({5, 5})
+                      .LineTo({0, 10})
+                      .Close()
+                      .TakePath());
+  // Curves.
+  paths.push_back(PathBuilder{}
+                      .MoveTo({50, 30})
+                      .CubicCurveTo({50, 0}, {0, 0}, {0, 30})
+                      .CubicCurveTo({0, 60}, {50, 80}, {50, 100})
+                      .CubicCurveTo({50, 80}, {100, 60}, {100, 30})
+                      .CubicCurveTo({100, 0}, {50, 0}, {50, 30})
+                      .Close()
+                      .TakePath());
+
+  for (const auto& path : paths) {
+    Tessellator fast;
+    Tessellator libtess;
+    libtess.SetSimplePolygonFastPathEnabled(false);
+    EXPECT_NEAR(TessellatedArea(fast, path), TessellatedArea(libtess, path),
+                1e-2);
+  }
+}
+
+TEST(TessellatorTest, SimplePolygonFastPathProducesTriangleList) {
+  Tessellator t;
+  auto path = PathBuilder{}
+                  .MoveTo({0, 0})
+                  .LineTo({10, 0})
+                  .LineTo({10, 2})
+                  .LineTo({2, 2})
+                  .LineTo({2, 10})
+                  .LineTo({0, 10})
+                  .Close()
+                  .TakePath();
+  size_t vertex_count = 0u;
+  size_t index_count = 0u;
+  auto result = t.Tessellate(
+      path, 1.0f,
+      [&](const float* vertices, size_t vertices_count,
+          const uint16_t* indices, size_t indices_count) {
+        vertex_count = vertices_count;
+        index_count = indices_count;
+        return true;
+      });
+
+  ASSERT_EQ(result, Tessellator::Result::kSuccess);
+  // An ear clipped polygon of n vertices has n - 2 triangles.
+  EXPECT_EQ(vertex_count, 6u);
+  EXPECT_EQ(index_count, 12u);
+}
+
+TEST(TessellatorTest, SelfIntersectingPolygonFallsBackToLibtess) {
+  Tessellator t;
+  auto bowtie = PathBuilder{}
+                    .MoveTo({0, 0})
+                    .LineTo({10, 10})
+                    .LineTo({10, 0})
+                    .LineTo({0, 10})
+                    .Close()
+                    .TakePath();
+  // Ear clipping cannot resolve the crossing, libtess2 splits it into two
+  // triangles meeting at the center.
+  EXPECT_NEAR(TessellatedArea(t, bowtie), 50, 1e-3);
+}
+
 TEST(TessellatorTest, CircleVertexCounts) {
   auto tessellator = std::make_shared<Tessellator>();
 
@@ -4,6 +4,7 @@
 
 #include "impeller/typographer/backends/skia/typographer_context_skia.h"
 
+#include <atomic>
 #include <numeric>
 #include <utility>
 
@@ -27,12 +28,18 @@ namespace impeller {
 //              https://github.com/flutter/flutter/issues/114563
 constexpr auto kPadding = 2;
 
-std::shared_ptr<TypographerContext> TypographerContextSkia::Make() {
-  return std::make_shared<TypographerContextSkia>();
+std::shared_ptr<TypographerContext> TypographerContextSkia::Make(
+    std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner) {
+  return std::make_shared<TypographerContextSkia>(
+      std::move(worker_task_runner));
 }
 
 TypographerContextSkia::TypographerContextSkia() = default;
 
+TypographerContextSkia::TypographerContextSkia(
+    std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner)
+    : TypographerContext(std::move(worker_task_runner)) {}
+
 TypographerContextSkia::~TypographerContextSkia() = default;
 
 std::shared_ptr<GlyphAtlasContext>
@@ -130,7 +137,8 @@ static ISize OptimumAtlasSizeForFontGlyphPairs(
   size_t total_pairs = pairs.size() + 1;
   do {
     auto rect_packer = std::shared_ptr<RectanglePacker>(
-        RectanglePacker::Factory(current_size.width, current_size.height));
+        RectanglePacker::Factory(current_size.width, current_size.height,
+                                 atlas_context->GetRectPackerStrategy()));
 
     auto remaining_pairs = PairsFitInAtlasOfSize(pairs, current_size,
                                                  glyph_positions, rect_packer);
@@ -185,35 +193,79 @@ static void DrawGlyph(SkCanvas* canvas,
   );
 }
 
-static bool UpdateAtlasBitmap(const GlyphAtlas& atlas,
+namespace {
+struct GlyphToRasterize {
+  const ScaledFont* scaled_font;
+  const Glyph* glyph;
+  Rect location;
+};
+}  // namespace
+
+/// Draws each glyph through its own surface that wraps only the glyph's cell
+/// of the atlas bitmap. Cells never overlap, so the glyphs may be rasterized
+/// concurrently without any further synchronization.
+static bool DrawGlyphsIntoAtlasBitmap(
+    const TypographerContext& typographer_context,
+    const SkPixmap& atlas_pixmap,
+    const std::vector<GlyphToRasterize>& glyphs,
+    bool has_color) {
+  TRACE_EVENT0("impeller", __FUNCTION__);
+  std::atomic_bool success = true;
+  typographer_context.RasterizeConcurrently(
+      glyphs.size(), [&atlas_pixmap, &glyphs, &success, has_color](size_t i) {
+        const GlyphToRasterize& to_rasterize = glyphs[i];
+        const Rect& location = to_rasterize.location;
+        // The packer reserved the padding to the right and bottom of the glyph
+        // so the cell may include it.
+        const auto cell = SkIRect::MakeXYWH(
+            static_cast<int32_t>(location.GetX()),
+            static_cast<int32_t>(location.GetY()),
+            static_cast<int32_t>(location.GetWidth()) + kPadding,
+            static_cast<int32_t>(location.GetHeight()) + kPadding);
+        SkPixmap cell_pixmap;
+        if (!atlas_pixmap.extractSubset(&cell_pixmap, cell)) {
+          success = false;
+          return;
+        }
+        auto surface = SkSurfaces::WrapPixels(cell_pixmap);
+        if (!surface) {
+          success = false;
+          return;
+        }
+        auto canvas = surface->getCanvas();
+        canvas->clear(SK_ColorTRANSPARENT);
+        DrawGlyph(canvas, *to_rasterize.scaled_font, *to_rasterize.glyph,
+                  Rect::MakeSize(location.GetSize()), has_color);
+      });
+  return success;
+}
+
+static bool UpdateAtlasBitmap(const TypographerContext& typographer_context,
+                              const GlyphAtlas& atlas,
                               const std::shared_ptr<SkBitmap>& bitmap,
                               const std::vector<FontGlyphPair>& new_pairs) {
   TRACE_EVENT0("impeller", __FUNCTION__);
   FML_DCHECK(bitmap != nullptr);
 
-  auto surface = SkSurfaces::WrapPixels(bitmap->pixmap());
-  if (!surface) {
-    return false;
-  }
-  auto canvas = surface->getCanvas();
-  if (!canvas) {
-    return false;
-  }
-
-  bool has_color = atlas.GetType() == GlyphAtlas::Type::kColorBitmap;
-
+  std::vector<GlyphToRasterize> glyphs;
+  glyphs.reserve(new_pairs.size());
   for (const FontGlyphPair& pair : new_pairs) {
     auto pos = atlas.FindFontGlyphBounds(pair);
     if (!pos.has_value()) {
       continue;
     }
-    DrawGlyph(canvas, pair.scaled_font, pair.glyph, pos.value(), has_color);
+    glyphs.push_back({&pair.scaled_font, &pair.glyph, pos.value()});
   }
-  return true;
+
+  bool has_color = atlas.GetType() == GlyphAtlas::Type::kColorBitmap;
+  return DrawGlyphsIntoAtlasBitmap(typographer_context, bitmap->pixmap(),
+                                   glyphs, has_color);
 }
 
-static std::shared_ptr<SkBitmap> CreateAtlasBitmap(const GlyphAtlas& atlas,
-                                                   const ISize& atlas_size) {
+static std::shared_ptr<SkBitmap> CreateAtlasBitmap(
+    const TypographerContext& typographer_context,
+    const GlyphAtlas& atlas,
+    const ISize& atlas_size) {
   TRACE_EVENT0("impeller", __FUNCTION__);
   auto bitmap = std::make_shared<SkBitmap>();
   SkImageInfo image_info;
@@ -232,24 +284,21 @@ static std::shared_ptr<SkBitmap> CreateAtlasBitmap(const GlyphAtlas& atlas,
     return nullptr;
   }
 
-  auto surface = SkSurfaces::WrapPixels(bitmap->pixmap());
-  if (!surface) {
-    return nullptr;
-  }
-  auto canvas = surface->getCanvas();
-  if (!canvas) {
-    return nullptr;
-  }
-
-  bool has_color = atlas.GetType() == GlyphAtlas::Type::kColorBitmap;
-
-  atlas.IterateGlyphs([canvas, has_color](const ScaledFont& scaled_font,
-                                          const Glyph& glyph,
-                                          const Rect& location) -> bool {
-    DrawGlyph(canvas, scaled_font, glyph, location, has_color);
+  std::vector<GlyphToRasterize> glyphs;
+  glyphs.reserve(atlas.GetGlyphCount());
+  atlas.IterateGlyphs([&glyphs](const ScaledFont& scaled_font,
+                                const Glyph& glyph,
+                                const Rect& location) -> bool {
+    glyphs.push_back({&scaled_font, &glyph, location});
     return true;
   });
 
+  bool has_color = atlas.GetType() == GlyphAtlas::Type::kColorBitmap;
+  if (!DrawGlyphsIntoAtlasBitmap(typographer_context, bitmap->pixmap(), glyphs,
+                                 has_color)) {
+    return nullptr;
+  }
+
   return bitmap;
 }
 
@@ -376,7 +425,7 @@ std::shared_ptr<GlyphAtlas> TypographerContextSkia::CreateGlyphAtlas(
     // Step 4a: Draw new font-glyph pairs into the existing bitmap.
     // ---------------------------------------------------------------------------
     auto bitmap = atlas_context_skia.GetBitmap();
-    if (!UpdateAtlasBitmap(*last_atlas, bitmap, new_glyphs)) {
+    if (!UpdateAtlasBitmap(*this, *last_atlas, bitmap, new_glyphs)) {
       return nullptr;
     }
 
@@ -440,7 +489,7 @@ std::shared_ptr<GlyphAtlas> TypographerContextSkia::CreateGlyphAtlas(
   // ---------------------------------------------------------------------------
   // Step 6b: Draw font-glyph pairs in the correct spot in the atlas.
   // ---------------------------------------------------------------------------
-  auto bitmap = CreateAtlasBitmap(*glyph_atlas, atlas_size);
+  auto bitmap = CreateAtlasBitmap(*this, *glyph_atlas, atlas_size);
   if (!bitmap) {
     return nullptr;
   }
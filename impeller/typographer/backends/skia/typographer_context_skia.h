@@ -12,10 +12,21 @@ namespace impeller {
 
 class TypographerContextSkia : public TypographerContext {
  public:
-  static std::shared_ptr<TypographerContext> Make();
+  //----------------------------------------------------------------------------
+  /// @brief      Create a Skia backed typographer context.
+  ///
+  /// @param[in]  worker_task_runner  If not `nullptr`, glyphs missing from an
+  ///                                 atlas are rasterized concurrently on this
+  ///                                 task runner.
+  ///
+  static std::shared_ptr<TypographerContext> Make(
+      std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner = nullptr);
 
   TypographerContextSkia();
 
+  explicit TypographerContextSkia(
+      std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner);
+
   ~TypographerContextSkia() override;
 
   // |TypographerContext|
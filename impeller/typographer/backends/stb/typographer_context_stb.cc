@@ -26,12 +26,17 @@ namespace impeller {
 
 constexpr size_t kPadding = 1;
 
-std::unique_ptr<TypographerContext> TypographerContextSTB::Make() {
-  return std::make_unique<TypographerContextSTB>();
+std::unique_ptr<TypographerContext> TypographerContextSTB::Make(
+    std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner) {
+  return std::make_unique<TypographerContextSTB>(std::move(worker_task_runner));
 }
 
 TypographerContextSTB::TypographerContextSTB() : TypographerContext() {}
 
+TypographerContextSTB::TypographerContextSTB(
+    std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner)
+    : TypographerContext(std::move(worker_task_runner)) {}
+
 TypographerContextSTB::~TypographerContextSTB() = default;
 
 std::shared_ptr<GlyphAtlasContext>
@@ -173,7 +178,8 @@ static ISize OptimumAtlasSizeForFontGlyphPairs(
   size_t total_pairs = pairs.size() + 1;
   do {
     auto rect_packer = std::shared_ptr<RectanglePacker>(
-        RectanglePacker::Factory(current_size.width, current_size.height));
+        RectanglePacker::Factory(current_size.width, current_size.height,
+                                 atlas_context->GetRectPackerStrategy()));
 
     auto remaining_pairs = PairsFitInAtlasOfSize(pairs, current_size,
                                                  glyph_positions, rect_packer);
@@ -269,27 +275,57 @@ static void DrawGlyph(BitmapSTB* bitmap,
   }
 }
 
-static bool UpdateAtlasBitmap(const GlyphAtlas& atlas,
+namespace {
+struct GlyphToRasterize {
+  const ScaledFont* scaled_font;
+  const Glyph* glyph;
+  Rect location;
+};
+}  // namespace
+
+/// STB writes each glyph only into its own cell of the atlas bitmap and cells
+/// never overlap, so the glyphs may be rasterized concurrently in place.
+static void DrawGlyphsIntoAtlasBitmap(
+    const TypographerContext& typographer_context,
+    BitmapSTB* bitmap,
+    const std::vector<GlyphToRasterize>& glyphs,
+    bool has_color) {
+  TRACE_EVENT0("impeller", __FUNCTION__);
+  typographer_context.RasterizeConcurrently(
+      glyphs.size(), [bitmap, &glyphs, has_color](size_t i) {
+        const GlyphToRasterize& to_rasterize = glyphs[i];
+        DrawGlyph(bitmap, *to_rasterize.scaled_font, *to_rasterize.glyph,
+                  to_rasterize.location, has_color);
+      });
+}
+
+static bool UpdateAtlasBitmap(const TypographerContext& typographer_context,
+                              const GlyphAtlas& atlas,
                               const std::shared_ptr<BitmapSTB>& bitmap,
                               const std::vector<FontGlyphPair>& new_pairs) {
   TRACE_EVENT0("impeller", __FUNCTION__);
   FML_DCHECK(bitmap != nullptr);
 
-  bool has_color = atlas.GetType() == GlyphAtlas::Type::kColorBitmap;
-
+  std::vector<GlyphToRasterize> glyphs;
+  glyphs.reserve(new_pairs.size());
   for (const FontGlyphPair& pair : new_pairs) {
     auto pos = atlas.FindFontGlyphBounds(pair);
     if (!pos.has_value()) {
       continue;
     }
-    DrawGlyph(bitmap.get(), pair.scaled_font, pair.glyph, pos.value(),
-              has_color);
+    glyphs.push_back({&pair.scaled_font, &pair.glyph, pos.value()});
   }
+
+  bool has_color = atlas.GetType() == GlyphAtlas::Type::kColorBitmap;
+  DrawGlyphsIntoAtlasBitmap(typographer_context, bitmap.get(), glyphs,
+                            has_color);
   return true;
 }
 
-static std::shared_ptr<BitmapSTB> CreateAtlasBitmap(const GlyphAtlas& atlas,
-                                                    const ISize& atlas_size) {
+static std::shared_ptr<BitmapSTB> CreateAtlasBitmap(
+    const TypographerContext& typographer_context,
+    const GlyphAtlas& atlas,
+    const ISize& atlas_size) {
   TRACE_EVENT0("impeller", __FUNCTION__);
 
   size_t bytes_per_pixel = 1;
@@ -300,15 +336,19 @@ static std::shared_ptr<BitmapSTB> CreateAtlasBitmap(const GlyphAtlas& atlas,
   auto bitmap = std::make_shared<BitmapSTB>(atlas_size.width, atlas_size.height,
                                             bytes_per_pixel);
 
-  bool has_color = atlas.GetType() == GlyphAtlas::Type::kColorBitmap;
-
-  atlas.IterateGlyphs([&bitmap, has_color](const ScaledFont& scaled_font,
-                                           const Glyph& glyph,
-                                           const Rect& location) -> bool {
-    DrawGlyph(bitmap.get(), scaled_font, glyph, location, has_color);
+  std::vector<GlyphToRasterize> glyphs;
+  glyphs.reserve(atlas.GetGlyphCount());
+  atlas.IterateGlyphs([&glyphs](const ScaledFont& scaled_font,
+                                const Glyph& glyph,
+                                const Rect& location) -> bool {
+    glyphs.push_back({&scaled_font, &glyph, location});
     return true;
   });
 
+  bool has_color = atlas.GetType() == GlyphAtlas::Type::kColorBitmap;
+  DrawGlyphsIntoAtlasBitmap(typographer_context, bitmap.get(), glyphs,
+                            has_color);
+
   return bitmap;
 }
 
@@ -439,7 +479,7 @@ std::shared_ptr<GlyphAtlas> TypographerContextSTB::CreateGlyphAtlas(
     // ---------------------------------------------------------------------------
     // auto bitmap = atlas_context->GetBitmap();
     auto bitmap = atlas_context_stb.GetBitmap();
-    if (!UpdateAtlasBitmap(*last_atlas, bitmap, new_glyphs)) {
+    if (!UpdateAtlasBitmap(*this, *last_atlas, bitmap, new_glyphs)) {
       return nullptr;
     }
 
@@ -504,7 +544,7 @@ std::shared_ptr<GlyphAtlas> TypographerContextSTB::CreateGlyphAtlas(
   // ---------------------------------------------------------------------------
   // Step 6b: Draw font-glyph pairs in the correct spot in the atlas.
   // ---------------------------------------------------------------------------
-  auto bitmap = CreateAtlasBitmap(*glyph_atlas, atlas_size);
+  auto bitmap = CreateAtlasBitmap(*this, *glyph_atlas, atlas_size);
   if (!bitmap) {
     return nullptr;
   }
@@ -14,10 +14,21 @@ namespace impeller {
 
 class TypographerContextSTB : public TypographerContext {
  public:
-  static std::unique_ptr<TypographerContext> Make();
+  //----------------------------------------------------------------------------
+  /// @brief      Create an STB backed typographer context.
+  ///
+  /// @param[in]  worker_task_runner  If not `nullptr`, glyphs missing from an
+  ///                                 atlas are rasterized concurrently on this
+  ///                                 task runner.
+  ///
+  static std::unique_ptr<TypographerContext> Make(
+      std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner = nullptr);
 
   TypographerContextSTB();
 
+  explicit TypographerContextSTB(
+      std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner);
+
   ~TypographerContextSTB() override;
 
   // |TypographerContext|
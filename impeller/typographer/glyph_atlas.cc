@@ -38,6 +38,15 @@ void GlyphAtlasContext::UpdateRectPacker(
   rect_packer_ = std::move(rect_packer);
 }
 
+RectanglePacker::Strategy GlyphAtlasContext::GetRectPackerStrategy() const {
+  return rect_packer_strategy_;
+}
+
+void GlyphAtlasContext::SetRectPackerStrategy(
+    RectanglePacker::Strategy strategy) {
+  rect_packer_strategy_ = strategy;
+}
+
 GlyphAtlas::GlyphAtlas(Type type) : type_(type) {}
 
 GlyphAtlas::~GlyphAtlas() = default;
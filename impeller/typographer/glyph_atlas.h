@@ -164,6 +164,16 @@ class GlyphAtlasContext {
 
   void UpdateRectPacker(std::shared_ptr<RectanglePacker> rect_packer);
 
+  //----------------------------------------------------------------------------
+  /// @brief      The strategy used for rect packers created for this atlas.
+  RectanglePacker::Strategy GetRectPackerStrategy() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Select the strategy used the next time the atlas is
+  ///             regenerated. The current rect packer, if any, keeps its
+  ///             strategy until then.
+  void SetRectPackerStrategy(RectanglePacker::Strategy strategy);
+
  protected:
   GlyphAtlasContext();
 
@@ -171,6 +181,8 @@ class GlyphAtlasContext {
   std::shared_ptr<GlyphAtlas> atlas_;
   ISize atlas_size_;
   std::shared_ptr<RectanglePacker> rect_packer_;
+  RectanglePacker::Strategy rect_packer_strategy_ =
+      RectanglePacker::Strategy::kSkyline;
 
   GlyphAtlasContext(const GlyphAtlasContext&) = delete;
 
@@ -5,6 +5,7 @@
 #include "impeller/typographer/rectangle_packer.h"
 
 #include <algorithm>
+#include <limits>
 #include <vector>
 
 namespace impeller {
@@ -29,6 +30,12 @@ class SkylineRectanglePacker final : public RectanglePacker {
 
   bool addRect(int w, int h, IPoint16* loc) final;
 
+  // The skyline only tracks the top silhouette, so space below it can't be
+  // reclaimed.
+  bool freeRect(IPoint16 loc, int w, int h) final { return false; }
+
+  bool canFreeRects() const final { return false; }
+
   float percentFull() const final {
     return area_so_far_ / ((float)this->width() * this->height());
   }
@@ -166,8 +173,326 @@ void SkylineRectanglePacker::addSkylineLevel(int skylineIndex,
   }
 }
 
-RectanglePacker* RectanglePacker::Factory(int width, int height) {
-  return new SkylineRectanglePacker(width, height);
+namespace {
+
+struct FreeRect {
+  int x_;
+  int y_;
+  int width_;
+  int height_;
+
+  int right() const { return x_ + width_; }
+  int bottom() const { return y_ + height_; }
+
+  bool contains(const FreeRect& other) const {
+    return other.x_ >= x_ && other.y_ >= y_ && other.right() <= right() &&
+           other.bottom() <= bottom();
+  }
+
+  bool intersects(const FreeRect& other) const {
+    return other.x_ < right() && other.right() > x_ && other.y_ < bottom() &&
+           other.bottom() > y_;
+  }
+};
+
+// Merge pairs of free rectangles that share a full edge. Repeats until no more
+// merges are possible.
+void MergeAdjacentFreeRects(std::vector<FreeRect>& free_rects) {
+  bool merged = true;
+  while (merged) {
+    merged = false;
+    for (size_t i = 0; i < free_rects.size(); ++i) {
+      for (size_t j = i + 1; j < free_rects.size(); ++j) {
+        FreeRect& a = free_rects[i];
+        const FreeRect& b = free_rects[j];
+        if (a.x_ == b.x_ && a.width_ == b.width_ &&
+            (a.bottom() == b.y_ || b.bottom() == a.y_)) {
+          a.y_ = std::min(a.y_, b.y_);
+          a.height_ += b.height_;
+        } else if (a.y_ == b.y_ && a.height_ == b.height_ &&
+                   (a.right() == b.x_ || b.right() == a.x_)) {
+          a.x_ = std::min(a.x_, b.x_);
+          a.width_ += b.width_;
+        } else {
+          continue;
+        }
+        free_rects.erase(std::next(free_rects.begin(), j));
+        merged = true;
+        --j;
+      }
+    }
+  }
+}
+
+}  // namespace
+
+// Pack rectangles by tracking the maximal free rectangles of the remaining
+// area, which may overlap one another.
+// Based on Jukka Jylanki's "A Thousand Ways to Pack the Bin".
+class MaxRectsRectanglePacker final : public RectanglePacker {
+ public:
+  MaxRectsRectanglePacker(int w, int h) : RectanglePacker(w, h) {
+    this->reset();
+  }
+
+  ~MaxRectsRectanglePacker() final {}
+
+  void reset() final {
+    area_so_far_ = 0;
+    free_rects_.clear();
+    free_rects_.push_back(FreeRect{0, 0, this->width(), this->height()});
+  }
+
+  bool addRect(int w, int h, IPoint16* loc) final;
+
+  bool freeRect(IPoint16 loc, int w, int h) final;
+
+  bool canFreeRects() const final { return true; }
+
+  float percentFull() const final {
+    return area_so_far_ / ((float)this->width() * this->height());
+  }
+
+ private:
+  std::vector<FreeRect> free_rects_;
+
+  int32_t area_so_far_;
+
+  // Carve 'used' out of every free rectangle it overlaps, replacing each with
+  // up to four maximal rectangles of what remains.
+  void splitFreeRects(const FreeRect& used);
+  // Remove free rectangles that are fully contained in another one.
+  void pruneFreeRects();
+};
+
+bool MaxRectsRectanglePacker::addRect(int width, int height, IPoint16* loc) {
+  loc->x_ = 0;
+  loc->y_ = 0;
+  if (width <= 0 || height <= 0 || width > this->width() ||
+      height > this->height()) {
+    return false;
+  }
+
+  // minimize the leftover on the shorter side first, then the longer side
+  int bestShortSide = std::numeric_limits<int>::max();
+  int bestLongSide = std::numeric_limits<int>::max();
+  int bestIndex = -1;
+  for (int i = 0; i < (int)free_rects_.size(); ++i) {
+    const FreeRect& free_rect = free_rects_[i];
+    if (free_rect.width_ < width || free_rect.height_ < height) {
+      continue;
+    }
+    int leftoverX = free_rect.width_ - width;
+    int leftoverY = free_rect.height_ - height;
+    int shortSide = std::min(leftoverX, leftoverY);
+    int longSide = std::max(leftoverX, leftoverY);
+    if (shortSide < bestShortSide ||
+        (shortSide == bestShortSide && longSide < bestLongSide)) {
+      bestIndex = i;
+      bestShortSide = shortSide;
+      bestLongSide = longSide;
+    }
+  }
+
+  if (-1 == bestIndex) {
+    return false;
+  }
+
+  FreeRect used{free_rects_[bestIndex].x_, free_rects_[bestIndex].y_, width,
+                height};
+  this->splitFreeRects(used);
+  this->pruneFreeRects();
+
+  loc->x_ = used.x_;
+  loc->y_ = used.y_;
+  area_so_far_ += width * height;
+  return true;
+}
+
+bool MaxRectsRectanglePacker::freeRect(IPoint16 loc, int width, int height) {
+  FreeRect freed{loc.x(), loc.y(), width, height};
+  if (width <= 0 || height <= 0 || freed.x_ < 0 || freed.y_ < 0 ||
+      freed.right() > this->width() || freed.bottom() > this->height()) {
+    return false;
+  }
+  area_so_far_ -= width * height;
+
+  // The freed area is not necessarily maximal. Growing it through the
+  // neighboring free space keeps later inserts from fragmenting needlessly.
+  free_rects_.push_back(freed);
+  MergeAdjacentFreeRects(free_rects_);
+  this->pruneFreeRects();
+  return true;
+}
+
+void MaxRectsRectanglePacker::splitFreeRects(const FreeRect& used) {
+  size_t count = free_rects_.size();
+  for (size_t i = 0; i < count;) {
+    const FreeRect free_rect = free_rects_[i];
+    if (!free_rect.intersects(used)) {
+      ++i;
+      continue;
+    }
+    if (used.x_ > free_rect.x_) {
+      free_rects_.push_back(FreeRect{free_rect.x_, free_rect.y_,
+                                     used.x_ - free_rect.x_,
+                                     free_rect.height_});
+    }
+    if (used.right() < free_rect.right()) {
+      free_rects_.push_back(FreeRect{used.right(), free_rect.y_,
+                                     free_rect.right() - used.right(),
+                                     free_rect.height_});
+    }
+    if (used.y_ > free_rect.y_) {
+      free_rects_.push_back(FreeRect{free_rect.x_, free_rect.y_,
+                                     free_rect.width_,
+                                     used.y_ - free_rect.y_});
+    }
+    if (used.bottom() < free_rect.bottom()) {
+      free_rects_.push_back(FreeRect{free_rect.x_, used.bottom(),
+                                     free_rect.width_,
+                                     free_rect.bottom() - used.bottom()});
+    }
+    // Replace the split rectangle with the last unvisited one.
+    free_rects_[i] = free_rects_[count - 1];
+    free_rects_.erase(std::next(free_rects_.begin(), count - 1));
+    --count;
+  }
+}
+
+void MaxRectsRectanglePacker::pruneFreeRects() {
+  for (size_t i = 0; i < free_rects_.size(); ++i) {
+    for (size_t j = i + 1; j < free_rects_.size(); ++j) {
+      if (free_rects_[j].contains(free_rects_[i])) {
+        free_rects_.erase(std::next(free_rects_.begin(), i));
+        --i;
+        break;
+      }
+      if (free_rects_[i].contains(free_rects_[j])) {
+        free_rects_.erase(std::next(free_rects_.begin(), j));
+        --j;
+      }
+    }
+  }
+}
+
+// Pack rectangles by splitting the free rectangle each one is placed in along
+// a single axis, so free rectangles never overlap.
+// Based on Jukka Jylanki's "A Thousand Ways to Pack the Bin".
+class GuillotineRectanglePacker final : public RectanglePacker {
+ public:
+  GuillotineRectanglePacker(int w, int h) : RectanglePacker(w, h) {
+    this->reset();
+  }
+
+  ~GuillotineRectanglePacker() final {}
+
+  void reset() final {
+    area_so_far_ = 0;
+    free_rects_.clear();
+    free_rects_.push_back(FreeRect{0, 0, this->width(), this->height()});
+  }
+
+  bool addRect(int w, int h, IPoint16* loc) final;
+
+  bool freeRect(IPoint16 loc, int w, int h) final;
+
+  bool canFreeRects() const final { return true; }
+
+  float percentFull() const final {
+    return area_so_far_ / ((float)this->width() * this->height());
+  }
+
+ private:
+  std::vector<FreeRect> free_rects_;
+
+  int32_t area_so_far_;
+};
+
+bool GuillotineRectanglePacker::addRect(int width, int height, IPoint16* loc) {
+  loc->x_ = 0;
+  loc->y_ = 0;
+  if (width <= 0 || height <= 0 || width > this->width() ||
+      height > this->height()) {
+    return false;
+  }
+
+  // minimize the leftover area, then the leftover on the shorter side
+  int bestArea = std::numeric_limits<int>::max();
+  int bestShortSide = std::numeric_limits<int>::max();
+  int bestIndex = -1;
+  for (int i = 0; i < (int)free_rects_.size(); ++i) {
+    const FreeRect& free_rect = free_rects_[i];
+    if (free_rect.width_ < width || free_rect.height_ < height) {
+      continue;
+    }
+    int area = free_rect.width_ * free_rect.height_ - width * height;
+    int shortSide =
+        std::min(free_rect.width_ - width, free_rect.height_ - height);
+    if (area < bestArea || (area == bestArea && shortSide < bestShortSide)) {
+      bestIndex = i;
+      bestArea = area;
+      bestShortSide = shortSide;
+    }
+  }
+
+  if (-1 == bestIndex) {
+    return false;
+  }
+
+  const FreeRect free_rect = free_rects_[bestIndex];
+  free_rects_.erase(std::next(free_rects_.begin(), bestIndex));
+
+  // Split along the shorter leftover axis so that the larger of the two
+  // remaining rectangles is as big as possible.
+  int leftoverX = free_rect.width_ - width;
+  int leftoverY = free_rect.height_ - height;
+  FreeRect right{free_rect.x_ + width, free_rect.y_, leftoverX, height};
+  FreeRect bottom{free_rect.x_, free_rect.y_ + height, width, leftoverY};
+  if (leftoverX <= leftoverY) {
+    bottom.width_ = free_rect.width_;
+  } else {
+    right.height_ = free_rect.height_;
+  }
+  if (right.width_ > 0 && right.height_ > 0) {
+    free_rects_.push_back(right);
+  }
+  if (bottom.width_ > 0 && bottom.height_ > 0) {
+    free_rects_.push_back(bottom);
+  }
+  MergeAdjacentFreeRects(free_rects_);
+
+  loc->x_ = free_rect.x_;
+  loc->y_ = free_rect.y_;
+  area_so_far_ += width * height;
+  return true;
+}
+
+bool GuillotineRectanglePacker::freeRect(IPoint16 loc, int width, int height) {
+  FreeRect freed{loc.x(), loc.y(), width, height};
+  if (width <= 0 || height <= 0 || freed.x_ < 0 || freed.y_ < 0 ||
+      freed.right() > this->width() || freed.bottom() > this->height()) {
+    return false;
+  }
+  area_so_far_ -= width * height;
+
+  free_rects_.push_back(freed);
+  MergeAdjacentFreeRects(free_rects_);
+  return true;
+}
+
+RectanglePacker* RectanglePacker::Factory(int width,
+                                          int height,
+                                          Strategy strategy) {
+  switch (strategy) {
+    case Strategy::kSkyline:
+      return new SkylineRectanglePacker(width, height);
+    case Strategy::kMaxRectsBestShortSideFit:
+      return new MaxRectsRectanglePacker(width, height);
+    case Strategy::kGuillotine:
+      return new GuillotineRectanglePacker(width, height);
+  }
+  FML_UNREACHABLE();
 }
 
 }  // namespace impeller
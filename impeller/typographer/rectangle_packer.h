@@ -24,10 +24,24 @@ struct IPoint16 {
 ///
 class RectanglePacker {
  public:
+  enum class Strategy {
+    /// Bottom-left skyline. Cheapest per insert and the least memory, but
+    /// wastes the space below each skyline step and cannot free rectangles.
+    kSkyline,
+    /// Maximal rectangles with the best short side fit heuristic. The densest
+    /// packing of the three at the highest cost per insert.
+    kMaxRectsBestShortSideFit,
+    /// Guillotine splits with the best area fit heuristic, merging adjacent
+    /// free rectangles after each insertion or removal.
+    kGuillotine,
+  };
+
   //----------------------------------------------------------------------------
   /// @brief     Return an empty packer with area specified by width and height.
   ///
-  static RectanglePacker* Factory(int width, int height);
+  static RectanglePacker* Factory(int width,
+                                  int height,
+                                  Strategy strategy = Strategy::kSkyline);
 
   virtual ~RectanglePacker() {}
 
@@ -43,6 +57,24 @@ class RectanglePacker {
   ///
   virtual bool addRect(int width, int height, IPoint16* loc) = 0;
 
+  //----------------------------------------------------------------------------
+  /// @brief     Return the area of a rectangle previously placed by `addRect`
+  ///            to the free space so that it can be reused.
+  ///
+  /// @param[in]  loc     The position returned by `addRect`.
+  /// @param[in]  width   The width passed to `addRect`.
+  /// @param[in]  height  The height passed to `addRect`.
+  ///
+  /// @return     Return true on success; false if the strategy does not
+  ///             support freeing rectangles or the area is out of bounds.
+  ///
+  virtual bool freeRect(IPoint16 loc, int width, int height) = 0;
+
+  //----------------------------------------------------------------------------
+  /// @brief     Whether `freeRect` is supported by this packer's strategy.
+  ///
+  virtual bool canFreeRects() const = 0;
+
   //----------------------------------------------------------------------------
   /// @brief     Returns how much area has been filled with rectangles.
   ///
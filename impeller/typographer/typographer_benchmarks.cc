@@ -0,0 +1,115 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/benchmarking/benchmarking.h"
+
+#include <cmath>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "impeller/typographer/rectangle_packer.h"
+
+namespace impeller {
+
+namespace {
+
+struct GlyphSize {
+  int width;
+  int height;
+};
+
+/// Glyph cell sizes (including atlas padding) for a mix of body, label and
+/// heading text rendered at common device pixel ratios. Glyph widths are
+/// roughly a third to three quarters of the em size, heights half to all of
+/// it, with the occasional tall or wide glyph.
+std::vector<GlyphSize> CreateGlyphSizes(size_t count) {
+  static constexpr int kPadding = 2;
+  static constexpr float kFontSizes[] = {10, 12, 14, 14, 14,
+                                         16, 16, 20, 24, 32};
+  static constexpr float kScales[] = {1.0f, 2.0f, 2.75f, 3.0f};
+
+  // Fixed seed so that every strategy packs the same sequence.
+  std::mt19937 generator(0x1234);
+  std::uniform_int_distribution<size_t> font_size_index(
+      0, std::size(kFontSizes) - 1);
+  std::uniform_int_distribution<size_t> scale_index(0, std::size(kScales) - 1);
+  std::uniform_real_distribution<float> width_factor(0.3f, 0.75f);
+  std::uniform_real_distribution<float> height_factor(0.5f, 1.0f);
+  std::bernoulli_distribution outlier(0.05);
+
+  std::vector<GlyphSize> sizes;
+  sizes.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    float em = kFontSizes[font_size_index(generator)] *
+               kScales[scale_index(generator)];
+    float width = em * width_factor(generator);
+    float height = em * height_factor(generator);
+    if (outlier(generator)) {
+      width *= 1.5f;
+      height *= 1.25f;
+    }
+    sizes.push_back({static_cast<int>(std::ceil(width)) + kPadding,
+                     static_cast<int>(std::ceil(height)) + kPadding});
+  }
+  return sizes;
+}
+
+}  // namespace
+
+/// Fills a fresh atlas with glyph cells until the first insertion fails and
+/// reports how dense the packing got and how long each insertion took.
+template <class... Args>
+static void BM_RectanglePacker(benchmark::State& state, Args&&... args) {
+  auto args_tuple = std::make_tuple(std::move(args)...);
+  auto strategy = std::get<RectanglePacker::Strategy>(args_tuple);
+  const int atlas_size = state.range(0);
+
+  // Enough glyphs to overflow the largest atlas size benchmarked.
+  const auto sizes = CreateGlyphSizes(16384);
+
+  size_t insert_count = 0u;
+  size_t packed_count = 0u;
+  float percent_full = 0.0f;
+  while (state.KeepRunning()) {
+    auto packer = std::unique_ptr<RectanglePacker>(
+        RectanglePacker::Factory(atlas_size, atlas_size, strategy));
+    packed_count = 0u;
+    IPoint16 location;
+    for (const auto& size : sizes) {
+      insert_count++;
+      if (!packer->addRect(size.width, size.height, &location)) {
+        break;
+      }
+      packed_count++;
+    }
+    percent_full = packer->percentFull();
+  }
+  state.counters["PercentFull"] = percent_full;
+  state.counters["GlyphsPacked"] = packed_count;
+  state.counters["TimePerInsert"] = benchmark::Counter(
+      insert_count, benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+
+BENCHMARK_CAPTURE(BM_RectanglePacker,
+                  skyline,
+                  RectanglePacker::Strategy::kSkyline)
+    ->Arg(512)
+    ->Arg(1024)
+    ->Arg(2048);
+BENCHMARK_CAPTURE(BM_RectanglePacker,
+                  max_rects_bssf,
+                  RectanglePacker::Strategy::kMaxRectsBestShortSideFit)
+    ->Arg(512)
+    ->Arg(1024)
+    ->Arg(2048);
+BENCHMARK_CAPTURE(BM_RectanglePacker,
+                  guillotine,
+                  RectanglePacker::Strategy::kGuillotine)
+    ->Arg(512)
+    ->Arg(1024)
+    ->Arg(2048);
+
+}  // namespace impeller
@@ -4,18 +4,84 @@
 
 #include "impeller/typographer/typographer_context.h"
 
+#include <algorithm>
+#include <atomic>
 #include <utility>
 
+#include "flutter/fml/synchronization/count_down_latch.h"
+#include "flutter/fml/trace_event.h"
+
 namespace impeller {
 
 TypographerContext::TypographerContext() {
   is_valid_ = true;
 }
 
+TypographerContext::TypographerContext(
+    std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner)
+    : worker_task_runner_(std::move(worker_task_runner)) {
+  is_valid_ = true;
+}
+
 TypographerContext::~TypographerContext() = default;
 
 bool TypographerContext::IsValid() const {
   return is_valid_;
 }
 
+namespace {
+
+/// Work shared between the calling thread and the workers. Held by a
+/// `shared_ptr` since workers that are scheduled late may still run after the
+/// caller has returned. Those find no remaining indices and never invoke the
+/// task, whose captures may have gone out of scope by then.
+struct ConcurrentRasterizationState {
+  ConcurrentRasterizationState(size_t p_count,
+                               std::function<void(size_t)> p_task)
+      : count(p_count), task(std::move(p_task)), latch(p_count) {}
+
+  const size_t count;
+  const std::function<void(size_t)> task;
+  std::atomic_size_t next_index = 0u;
+  fml::CountDownLatch latch;
+
+  void Drain() {
+    for (size_t index = next_index.fetch_add(1u); index < count;
+         index = next_index.fetch_add(1u)) {
+      task(index);
+      latch.CountDown();
+    }
+  }
+};
+
+}  // namespace
+
+void TypographerContext::RasterizeConcurrently(
+    size_t count,
+    const std::function<void(size_t index)>& task) const {
+  if (count == 0u) {
+    return;
+  }
+  if (!worker_task_runner_ || count < kMinGlyphsForConcurrentRasterization) {
+    for (size_t i = 0; i < count; i++) {
+      task(i);
+    }
+    return;
+  }
+
+  TRACE_EVENT0("impeller", __FUNCTION__);
+  auto state = std::make_shared<ConcurrentRasterizationState>(count, task);
+  // There is no way to query the size of the pool. Post enough tasks to keep
+  // a typical mobile core count busy without flooding the queue for small
+  // updates.
+  static constexpr size_t kMaxWorkerTasks = 4u;
+  const size_t worker_tasks =
+      std::min(kMaxWorkerTasks, count / kMinGlyphsForConcurrentRasterization);
+  for (size_t i = 0; i < worker_tasks; i++) {
+    worker_task_runner_->PostTask([state]() { state->Drain(); });
+  }
+  state->Drain();
+  state->latch.Wait();
+}
+
 }  // namespace impeller
@@ -5,8 +5,10 @@
 #ifndef FLUTTER_IMPELLER_TYPOGRAPHER_TYPOGRAPHER_CONTEXT_H_
 #define FLUTTER_IMPELLER_TYPOGRAPHER_TYPOGRAPHER_CONTEXT_H_
 
+#include <functional>
 #include <memory>
 
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/macros.h"
 #include "impeller/renderer/context.h"
 #include "impeller/typographer/glyph_atlas.h"
@@ -38,6 +40,26 @@ class TypographerContext {
       std::shared_ptr<GlyphAtlasContext> atlas_context,
       const FontGlyphMap& font_glyph_map) const = 0;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Invoke `task` once for every index in `[0, count)` and wait
+  ///             for all invocations to complete.
+  ///
+  ///             If this context has a worker task runner and `count` is at
+  ///             least `kMinGlyphsForConcurrentRasterization`, invocations
+  ///             are distributed over the workers. The calling thread takes
+  ///             part in the work as well so that a busy worker pool can
+  ///             never stall it for longer than a serial loop would.
+  ///             Invocations for distinct indices may run concurrently and
+  ///             must not touch shared mutable state.
+  ///
+  void RasterizeConcurrently(
+      size_t count,
+      const std::function<void(size_t index)>& task) const;
+
+  /// Updates with fewer missing glyphs than this are rasterized on the calling
+  /// thread since the cost of dispatch would outweigh the benefit.
+  static constexpr size_t kMinGlyphsForConcurrentRasterization = 16u;
+
  protected:
   //----------------------------------------------------------------------------
   /// @brief      Create a new context to render text that talks to an
@@ -45,8 +67,22 @@ class TypographerContext {
   ///
   TypographerContext();
 
+  //----------------------------------------------------------------------------
+  /// @brief      Create a new context to render text that rasterizes glyphs
+  ///             on the given worker task runner when enough of them are
+  ///             missing from the atlas.
+  ///
+  /// @param[in]  worker_task_runner  The concurrent task runner used for
+  ///                                 glyph rasterization. May be `nullptr`,
+  ///                                 in which case all glyphs are rasterized
+  ///                                 on the calling thread.
+  ///
+  explicit TypographerContext(
+      std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner);
+
  private:
   bool is_valid_ = false;
+  std::shared_ptr<fml::ConcurrentTaskRunner> worker_task_runner_;
 
   TypographerContext(const TypographerContext&) = delete;
 
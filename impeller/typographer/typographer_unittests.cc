@@ -2,13 +2,18 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <cstring>
+
 #include "flutter/display_list/testing/dl_test_snippets.h"
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/testing/testing.h"
 #include "impeller/playground/playground_test.h"
+#include "impeller/typographer/backends/skia/glyph_atlas_context_skia.h"
 #include "impeller/typographer/backends/skia/text_frame_skia.h"
 #include "impeller/typographer/backends/skia/typographer_context_skia.h"
 #include "impeller/typographer/lazy_glyph_atlas.h"
 #include "impeller/typographer/rectangle_packer.h"
+#include "third_party/skia/include/core/SkBitmap.h"
 #include "third_party/skia/include/core/SkFont.h"
 #include "third_party/skia/include/core/SkFontMgr.h"
 #include "third_party/skia/include/core/SkRect.h"
@@ -167,6 +172,62 @@ TEST_P(TypographerTest, GlyphAtlasIsRecycledIfUnchanged) {
   ASSERT_EQ(atlas_context->GetGlyphAtlas(), atlas);
 }
 
+TEST_P(TypographerTest, GlyphAtlasRasterizedConcurrentlyMatchesSerial) {
+  auto loop = fml::ConcurrentMessageLoop::Create(4u);
+  auto serial_context = TypographerContextSkia::Make();
+  auto concurrent_context = TypographerContextSkia::Make(loop->GetTaskRunner());
+  ASSERT_TRUE(serial_context && serial_context->IsValid());
+  ASSERT_TRUE(concurrent_context && concurrent_context->IsValid());
+
+  SkFont sk_font = flutter::testing::CreateTestFontOfSize(12);
+  auto blob = SkTextBlob::MakeFromString(
+      "The quick brown fox jumps over the lazy dog. 0123456789", sk_font);
+  ASSERT_TRUE(blob);
+  auto frame = MakeTextFrameFromTextBlobSkia(blob);
+
+  auto serial_atlas_context = serial_context->CreateGlyphAtlasContext();
+  auto concurrent_atlas_context =
+      concurrent_context->CreateGlyphAtlasContext();
+  auto serial_atlas = CreateGlyphAtlas(
+      *GetContext(), serial_context.get(), GlyphAtlas::Type::kAlphaBitmap,
+      1.0f, serial_atlas_context, *frame);
+  auto concurrent_atlas = CreateGlyphAtlas(
+      *GetContext(), concurrent_context.get(), GlyphAtlas::Type::kAlphaBitmap,
+      1.0f, concurrent_atlas_context, *frame);
+  ASSERT_NE(serial_atlas, nullptr);
+  ASSERT_NE(concurrent_atlas, nullptr);
+  ASSERT_GE(concurrent_atlas->GetGlyphCount(),
+            TypographerContext::kMinGlyphsForConcurrentRasterization);
+  ASSERT_EQ(serial_atlas->GetGlyphCount(), concurrent_atlas->GetGlyphCount());
+  ASSERT_EQ(serial_atlas->GetTexture()->GetSize(),
+            concurrent_atlas->GetTexture()->GetSize());
+
+  // Packing stays on the calling thread so glyph placement is deterministic.
+  serial_atlas->IterateGlyphs([&](const ScaledFont& scaled_font,
+                                  const Glyph& glyph, const Rect& rect) {
+    auto bounds = concurrent_atlas->FindFontGlyphBounds({scaled_font, glyph});
+    EXPECT_TRUE(bounds.has_value());
+    EXPECT_EQ(bounds.value_or(Rect{}), rect);
+    return true;
+  });
+
+  // The glyphs rasterized on the workers must match the serial ones pixel
+  // for pixel.
+  auto serial_bitmap =
+      GlyphAtlasContextSkia::Cast(*serial_atlas_context).GetBitmap();
+  auto concurrent_bitmap =
+      GlyphAtlasContextSkia::Cast(*concurrent_atlas_context).GetBitmap();
+  ASSERT_TRUE(serial_bitmap && concurrent_bitmap);
+  ASSERT_EQ(serial_bitmap->info(), concurrent_bitmap->info());
+  for (int y = 0; y < serial_bitmap->height(); y++) {
+    ASSERT_EQ(std::memcmp(serial_bitmap->getAddr(0, y),
+                          concurrent_bitmap->getAddr(0, y),
+                          serial_bitmap->info().minRowBytes()),
+              0)
+        << "Row " << y << " differs.";
+  }
+}
+
 TEST_P(TypographerTest, GlyphAtlasWithLotsOfdUniqueGlyphSize) {
   auto context = TypographerContextSkia::Make();
   auto atlas_context = context->CreateGlyphAtlasContext();
@@ -338,6 +399,71 @@ TEST_P(TypographerTest, RectanglePackerAddsNonoverlapingRectangles) {
   ASSERT_EQ(packer->percentFull(), 0);
 }
 
+TEST_P(TypographerTest, RectanglePackerStrategiesAddNonoverlapingRectangles) {
+  for (auto strategy : {RectanglePacker::Strategy::kSkyline,
+                        RectanglePacker::Strategy::kMaxRectsBestShortSideFit,
+                        RectanglePacker::Strategy::kGuillotine}) {
+    auto packer = std::unique_ptr<RectanglePacker>(
+        RectanglePacker::Factory(128, 128, strategy));
+    ASSERT_NE(packer, nullptr);
+
+    const SkIRect packer_area = SkIRect::MakeXYWH(0, 0, 128, 128);
+    std::vector<SkIRect> placed;
+    for (int i = 0; i < 200; i++) {
+      int width = 4 + (i * 7) % 13;
+      int height = 6 + (i * 5) % 11;
+      IPoint16 output = {-1, -1};
+      if (!packer->addRect(width, height, &output)) {
+        continue;
+      }
+      auto rect = SkIRect::MakeXYWH(output.x(), output.y(), width, height);
+      ASSERT_TRUE(packer_area.contains(rect));
+      for (const auto& other : placed) {
+        ASSERT_FALSE(SkIRect::Intersects(rect, other));
+      }
+      placed.push_back(rect);
+    }
+    ASSERT_FALSE(placed.empty());
+    ASSERT_GT(packer->percentFull(), 0.5);
+  }
+}
+
+TEST_P(TypographerTest, RectanglePackerCanReuseFreedRectangles) {
+  auto skyline = std::unique_ptr<RectanglePacker>(RectanglePacker::Factory(
+      100, 100, RectanglePacker::Strategy::kSkyline));
+  ASSERT_FALSE(skyline->canFreeRects());
+  ASSERT_FALSE(skyline->freeRect({0, 0}, 10, 10));
+
+  for (auto strategy : {RectanglePacker::Strategy::kMaxRectsBestShortSideFit,
+                        RectanglePacker::Strategy::kGuillotine}) {
+    auto packer = std::unique_ptr<RectanglePacker>(
+        RectanglePacker::Factory(100, 100, strategy));
+    ASSERT_TRUE(packer->canFreeRects());
+
+    std::vector<IPoint16> locations(4);
+    for (auto& location : locations) {
+      ASSERT_TRUE(packer->addRect(50, 50, &location));
+    }
+    ASSERT_TRUE(flutter::testing::NumberNear(packer->percentFull(), 1.0));
+    IPoint16 output;
+    ASSERT_FALSE(packer->addRect(50, 50, &output));
+
+    ASSERT_TRUE(packer->freeRect(locations[2], 50, 50));
+    ASSERT_TRUE(flutter::testing::NumberNear(packer->percentFull(), 0.75));
+    ASSERT_TRUE(packer->addRect(50, 50, &output));
+    ASSERT_EQ(output.x(), locations[2].x());
+    ASSERT_EQ(output.y(), locations[2].y());
+
+    // Freeing two neighbors makes room for a rectangle spanning both.
+    ASSERT_TRUE(packer->freeRect(locations[0], 50, 50));
+    ASSERT_TRUE(packer->freeRect(locations[1], 50, 50));
+    ASSERT_TRUE(packer->addRect(100, 50, &output) ||
+                packer->addRect(50, 100, &output));
+
+    ASSERT_FALSE(packer->freeRect({90, 90}, 50, 50));
+  }
+}
+
 TEST_P(TypographerTest, GlyphAtlasTextureIsRecycledWhenContentsAreRecreated) {
   auto context = TypographerContextSkia::Make();
   auto atlas_context = context->CreateGlyphAtlasContext();
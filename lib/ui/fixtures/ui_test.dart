@@ -305,6 +305,19 @@ void messageCallback(dynamic data) {}
 @pragma('vm:external-name', 'ValidateConfiguration')
 external void validateConfiguration();
 
+@pragma('vm:entry-point')
+void receiveLargePointerDataPacket() {
+  PlatformDispatcher.instance.onPointerDataPacket = (PointerDataPacket packet) {
+    _reportPointerDataPacket(packet.data.length, packet.data.last.physicalX);
+  };
+  _pointerDataPacketHandlerReady();
+}
+
+@pragma('vm:external-name', 'PointerDataPacketHandlerReady')
+external void _pointerDataPacketHandlerReady();
+@pragma('vm:external-name', 'ReportPointerDataPacket')
+external void _reportPointerDataPacket(int length, double lastPhysicalX);
+
 // Draw a circle on a Canvas that has a PictureRecorder. Take the image from
 // the PictureRecorder, and encode it as png. Check that the png data is
 // backed by an external Uint8List.
@@ -10,4 +10,8 @@ std::shared_ptr<impeller::Context> IOManager::GetImpellerContext() const {
   return nullptr;
 }
 
+std::shared_ptr<DecodedImageCache> IOManager::GetDecodedImageCache() const {
+  return nullptr;
+}
+
 }  // namespace flutter
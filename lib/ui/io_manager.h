@@ -15,6 +15,9 @@ class Context;
 }  // namespace impeller
 
 namespace flutter {
+
+class DecodedImageCache;
+
 // Interface for methods that manage access to the resource GrDirectContext and
 // Skia unref queue.  Meant to be implemented by the owner of the resource
 // GrDirectContext, i.e. the shell's IOManager.
@@ -32,6 +35,10 @@ class IOManager {
   GetIsGpuDisabledSyncSwitch() = 0;
 
   virtual std::shared_ptr<impeller::Context> GetImpellerContext() const;
+
+  // The cache of decoded images shared by the image decoders using this IO
+  // manager, or nullptr if images should not be cached.
+  virtual std::shared_ptr<DecodedImageCache> GetDecodedImageCache() const;
 };
 
 }  // namespace flutter
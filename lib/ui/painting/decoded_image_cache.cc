@@ -0,0 +1,128 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/decoded_image_cache.h"
+
+#include <cstring>
+#include <string_view>
+
+#include "flutter/fml/hash_combine.h"
+#include "flutter/fml/trace_event.h"
+#include "flutter/lib/ui/painting/image_descriptor.h"
+
+namespace flutter {
+
+std::optional<DecodedImageCache::Key> DecodedImageCache::MakeKey(
+    const ImageDescriptor& descriptor,
+    SkISize target_size,
+    uint32_t options) {
+  const auto data = descriptor.data();
+  if (!descriptor.is_compressed() || !data || data->isEmpty()) {
+    return std::nullopt;
+  }
+  TRACE_EVENT0("flutter", "DecodedImageCache::MakeKey");
+  const std::string_view contents(static_cast<const char*>(data->data()),
+                                  data->size());
+  return Key{
+      .content_hash = std::hash<std::string_view>{}(contents),
+      .content_size = data->size(),
+      .target_size = target_size,
+      .options = options,
+      .contents = data,
+  };
+}
+
+bool DecodedImageCache::Key::operator==(const Key& other) const {
+  if (content_hash != other.content_hash ||
+      content_size != other.content_size || target_size != other.target_size ||
+      options != other.options) {
+    return false;
+  }
+  if (contents == other.contents) {
+    return true;
+  }
+  if (!contents || !other.contents ||
+      contents->size() != other.contents->size()) {
+    return false;
+  }
+  return contents->data() == other.contents->data() ||
+         memcmp(contents->data(), other.contents->data(), contents->size()) ==
+             0;
+}
+
+std::size_t DecodedImageCache::KeyHash::operator()(const Key& key) const {
+  return fml::HashCombine(key.content_hash, key.content_size,
+                          key.target_size.width(), key.target_size.height(),
+                          key.options);
+}
+
+DecodedImageCache::DecodedImageCache() = default;
+
+DecodedImageCache::~DecodedImageCache() = default;
+
+sk_sp<DlImage> DecodedImageCache::Get(const Key& key) {
+  std::scoped_lock lock(mutex_);
+  auto found = index_.find(key);
+  if (found == index_.end()) {
+    return nullptr;
+  }
+  entries_.splice(entries_.begin(), entries_, found->second);
+  return found->second->image;
+}
+
+void DecodedImageCache::Put(const Key& key, const sk_sp<DlImage>& image) {
+  if (!image) {
+    return;
+  }
+  const size_t byte_size = image->GetApproximateByteSize();
+
+  std::scoped_lock lock(mutex_);
+  auto found = index_.find(key);
+  if (found != index_.end()) {
+    byte_size_ -= found->second->byte_size;
+    entries_.erase(found->second);
+    index_.erase(found);
+  }
+  if (byte_size > max_bytes_) {
+    return;
+  }
+  EvictToFit(max_bytes_ - byte_size);
+  entries_.push_front(Entry{key, image, byte_size});
+  index_[key] = entries_.begin();
+  byte_size_ += byte_size;
+}
+
+void DecodedImageCache::SetMaxBytes(size_t max_bytes) {
+  std::scoped_lock lock(mutex_);
+  max_bytes_ = max_bytes;
+  EvictToFit(max_bytes_);
+}
+
+void DecodedImageCache::Purge() {
+  std::scoped_lock lock(mutex_);
+  entries_.clear();
+  index_.clear();
+  byte_size_ = 0u;
+}
+
+size_t DecodedImageCache::GetByteSize() const {
+  std::scoped_lock lock(mutex_);
+  return byte_size_;
+}
+
+size_t DecodedImageCache::GetCount() const {
+  std::scoped_lock lock(mutex_);
+  return entries_.size();
+}
+
+void DecodedImageCache::EvictToFit(size_t max_bytes) {
+  while (byte_size_ > max_bytes && !entries_.empty()) {
+    const auto& entry = entries_.back();
+    byte_size_ -= entry.byte_size;
+    index_.erase(entry.key);
+    entries_.pop_back();
+  }
+}
+
+}  // namespace flutter
@@ -0,0 +1,116 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_LIB_UI_PAINTING_DECODED_IMAGE_CACHE_H_
+#define FLUTTER_LIB_UI_PAINTING_DECODED_IMAGE_CACHE_H_
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+#include "flutter/display_list/image/dl_image.h"
+#include "flutter/fml/macros.h"
+#include "third_party/skia/include/core/SkData.h"
+#include "third_party/skia/include/core/SkSize.h"
+
+namespace flutter {
+
+class ImageDescriptor;
+
+/// @brief  A cache of decoded and uploaded images, keyed by the contents of
+///         the encoded image and the options it was decoded with. It allows
+///         the image decoders of all of the engines sharing an `IOManager` to
+///         reuse each other's work when the same encoded image is decoded at
+///         the same size more than once.
+///
+///         The least recently used images are evicted once the total size of
+///         the cached images exceeds the budget, which is zero until it is
+///         set. Each entry also keeps its encoded image alive, which is not
+///         counted against the budget. All methods are thread safe.
+class DecodedImageCache {
+ public:
+  /// @brief  Options of the decoder that affect the decoded image.
+  enum Options : uint32_t {
+    kNone = 0,
+    /// The image was uploaded to an Impeller texture.
+    kImpeller = 1 << 0,
+    /// Wide gamut images keep their color space.
+    kWideGamut = 1 << 1,
+  };
+
+  struct Key {
+    uint64_t content_hash;
+    size_t content_size;
+    SkISize target_size;
+    uint32_t options;
+    /// The encoded image. Keys with the same hash only match if their
+    /// contents are the same, so hash collisions never return the wrong
+    /// image.
+    sk_sp<SkData> contents;
+
+    bool operator==(const Key& other) const;
+  };
+
+  /// @brief  Make the key of an image decoded from `descriptor` at
+  ///         `target_size`. This hashes the encoded image, and so it should
+  ///         not be called on the UI thread.
+  /// @return The key, or std::nullopt if `descriptor` doesn't describe an
+  ///         encoded image. Images created from raw pixels are not cached.
+  static std::optional<Key> MakeKey(const ImageDescriptor& descriptor,
+                                    SkISize target_size,
+                                    uint32_t options);
+
+  DecodedImageCache();
+
+  ~DecodedImageCache();
+
+  /// @brief  Find a cached image and mark it as the most recently used one.
+  sk_sp<DlImage> Get(const Key& key);
+
+  /// @brief  Add an image to the cache, evicting the least recently used
+  ///         images if necessary. Images larger than the whole budget are not
+  ///         cached.
+  void Put(const Key& key, const sk_sp<DlImage>& image);
+
+  /// @brief  Set the maximum total size of the cached images in bytes.
+  void SetMaxBytes(size_t max_bytes);
+
+  /// @brief  Remove all images from the cache, for example in response to a
+  ///         low memory warning.
+  void Purge();
+
+  /// @brief  The approximate total size of the cached images in bytes.
+  size_t GetByteSize() const;
+
+  /// @brief  The number of cached images.
+  size_t GetCount() const;
+
+ private:
+  struct KeyHash {
+    std::size_t operator()(const Key& key) const;
+  };
+
+  struct Entry {
+    Key key;
+    sk_sp<DlImage> image;
+    size_t byte_size;
+  };
+
+  mutable std::mutex mutex_;
+  // Ordered from the most to the least recently used.
+  std::list<Entry> entries_;
+  std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index_;
+  size_t byte_size_ = 0u;
+  size_t max_bytes_ = 0u;
+
+  void EvictToFit(size_t max_bytes);
+
+  FML_DISALLOW_COPY_AND_ASSIGN(DecodedImageCache);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_LIB_UI_PAINTING_DECODED_IMAGE_CACHE_H_
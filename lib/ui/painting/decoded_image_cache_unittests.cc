@@ -0,0 +1,154 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/decoded_image_cache.h"
+
+#include <vector>
+
+#include "flutter/lib/ui/painting/image_descriptor.h"
+#include "flutter/lib/ui/painting/image_generator_registry.h"
+#include "flutter/testing/testing.h"
+#include "third_party/skia/include/core/SkBitmap.h"
+#include "third_party/skia/include/core/SkImage.h"
+
+namespace flutter {
+namespace testing {
+
+static sk_sp<DlImage> MakeImage(int width, int height) {
+  SkBitmap bitmap;
+  bitmap.allocN32Pixels(width, height);
+  bitmap.eraseColor(SK_ColorRED);
+  bitmap.setImmutable();
+  return DlImage::Make(SkImages::RasterFromBitmap(bitmap));
+}
+
+static DecodedImageCache::Key MakeKey(uint64_t content_hash,
+                                      uint8_t content_byte = 0u) {
+  std::vector<uint8_t> contents(100u, content_byte);
+  return DecodedImageCache::Key{
+      .content_hash = content_hash,
+      .content_size = contents.size(),
+      .target_size = SkISize::Make(10, 10),
+      .options = DecodedImageCache::kNone,
+      .contents = SkData::MakeWithCopy(contents.data(), contents.size()),
+  };
+}
+
+TEST(DecodedImageCacheTest, IsDisabledUntilABudgetIsSet) {
+  DecodedImageCache cache;
+  cache.Put(MakeKey(1), MakeImage(10, 10));
+  EXPECT_EQ(cache.GetCount(), 0u);
+  EXPECT_EQ(cache.Get(MakeKey(1)), nullptr);
+}
+
+TEST(DecodedImageCacheTest, FindsImagesByKey) {
+  DecodedImageCache cache;
+  cache.SetMaxBytes(1024 * 1024);
+  auto image = MakeImage(10, 10);
+  cache.Put(MakeKey(1), image);
+
+  EXPECT_EQ(cache.Get(MakeKey(1)), image);
+  EXPECT_EQ(cache.Get(MakeKey(2)), nullptr);
+  auto other_size = MakeKey(1);
+  other_size.target_size = SkISize::Make(5, 5);
+  EXPECT_EQ(cache.Get(other_size), nullptr);
+  auto other_options = MakeKey(1);
+  other_options.options = DecodedImageCache::kImpeller;
+  EXPECT_EQ(cache.Get(other_options), nullptr);
+  EXPECT_EQ(cache.GetByteSize(), image->GetApproximateByteSize());
+}
+
+TEST(DecodedImageCacheTest, ComparesTheContentsOfKeysWithTheSameHash) {
+  DecodedImageCache cache;
+  cache.SetMaxBytes(1024 * 1024);
+  auto image = MakeImage(10, 10);
+  cache.Put(MakeKey(1, 'a'), image);
+
+  // Equal contents in another buffer match, colliding contents don't.
+  EXPECT_EQ(cache.Get(MakeKey(1, 'a')), image);
+  EXPECT_EQ(cache.Get(MakeKey(1, 'b')), nullptr);
+
+  auto colliding = MakeImage(10, 10);
+  cache.Put(MakeKey(1, 'b'), colliding);
+  EXPECT_EQ(cache.GetCount(), 2u);
+  EXPECT_EQ(cache.Get(MakeKey(1, 'a')), image);
+  EXPECT_EQ(cache.Get(MakeKey(1, 'b')), colliding);
+}
+
+TEST(DecodedImageCacheTest, EvictsTheLeastRecentlyUsedImages) {
+  auto first = MakeImage(10, 10);
+  auto second = MakeImage(10, 10);
+  auto third = MakeImage(10, 10);
+  DecodedImageCache cache;
+  cache.SetMaxBytes(first->GetApproximateByteSize() * 2);
+
+  cache.Put(MakeKey(1), first);
+  cache.Put(MakeKey(2), second);
+  // Using the first image makes the second one the least recently used.
+  EXPECT_EQ(cache.Get(MakeKey(1)), first);
+  cache.Put(MakeKey(3), third);
+
+  EXPECT_EQ(cache.GetCount(), 2u);
+  EXPECT_EQ(cache.Get(MakeKey(1)), first);
+  EXPECT_EQ(cache.Get(MakeKey(2)), nullptr);
+  EXPECT_EQ(cache.Get(MakeKey(3)), third);
+
+  cache.SetMaxBytes(first->GetApproximateByteSize());
+  EXPECT_EQ(cache.GetCount(), 1u);
+  EXPECT_EQ(cache.Get(MakeKey(3)), third);
+}
+
+TEST(DecodedImageCacheTest, DoesNotCacheImagesLargerThanTheBudget) {
+  auto small = MakeImage(10, 10);
+  DecodedImageCache cache;
+  cache.SetMaxBytes(small->GetApproximateByteSize());
+  cache.Put(MakeKey(1), small);
+  cache.Put(MakeKey(2), MakeImage(20, 20));
+
+  EXPECT_EQ(cache.GetCount(), 1u);
+  EXPECT_EQ(cache.Get(MakeKey(1)), small);
+}
+
+TEST(DecodedImageCacheTest, CanBePurged) {
+  DecodedImageCache cache;
+  cache.SetMaxBytes(1024 * 1024);
+  cache.Put(MakeKey(1), MakeImage(10, 10));
+  cache.Put(MakeKey(2), MakeImage(10, 10));
+  cache.Purge();
+
+  EXPECT_EQ(cache.GetCount(), 0u);
+  EXPECT_EQ(cache.GetByteSize(), 0u);
+  EXPECT_EQ(cache.Get(MakeKey(1)), nullptr);
+}
+
+TEST(DecodedImageCacheTest, OnlyMakesKeysForEncodedImages) {
+  auto data = OpenFixtureAsSkData("DashInNooglerHat.jpg");
+  ASSERT_TRUE(data);
+  ImageGeneratorRegistry registry;
+  auto generator = registry.CreateCompatibleGenerator(data);
+  ASSERT_TRUE(generator);
+  auto encoded = fml::MakeRefCounted<ImageDescriptor>(data, generator);
+
+  auto key = DecodedImageCache::MakeKey(*encoded, SkISize::Make(10, 10),
+                                        DecodedImageCache::kNone);
+  ASSERT_TRUE(key.has_value());
+  EXPECT_EQ(key->content_size, data->size());
+  auto same_key = DecodedImageCache::MakeKey(
+      *fml::MakeRefCounted<ImageDescriptor>(SkData::MakeWithCopy(
+                                                data->data(), data->size()),
+                                            generator),
+      SkISize::Make(10, 10), DecodedImageCache::kNone);
+  ASSERT_TRUE(same_key.has_value());
+  EXPECT_TRUE(key.value() == same_key.value());
+
+  const auto info = SkImageInfo::MakeN32Premul(10, 10);
+  auto pixels = SkData::MakeUninitialized(info.computeMinByteSize());
+  auto raw = fml::MakeRefCounted<ImageDescriptor>(pixels, info, std::nullopt);
+  EXPECT_FALSE(DecodedImageCache::MakeKey(*raw, SkISize::Make(10, 10),
+                                          DecodedImageCache::kNone)
+                   .has_value());
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -11,6 +11,9 @@
 #include "flutter/assets/asset_manager.h"
 #include "flutter/fml/trace_event.h"
 #include "flutter/impeller/runtime_stage/runtime_stage.h"
+#if IMPELLER_SUPPORTS_RENDERING
+#include "flutter/impeller/entity/contents/runtime_effect_contents.h"
+#endif  // IMPELLER_SUPPORTS_RENDERING
 #include "flutter/lib/ui/dart_wrapper.h"
 #include "flutter/lib/ui/ui_dart_state.h"
 #include "flutter/lib/ui/window/platform_configuration.h"
@@ -26,6 +29,33 @@ namespace flutter {
 
 IMPLEMENT_WRAPPERTYPEINFO(ui, FragmentProgram);
 
+#if IMPELLER_SUPPORTS_RENDERING
+// Start compiling the pipelines of the runtime stage on the raster thread
+// (where the runtime stage is also drawn) so that the first frame that uses
+// the effect does not have to wait for them.
+static void PrewarmRuntimeStage(
+    UIDartState* dart_state,
+    std::shared_ptr<impeller::RuntimeStage> runtime_stage) {
+  const auto& task_runners = dart_state->GetTaskRunners();
+  // The Impeller context is only accessible through the IO manager on the IO
+  // thread.
+  task_runners.GetIOTaskRunner()->PostTask(
+      [io_manager = dart_state->GetIOManager(),
+       raster_task_runner = task_runners.GetRasterTaskRunner(),
+       runtime_stage = std::move(runtime_stage)]() {
+        auto context = io_manager ? io_manager->GetImpellerContext() : nullptr;
+        if (!context) {
+          return;
+        }
+        raster_task_runner->PostTask([context, runtime_stage]() {
+          TRACE_EVENT0("flutter", "PrewarmRuntimeStage");
+          impeller::RuntimeEffectContents::PrewarmPipelines(context,
+                                                            runtime_stage);
+        });
+      });
+}
+#endif  // IMPELLER_SUPPORTS_RENDERING
+
 std::string FragmentProgram::initFromAsset(const std::string& asset_name) {
   FML_TRACE_EVENT("flutter", "FragmentProgram::initFromAsset", "asset",
                   asset_name);
@@ -56,8 +86,13 @@ std::string FragmentProgram::initFromAsset(const std::string& asset_name) {
   }
 
   if (UIDartState::Current()->IsImpellerEnabled()) {
-    runtime_effect_ = DlRuntimeEffect::MakeImpeller(
-        std::make_unique<impeller::RuntimeStage>(std::move(runtime_stage)));
+    auto impeller_runtime_stage =
+        std::make_shared<impeller::RuntimeStage>(std::move(runtime_stage));
+#if IMPELLER_SUPPORTS_RENDERING
+    PrewarmRuntimeStage(UIDartState::Current(), impeller_runtime_stage);
+#endif  // IMPELLER_SUPPORTS_RENDERING
+    runtime_effect_ =
+        DlRuntimeEffect::MakeImpeller(std::move(impeller_runtime_stage));
   } else {
     const auto& code_mapping = runtime_stage.GetSkSLMapping();
     auto code_size = code_mapping->GetSize();
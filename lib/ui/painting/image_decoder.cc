@@ -42,14 +42,28 @@ ImageDecoder::ImageDecoder(
     : runners_(runners),
       concurrent_task_runner_(std::move(concurrent_task_runner)),
       io_manager_(std::move(io_manager)),
+      decoded_image_cache_slot_(std::make_shared<DecodedImageCacheSlot>()),
       weak_factory_(this) {
   FML_DCHECK(runners_.IsValid());
   FML_DCHECK(runners_.GetUITaskRunner()->RunsTasksOnCurrentThread())
       << "The image decoder must be created & collected on the UI thread.";
+  runners_.GetIOTaskRunner()->PostTask(
+      [io_manager = io_manager_, slot = decoded_image_cache_slot_]() {
+        if (!io_manager) {
+          return;
+        }
+        std::scoped_lock lock(slot->mutex);
+        slot->cache = io_manager->GetDecodedImageCache();
+      });
 }
 
 ImageDecoder::~ImageDecoder() = default;
 
+std::shared_ptr<DecodedImageCache> ImageDecoder::GetDecodedImageCache() const {
+  std::scoped_lock lock(decoded_image_cache_slot_->mutex);
+  return decoded_image_cache_slot_->cache.lock();
+}
+
 fml::WeakPtr<ImageDecoder> ImageDecoder::GetWeakPtr() const {
   return weak_factory_.GetWeakPtr();
 }
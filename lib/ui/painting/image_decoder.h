@@ -6,12 +6,14 @@
 #define FLUTTER_LIB_UI_PAINTING_IMAGE_DECODER_H_
 
 #include <memory>
+#include <mutex>
 
 #include "flutter/common/settings.h"
 #include "flutter/common/task_runners.h"
 #include "flutter/display_list/image/dl_image.h"
 #include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/lib/ui/io_manager.h"
+#include "flutter/lib/ui/painting/decoded_image_cache.h"
 #include "flutter/lib/ui/painting/image_descriptor.h"
 
 namespace flutter {
@@ -56,7 +58,21 @@ class ImageDecoder {
       std::shared_ptr<fml::ConcurrentTaskRunner> concurrent_task_runner,
       fml::WeakPtr<IOManager> io_manager);
 
+  /// @brief  The cache of decoded images shared by the engines using the IO
+  ///         manager. This may be called on any thread, and returns nullptr
+  ///         until the cache has been obtained from the IO manager on the IO
+  ///         thread or if the IO manager doesn't provide one.
+  std::shared_ptr<DecodedImageCache> GetDecodedImageCache() const;
+
  private:
+  // The IO manager may only be accessed on the IO thread, so its cache is
+  // obtained there once and handed to the other threads through this slot.
+  struct DecodedImageCacheSlot {
+    std::mutex mutex;
+    std::weak_ptr<DecodedImageCache> cache;
+  };
+
+  std::shared_ptr<DecodedImageCacheSlot> decoded_image_cache_slot_;
   fml::WeakPtrFactory<ImageDecoder> weak_factory_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(ImageDecoder);
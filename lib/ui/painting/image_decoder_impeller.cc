@@ -5,6 +5,7 @@
 #include "flutter/lib/ui/painting/image_decoder_impeller.h"
 
 #include <memory>
+#include <optional>
 
 #include "flutter/fml/closure.h"
 #include "flutter/fml/make_copyable.h"
@@ -14,7 +15,10 @@
 #include "flutter/impeller/display_list/dl_image_impeller.h"
 #include "flutter/impeller/renderer/command_buffer.h"
 #include "flutter/impeller/renderer/context.h"
+#include "flutter/lib/ui/painting/decoded_image_cache.h"
 #include "flutter/lib/ui/painting/image_decoder_skia.h"
+#include "flutter/lib/ui/painting/pixel_conversions.h"
+#include "flutter/lib/ui/painting/scanline_downsampler.h"
 #include "impeller/base/strings.h"
 #include "impeller/display_list/skia_conversions.h"
 #include "impeller/geometry/size.h"
@@ -132,6 +136,9 @@ ImageDecoderImpeller::ImageDecoderImpeller(
 
 ImageDecoderImpeller::~ImageDecoderImpeller() = default;
 
+// The number of rows decoded at a time when downsampling by scanlines.
+static constexpr int kDecodeBandHeight = 64;
+
 static SkColorType ChooseCompatibleColorType(SkColorType type) {
   switch (type) {
     case kRGBA_F32_SkColorType:
@@ -208,6 +215,31 @@ DecompressResult ImageDecoderImpeller::DecompressTexture(
     return DecompressResult{.decode_error = decode_error};
   }
 
+  if (descriptor->is_compressed() && decode_size != target_size) {
+    // Prefer downsampling the image while it is decoded, so that it never
+    // has to be held in memory at the decoded size.
+    TRACE_EVENT0("impeller", "DecodeDownsample");
+    const auto scaled_image_info = image_info.makeDimensions(target_size);
+    if (ScanlineDownsampler::CanDownsample(image_info, scaled_image_info)) {
+      auto scaled_bitmap = std::make_shared<SkBitmap>();
+      auto scaled_allocator = std::make_shared<ImpellerAllocator>(allocator);
+      scaled_bitmap->setInfo(scaled_image_info);
+      if (scaled_bitmap->tryAllocPixels(scaled_allocator.get()) &&
+          descriptor->get_downsampled_pixels(
+              scaled_bitmap->pixmap(), decode_size, kDecodeBandHeight)) {
+        scaled_bitmap->setImmutable();
+        auto buffer = scaled_allocator->GetDeviceBuffer();
+        if (!buffer) {
+          return DecompressResult{.decode_error =
+                                      "Unable to get device buffer"};
+        }
+        return DecompressResult{.device_buffer = buffer,
+                                .sk_bitmap = scaled_bitmap,
+                                .image_info = scaled_bitmap->info()};
+      }
+    }
+  }
+
   auto bitmap = std::make_shared<SkBitmap>();
   bitmap->setInfo(image_info);
   auto bitmap_allocator = std::make_shared<ImpellerAllocator>(allocator);
@@ -220,6 +252,12 @@ DecompressResult ImageDecoderImpeller::DecompressTexture(
       return DecompressResult{.decode_error = decode_error};
     }
     // Decode the image into the image generator's closest supported size.
+    //
+    // This is done in one pass rather than in bands uploaded as they
+    // complete. The descriptor always holds the complete encoded image and a
+    // codec hands out whole frames, so partially decoded rows would never be
+    // shown, and the staging buffer has to hold every row until the upload
+    // anyway.
     if (!descriptor->get_pixels(bitmap->pixmap())) {
       std::string decode_error("Could not decompress image.");
       FML_DLOG(ERROR) << decode_error;
@@ -238,7 +276,12 @@ DecompressResult ImageDecoderImpeller::DecompressTexture(
       FML_DLOG(ERROR) << decode_error;
       return DecompressResult{.decode_error = decode_error};
     }
-    temp_bitmap->readPixels(bitmap->pixmap());
+    // Raw pixels usually only need their channels swizzled or their floats
+    // narrowed, which the vectorized kernels do without going through the
+    // general purpose pixel conversion.
+    if (!ConvertPixels(temp_bitmap->pixmap(), bitmap->pixmap())) {
+      temp_bitmap->readPixels(bitmap->pixmap());
+    }
     bitmap->setImmutable();
   }
 
@@ -502,11 +545,32 @@ void ImageDecoderImpeller::Decode(fml::RefPtr<ImageDescriptor> descriptor,
        io_runner = runners_.GetIOTaskRunner(),                    //
        result,
        supports_wide_gamut = supports_wide_gamut_,  //
-       gpu_disabled_switch = gpu_disabled_switch_]() {
+       gpu_disabled_switch = gpu_disabled_switch_,  //
+       cache = GetDecodedImageCache()]() mutable {
         if (!context) {
           result(nullptr, "No Impeller context is available");
           return;
         }
+        std::optional<DecodedImageCache::Key> cache_key;
+        if (cache) {
+          uint32_t options = DecodedImageCache::kImpeller;
+          if (supports_wide_gamut) {
+            options |= DecodedImageCache::kWideGamut;
+          }
+          cache_key =
+              DecodedImageCache::MakeKey(*raw_descriptor, target_size, options);
+        }
+        if (cache_key.has_value()) {
+          if (auto image = cache->Get(cache_key.value())) {
+            result(std::move(image), {});
+            return;
+          }
+          result = [result, cache, key = cache_key.value()](
+                       sk_sp<DlImage> image, std::string decode_error) {
+            cache->Put(key, image);
+            result(std::move(image), std::move(decode_error));
+          };
+        }
         auto max_size_supported =
             context->GetResourceAllocator()->GetMaxTextureSizeSupported();
 
@@ -5,9 +5,11 @@
 #include "flutter/lib/ui/painting/image_decoder_skia.h"
 
 #include <algorithm>
+#include <optional>
 
 #include "flutter/fml/logging.h"
 #include "flutter/fml/make_copyable.h"
+#include "flutter/lib/ui/painting/decoded_image_cache.h"
 #include "flutter/lib/ui/painting/display_list_image_gpu.h"
 #include "third_party/skia/include/core/SkBitmap.h"
 #include "third_party/skia/include/core/SkImage.h"
@@ -244,17 +246,36 @@ void ImageDecoderSkia::Decode(fml::RefPtr<ImageDescriptor> descriptor_ref_ptr,
   FML_DCHECK(runners_.GetUITaskRunner()->RunsTasksOnCurrentThread());
 
   // Always service the callback (and cleanup the descriptor) on the UI thread.
+  // Images decoded with a cache key are added to the decoded image cache.
+  auto cache = GetDecodedImageCache();
   auto result =
+      [callback, raw_descriptor, cache, ui_runner = runners_.GetUITaskRunner()](
+          SkiaGPUObject<SkImage> image, fml::tracing::TraceFlow flow,
+          std::optional<DecodedImageCache::Key> cache_key = std::nullopt) {
+        ui_runner->PostTask(fml::MakeCopyable(
+            [callback, raw_descriptor, cache, cache_key,
+             image = std::move(image), flow = std::move(flow)]() mutable {
+              // We are going to terminate the trace flow here. Flows cannot
+              // terminate without a base trace. Add one explicitly.
+              TRACE_EVENT0("flutter", "ImageDecodeCallback");
+              flow.End();
+              auto dl_image = DlImageGPU::Make(std::move(image));
+              if (cache && cache_key.has_value()) {
+                cache->Put(cache_key.value(), dl_image);
+              }
+              callback(std::move(dl_image), {});
+              raw_descriptor->Release();
+            }));
+      };
+  auto cached_result =
       [callback, raw_descriptor, ui_runner = runners_.GetUITaskRunner()](
-          SkiaGPUObject<SkImage> image, fml::tracing::TraceFlow flow) {
+          sk_sp<DlImage> image, fml::tracing::TraceFlow flow) {
         ui_runner->PostTask(fml::MakeCopyable(
             [callback, raw_descriptor, image = std::move(image),
              flow = std::move(flow)]() mutable {
-              // We are going to terminate the trace flow here. Flows cannot
-              // terminate without a base trace. Add one explicitly.
               TRACE_EVENT0("flutter", "ImageDecodeCallback");
               flow.End();
-              callback(DlImageGPU::Make(std::move(image)), {});
+              callback(std::move(image), {});
               raw_descriptor->Release();
             }));
       };
@@ -269,10 +290,28 @@ void ImageDecoderSkia::Decode(fml::RefPtr<ImageDescriptor> descriptor_ref_ptr,
                          io_manager = io_manager_,                //
                          io_runner = runners_.GetIOTaskRunner(),  //
                          result,                                  //
+                         cached_result,                           //
+                         cache,                                   //
                          target_width = target_width,             //
                          target_height = target_height,           //
                          flow = std::move(flow)                   //
   ]() mutable {
+        // Step 0: Reuse an image that has already been decoded at this size.
+        // On Worker.
+
+        std::optional<DecodedImageCache::Key> cache_key;
+        if (cache) {
+          cache_key = DecodedImageCache::MakeKey(
+              *raw_descriptor, SkISize::Make(target_width, target_height),
+              DecodedImageCache::kNone);
+        }
+        if (cache_key.has_value()) {
+          if (auto image = cache->Get(cache_key.value())) {
+            cached_result(std::move(image), std::move(flow));
+            return;
+          }
+        }
+
         // Step 1: Decompress the image.
         // On Worker.
 
@@ -296,6 +335,7 @@ void ImageDecoderSkia::Decode(fml::RefPtr<ImageDescriptor> descriptor_ref_ptr,
         // On IO Thread.
 
         io_runner->PostTask(fml::MakeCopyable([io_manager, decompressed, result,
+                                               cache_key,
                                                flow =
                                                    std::move(flow)]() mutable {
           if (!io_manager) {
@@ -309,7 +349,7 @@ void ImageDecoderSkia::Decode(fml::RefPtr<ImageDescriptor> descriptor_ref_ptr,
           // Either way, just return the image as-is.
           if (!io_manager->GetResourceContext()) {
             result({std::move(decompressed), io_manager->GetSkiaUnrefQueue()},
-                   std::move(flow));
+                   std::move(flow), cache_key);
             return;
           }
 
@@ -323,7 +363,7 @@ void ImageDecoderSkia::Decode(fml::RefPtr<ImageDescriptor> descriptor_ref_ptr,
           }
 
           // Finally, all done.
-          result(std::move(uploaded), std::move(flow));
+          result(std::move(uploaded), std::move(flow), cache_key);
         }));
       }));
 }
@@ -2,6 +2,9 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+#include <atomic>
+
 #include "flutter/common/task_runners.h"
 #include "flutter/fml/mapping.h"
 #include "flutter/fml/synchronization/waitable_event.h"
@@ -24,9 +27,11 @@
 #include "flutter/testing/test_gl_surface.h"
 #include "flutter/testing/testing.h"
 #include "third_party/skia/include/codec/SkCodecAnimation.h"
+#include "third_party/skia/include/core/SkBitmap.h"
 #include "third_party/skia/include/core/SkData.h"
 #include "third_party/skia/include/core/SkImage.h"
 #include "third_party/skia/include/core/SkImageInfo.h"
+#include "third_party/skia/include/core/SkSamplingOptions.h"
 #include "third_party/skia/include/core/SkSize.h"
 #include "third_party/skia/include/encode/SkPngEncoder.h"
 
@@ -145,10 +150,19 @@ class TestIOManager final : public IOManager {
     return impeller_context_;
   }
 
+  // |IOManager|
+  std::shared_ptr<DecodedImageCache> GetDecodedImageCache() const override {
+    return decoded_image_cache_;
+  }
+
   void SetGpuDisabled(bool disabled) {
     is_gpu_disabled_sync_switch_->SetSwitch(disabled);
   }
 
+  void SetDecodedImageCache(std::shared_ptr<DecodedImageCache> cache) {
+    decoded_image_cache_ = std::move(cache);
+  }
+
   bool did_access_is_gpu_disabled_sync_switch_ = false;
 
  private:
@@ -161,11 +175,59 @@ class TestIOManager final : public IOManager {
   fml::WeakPtr<TestIOManager> weak_prototype_;
   fml::RefPtr<fml::TaskRunner> runner_;
   std::shared_ptr<fml::SyncSwitch> is_gpu_disabled_sync_switch_;
+  std::shared_ptr<DecodedImageCache> decoded_image_cache_;
   fml::WeakPtrFactory<TestIOManager> weak_factory_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(TestIOManager);
 };
 
+/// Forwards to another generator and counts the decodes.
+class CountingImageGenerator : public ImageGenerator {
+ public:
+  CountingImageGenerator(std::shared_ptr<ImageGenerator> generator,
+                         std::shared_ptr<std::atomic_int> decode_count)
+      : generator_(std::move(generator)),
+        decode_count_(std::move(decode_count)) {}
+
+  // |ImageGenerator|
+  const SkImageInfo& GetInfo() override { return generator_->GetInfo(); }
+
+  // |ImageGenerator|
+  unsigned int GetFrameCount() const override {
+    return generator_->GetFrameCount();
+  }
+
+  // |ImageGenerator|
+  unsigned int GetPlayCount() const override {
+    return generator_->GetPlayCount();
+  }
+
+  // |ImageGenerator|
+  const FrameInfo GetFrameInfo(unsigned int frame_index) override {
+    return generator_->GetFrameInfo(frame_index);
+  }
+
+  // |ImageGenerator|
+  SkISize GetScaledDimensions(float scale) override {
+    return generator_->GetScaledDimensions(scale);
+  }
+
+  // |ImageGenerator|
+  bool GetPixels(const SkImageInfo& info,
+                 void* pixels,
+                 size_t row_bytes,
+                 unsigned int frame_index,
+                 std::optional<unsigned int> prior_frame) override {
+    (*decode_count_)++;
+    return generator_->GetPixels(info, pixels, row_bytes, frame_index,
+                                 prior_frame);
+  }
+
+ private:
+  std::shared_ptr<ImageGenerator> generator_;
+  std::shared_ptr<std::atomic_int> decode_count_;
+};
+
 class ImageDecoderFixtureTest : public FixtureTest {};
 
 TEST_F(ImageDecoderFixtureTest, CanCreateImageDecoder) {
@@ -596,6 +658,83 @@ TEST_F(ImageDecoderFixtureTest, CanDecodeWithoutAGPUContext) {
   latch.Wait();
 }
 
+TEST_F(ImageDecoderFixtureTest, DecodingTheSameBytesTwiceHitsTheCache) {
+  auto loop = fml::ConcurrentMessageLoop::Create();
+  TaskRunners runners(GetCurrentTestName(),         // label
+                      CreateNewThread("platform"),  // platform
+                      CreateNewThread("raster"),    // raster
+                      CreateNewThread("ui"),        // ui
+                      CreateNewThread("io")         // io
+  );
+
+  auto data = flutter::testing::OpenFixtureAsSkData("DashInNooglerHat.jpg");
+  ASSERT_TRUE(data);
+  auto decode_count = std::make_shared<std::atomic_int>(0);
+  auto make_descriptor = [&](sk_sp<SkData> bytes) {
+    ImageGeneratorRegistry registry;
+    auto generator = std::make_shared<CountingImageGenerator>(
+        registry.CreateCompatibleGenerator(bytes), decode_count);
+    return fml::MakeRefCounted<ImageDescriptor>(std::move(bytes),
+                                                std::move(generator));
+  };
+
+  std::unique_ptr<TestIOManager> io_manager;
+  std::unique_ptr<ImageDecoder> image_decoder;
+  sk_sp<DlImage> first_image;
+  sk_sp<DlImage> second_image;
+  int decode_count_after_first_decode = 0;
+  fml::AutoResetWaitableEvent latch;
+
+  auto decode_second = [&]() {
+    // The same bytes in another buffer.
+    auto descriptor =
+        make_descriptor(SkData::MakeWithCopy(data->data(), data->size()));
+    image_decoder->Decode(descriptor, 100, 100,
+                          [&](const sk_sp<DlImage>& image,
+                              const std::string& decode_error) {
+                            second_image = image;
+                            latch.Signal();
+                          });
+  };
+
+  auto decode_first = [&]() {
+    auto descriptor = make_descriptor(data);
+    image_decoder->Decode(
+        descriptor, 100, 100,
+        [&](const sk_sp<DlImage>& image, const std::string& decode_error) {
+          first_image = image;
+          decode_count_after_first_decode = decode_count->load();
+          decode_second();
+        });
+  };
+
+  PostTaskSync(runners.GetIOTaskRunner(), [&]() {
+    io_manager =
+        std::make_unique<TestIOManager>(runners.GetIOTaskRunner(), false);
+    auto cache = std::make_shared<DecodedImageCache>();
+    cache->SetMaxBytes(100 * 1024 * 1024);
+    io_manager->SetDecodedImageCache(std::move(cache));
+  });
+  PostTaskSync(runners.GetUITaskRunner(), [&]() {
+    Settings settings;
+    image_decoder = ImageDecoder::Make(settings, runners, loop->GetTaskRunner(),
+                                       io_manager->GetWeakIOManager(),
+                                       std::make_shared<fml::SyncSwitch>());
+  });
+  // The decoder finds the cache on the IO runner.
+  PostTaskSync(runners.GetIOTaskRunner(), []() {});
+  runners.GetUITaskRunner()->PostTask(decode_first);
+  latch.Wait();
+
+  ASSERT_TRUE(first_image);
+  EXPECT_GT(decode_count_after_first_decode, 0);
+  EXPECT_EQ(second_image, first_image);
+  EXPECT_EQ(decode_count->load(), decode_count_after_first_decode);
+
+  PostTaskSync(runners.GetUITaskRunner(), [&]() { image_decoder.reset(); });
+  PostTaskSync(runners.GetIOTaskRunner(), [&]() { io_manager.reset(); });
+}
+
 TEST_F(ImageDecoderFixtureTest, CanDecodeWithResizes) {
   const auto image_dimensions =
       SkImages::DeferredFromEncodedData(
@@ -792,6 +931,106 @@ TEST(ImageDecoderTest, VerifySubpixelDecodingPreservesExifOrientation) {
   assert_image(decode(300, 100), {});
 }
 
+TEST(ImageDecoderTest, ScanlinesMatchGetPixels) {
+  auto data = flutter::testing::OpenFixtureAsSkData("DashInNooglerHat.jpg");
+  ASSERT_TRUE(data);
+  ImageGeneratorRegistry registry;
+  std::shared_ptr<ImageGenerator> generator =
+      registry.CreateCompatibleGenerator(data);
+  ASSERT_TRUE(generator);
+
+  const auto info = generator->GetInfo().makeColorType(kRGBA_8888_SkColorType);
+  SkBitmap expected;
+  ASSERT_TRUE(expected.tryAllocPixels(info));
+  ASSERT_TRUE(generator->GetPixels(info, expected.getPixels(),
+                                   expected.rowBytes()));
+
+  SkBitmap actual;
+  ASSERT_TRUE(actual.tryAllocPixels(info));
+  ASSERT_TRUE(generator->StartScanlineDecode(info));
+  for (int first_row = 0; first_row < info.height(); first_row += 16) {
+    const int row_count = std::min(16, info.height() - first_row);
+    ASSERT_EQ(generator->GetScanlines(actual.getAddr(0, first_row), row_count,
+                                      actual.rowBytes()),
+              row_count);
+  }
+  EXPECT_EQ(memcmp(actual.getPixels(), expected.getPixels(),
+                   expected.computeByteSize()),
+            0);
+}
+
+TEST(ImageDecoderTest, CanDownsampleWhileDecodingScanlines) {
+  auto data = flutter::testing::OpenFixtureAsSkData("DashInNooglerHat.jpg");
+  ASSERT_TRUE(data);
+  ImageGeneratorRegistry registry;
+  std::shared_ptr<ImageGenerator> generator =
+      registry.CreateCompatibleGenerator(data);
+  ASSERT_TRUE(generator);
+  auto descriptor = fml::MakeRefCounted<ImageDescriptor>(std::move(data),
+                                                         std::move(generator));
+
+  const auto decode_size = descriptor->get_scaled_dimensions(0.125);
+  const auto info = descriptor->image_info()
+                        .makeWH(50, 50)
+                        .makeColorType(kRGBA_8888_SkColorType);
+  SkBitmap downsampled;
+  ASSERT_TRUE(downsampled.tryAllocPixels(info));
+  ASSERT_TRUE(descriptor->get_downsampled_pixels(downsampled.pixmap(),
+                                                 decode_size, 16));
+
+  // The result is close to scaling the fully decoded image.
+  SkBitmap decoded;
+  ASSERT_TRUE(decoded.tryAllocPixels(info.makeDimensions(decode_size)));
+  ASSERT_TRUE(descriptor->get_pixels(decoded.pixmap()));
+  SkBitmap scaled;
+  ASSERT_TRUE(scaled.tryAllocPixels(info));
+  ASSERT_TRUE(decoded.pixmap().scalePixels(
+      scaled.pixmap(),
+      SkSamplingOptions(SkFilterMode::kLinear, SkMipmapMode::kNone)));
+  double difference = 0;
+  const auto* a = static_cast<const uint8_t*>(downsampled.getPixels());
+  const auto* b = static_cast<const uint8_t*>(scaled.getPixels());
+  for (size_t i = 0; i < info.computeMinByteSize(); i++) {
+    difference += std::abs(a[i] - b[i]);
+  }
+  EXPECT_LT(difference / info.computeMinByteSize(), 16.0);
+}
+
+TEST(ImageDecoderTest, CannotDownsampleImagesThatNeedReorientation) {
+  auto data = flutter::testing::OpenFixtureAsSkData("Horizontal.jpg");
+  ImageGeneratorRegistry registry;
+  std::shared_ptr<ImageGenerator> generator =
+      registry.CreateCompatibleGenerator(data);
+  ASSERT_TRUE(generator);
+  auto descriptor =
+      fml::MakeRefCounted<ImageDescriptor>(data, std::move(generator));
+
+  const auto info = descriptor->image_info()
+                        .makeWH(60, 20)
+                        .makeColorType(kRGBA_8888_SkColorType);
+  SkBitmap bitmap;
+  ASSERT_TRUE(bitmap.tryAllocPixels(info));
+  EXPECT_FALSE(descriptor->get_downsampled_pixels(
+      bitmap.pixmap(), descriptor->image_info().dimensions(), 16));
+}
+
+TEST(ImageDecoderTest, CannotDecodeScanlinesOfImagesThatNeedReorientation) {
+  auto data = flutter::testing::OpenFixtureAsSkData("Horizontal.jpg");
+  ImageGeneratorRegistry registry;
+  std::shared_ptr<ImageGenerator> generator =
+      registry.CreateCompatibleGenerator(data);
+  ASSERT_TRUE(generator);
+
+  // Rotated rows aren't final until the whole image is decoded, so these
+  // images must go through GetPixels.
+  const auto& info = generator->GetInfo();
+  EXPECT_FALSE(generator->StartScanlineDecode(info));
+  SkBitmap bitmap;
+  ASSERT_TRUE(bitmap.tryAllocPixels(info));
+  EXPECT_TRUE(
+      generator->GetPixels(info, bitmap.getPixels(), bitmap.rowBytes()));
+}
+
 TEST_F(ImageDecoderFixtureTest,
        MultiFrameCodecCanBeCollectedBeforeIOTasksFinish) {
   // This test verifies that the MultiFrameCodec safely shares state between
@@ -4,12 +4,16 @@
 
 #include "flutter/lib/ui/painting/image_descriptor.h"
 
+#include <algorithm>
+
 #include "flutter/fml/build_config.h"
 #include "flutter/fml/logging.h"
 #include "flutter/fml/trace_event.h"
 #include "flutter/lib/ui/painting/multi_frame_codec.h"
+#include "flutter/lib/ui/painting/scanline_downsampler.h"
 #include "flutter/lib/ui/painting/single_frame_codec.h"
 #include "flutter/lib/ui/ui_dart_state.h"
+#include "third_party/skia/include/core/SkBitmap.h"
 #include "third_party/tonic/dart_binding_macros.h"
 #include "third_party/tonic/logging/dart_invoke.h"
 
@@ -131,4 +135,36 @@ bool ImageDescriptor::get_pixels(const SkPixmap& pixmap) const {
                                pixmap.rowBytes());
 }
 
+bool ImageDescriptor::get_downsampled_pixels(const SkPixmap& pixmap,
+                                             SkISize decode_size,
+                                             int band_height) const {
+  FML_DCHECK(generator_);
+  const auto decode_info = pixmap.info().makeDimensions(decode_size);
+  if (band_height <= 0 ||
+      !ScanlineDownsampler::CanDownsample(decode_info, pixmap.info()) ||
+      !generator_->StartScanlineDecode(decode_info)) {
+    return false;
+  }
+
+  SkBitmap band;
+  if (!band.tryAllocPixels(decode_info.makeWH(
+          decode_size.width(), std::min(band_height, decode_size.height())))) {
+    return false;
+  }
+  ScanlineDownsampler downsampler(decode_size, pixmap);
+  for (int first_row = 0; first_row < decode_size.height();
+       first_row += band_height) {
+    const int row_count =
+        std::min(band_height, decode_size.height() - first_row);
+    if (generator_->GetScanlines(band.getPixels(), row_count,
+                                 band.rowBytes()) != row_count) {
+      FML_DLOG(WARNING) << "Could not get scanlines " << first_row << " to "
+                        << first_row + row_count << ".";
+      return false;
+    }
+    downsampler.AddRows(band.getPixels(), row_count, band.rowBytes());
+  }
+  return downsampler.IsComplete();
+}
+
 }  // namespace flutter
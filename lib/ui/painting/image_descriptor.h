@@ -110,6 +110,17 @@ class ImageDescriptor : public RefCountedDartWrappable<ImageDescriptor> {
   ///         orientation tag, if applicable.
   bool get_pixels(const SkPixmap& pixmap) const;
 
+  /// @brief  Gets pixels for this image decoded at `decode_size` and area
+  ///         averaged down to the size of `pixmap` while it is decoded by
+  ///         scanlines, so that the image is never held in memory at
+  ///         `decode_size`.
+  /// @return False if the image could not be decoded this way, in which case
+  ///         it should be decoded with `get_pixels` and then scaled.
+  /// @see    `ScanlineDownsampler`
+  bool get_downsampled_pixels(const SkPixmap& pixmap,
+                              SkISize decode_size,
+                              int band_height) const;
+
   void dispose() {
     buffer_.reset();
     generator_.reset();
@@ -35,6 +35,16 @@ sk_sp<SkImage> ImageGenerator::GetImage() {
   return SkImages::RasterFromBitmap(bitmap);
 }
 
+bool ImageGenerator::StartScanlineDecode(const SkImageInfo& info) {
+  return false;
+}
+
+int ImageGenerator::GetScanlines(void* pixels,
+                                 int row_count,
+                                 size_t row_bytes) {
+  return 0;
+}
+
 BuiltinSkiaImageGenerator::~BuiltinSkiaImageGenerator() = default;
 
 BuiltinSkiaImageGenerator::BuiltinSkiaImageGenerator(
@@ -188,6 +198,23 @@ bool BuiltinSkiaCodecImageGenerator::GetPixels(
   return SkPixmapUtils::Orient(output_pixmap, temp_pixmap, origin);
 }
 
+bool BuiltinSkiaCodecImageGenerator::StartScanlineDecode(
+    const SkImageInfo& info) {
+  // Scanlines can only be streamed if they don't need to be re-oriented.
+  if (codec_->getOrigin() != kTopLeft_SkEncodedOrigin ||
+      codec_->startScanlineDecode(info) != SkCodec::kSuccess) {
+    return false;
+  }
+  // Otherwise rows are not final until the whole image has been decoded.
+  return codec_->getScanlineOrder() == SkCodec::kTopDown_SkScanlineOrder;
+}
+
+int BuiltinSkiaCodecImageGenerator::GetScanlines(void* pixels,
+                                                 int row_count,
+                                                 size_t row_bytes) {
+  return codec_->getScanlines(pixels, row_count, row_bytes);
+}
+
 std::unique_ptr<ImageGenerator> BuiltinSkiaCodecImageGenerator::MakeFromData(
     sk_sp<SkData> data) {
   auto codec = SkCodec::MakeFromData(std::move(data));
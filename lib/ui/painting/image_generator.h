@@ -135,6 +135,30 @@ class ImageGenerator {
       unsigned int frame_index = 0,
       std::optional<unsigned int> prior_frame = std::nullopt) = 0;
 
+  /// @brief      Prepare to decode the first frame of the image a few rows at
+  ///             a time, from the top down, with `GetScanlines`. Scanline
+  ///             decoding lets callers consume the rows of large images
+  ///             without holding all of the decoded image in memory.
+  /// @param[in]  info  The desired size and color info of the decoded image,
+  ///                   as for `GetPixels`.
+  /// @return     True if the image can be decoded by scanlines at this size.
+  ///             Otherwise `GetPixels` must be used instead.
+  /// @note       The default implementation doesn't support scanline
+  ///             decoding.
+  /// @see        `GetScanlines`
+  virtual bool StartScanlineDecode(const SkImageInfo& info);
+
+  /// @brief      Decode the next rows of an image after a successful call to
+  ///             `StartScanlineDecode`.
+  /// @param[in]  pixels     The location where the rows should be written.
+  /// @param[in]  row_count  The number of rows to decode.
+  /// @param[in]  row_bytes  The number of bytes between consecutive rows in
+  ///                        `pixels`.
+  /// @return     The number of rows that were decoded. Fewer than `row_count`
+  ///             rows are decoded if the encoded data is incomplete.
+  /// @see        `StartScanlineDecode`
+  virtual int GetScanlines(void* pixels, int row_count, size_t row_bytes);
+
   /// @brief   Creates an `SkImage` based on the current `ImageInfo` of this
   ///          `ImageGenerator`.
   /// @return  A new `SkImage` containing the decoded image data.
@@ -212,6 +236,12 @@ class BuiltinSkiaCodecImageGenerator : public ImageGenerator {
       unsigned int frame_index = 0,
       std::optional<unsigned int> prior_frame = std::nullopt) override;
 
+  // |ImageGenerator|
+  bool StartScanlineDecode(const SkImageInfo& info) override;
+
+  // |ImageGenerator|
+  int GetScanlines(void* pixels, int row_count, size_t row_bytes) override;
+
   static std::unique_ptr<ImageGenerator> MakeFromData(sk_sp<SkData> data);
 
  private:
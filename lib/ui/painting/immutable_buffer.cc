@@ -8,6 +8,7 @@
 
 #include "flutter/fml/file.h"
 #include "flutter/fml/make_copyable.h"
+#include "flutter/lib/ui/sk_data_mapping.h"
 #include "flutter/lib/ui/ui_dart_state.h"
 #include "flutter/lib/ui/window/platform_configuration.h"
 #include "third_party/tonic/converter/dart_converter.h"
@@ -108,8 +109,7 @@ Dart_Handle ImmutableBuffer::initFromAsset(Dart_Handle raw_buffer_handle,
         size_t buffer_size = 0;
         if (mapping != nullptr) {
           buffer_size = mapping->GetSize();
-          const void* bytes = static_cast<const void*>(mapping->GetMapping());
-          sk_data = MakeSkDataWithCopy(bytes, buffer_size);
+          sk_data = MakeSkDataFromMapping(std::move(mapping));
         }
         ui_task_runner->PostTask(
             [sk_data = std::move(sk_data), ui_task = ui_task, buffer_size]() {
@@ -177,6 +177,8 @@ Dart_Handle ImmutableBuffer::initFromFile(Dart_Handle raw_buffer_handle,
         sk_sp<SkData> sk_data;
         size_t buffer_size = 0;
         if (mapping->IsValid()) {
+          // The file may be truncated by another process while the buffer is
+          // alive, which would fault reads of a live mapping. Copy it.
           buffer_size = mapping->GetSize();
           const void* bytes = static_cast<const void*>(mapping->GetMapping());
           sk_data = MakeSkDataWithCopy(bytes, buffer_size);
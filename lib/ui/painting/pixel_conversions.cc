@@ -0,0 +1,210 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/pixel_conversions.h"
+
+#include <cstring>
+
+#include "flutter/fml/build_config.h"
+#include "third_party/skia/include/core/SkColorSpace.h"
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// F16C is not part of the x86-64 baseline, so it is only used if the CPU
+// supports it.
+#if defined(FML_ARCH_CPU_X86_64) && !defined(FML_OS_WIN) && \
+    (defined(__clang__) || defined(__GNUC__))
+#define FLUTTER_PIXEL_CONVERSIONS_F16C 1
+#include <immintrin.h>
+#endif
+
+namespace flutter {
+
+namespace {
+
+constexpr size_t kBytesPerPixel = 4;
+
+uint16_t FloatToHalf(float value) {
+  uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  const uint16_t sign = (bits >> 16) & 0x8000;
+  const uint32_t magnitude = bits & 0x7fffffff;
+
+  // Infinities and NaNs. NaNs are made quiet and keep the top of their
+  // payload.
+  if (magnitude > 0x7f800000) {
+    return sign | 0x7e00 | ((magnitude >> 13) & 0x03ff);
+  }
+  if (magnitude == 0x7f800000) {
+    return sign | 0x7c00;
+  }
+  // Values of at least 2^16 overflow. Smaller values that round up to it
+  // carry into the infinity exponent below.
+  if (magnitude >= 0x47800000) {
+    return sign | 0x7c00;
+  }
+
+  uint32_t half;
+  uint32_t remainder;
+  uint32_t halfway;
+  if (magnitude < 0x38800000) {
+    // Subnormal halves count multiples of 2^-24.
+    const uint32_t exponent = magnitude >> 23;
+    const uint32_t shift = 126 - exponent;
+    if (shift > 24) {
+      return sign;
+    }
+    const uint32_t mantissa = (magnitude & 0x007fffff) | 0x00800000;
+    half = mantissa >> shift;
+    remainder = mantissa & ((1u << shift) - 1);
+    halfway = 1u << (shift - 1);
+  } else {
+    half = (magnitude >> 13) - ((127 - 15) << 10);
+    remainder = magnitude & 0x1fff;
+    halfway = 0x1000;
+  }
+  // Round to nearest, ties to even.
+  if (remainder > halfway || (remainder == halfway && (half & 1))) {
+    half++;
+  }
+  return sign | static_cast<uint16_t>(half);
+}
+
+#if FLUTTER_PIXEL_CONVERSIONS_F16C
+// Returns the number of values converted, which is a multiple of 8.
+__attribute__((target("avx,f16c"))) size_t ConvertF32ToF16F16C(
+    const float* source,
+    uint16_t* destination,
+    size_t count) {
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    const __m256 values = _mm256_loadu_ps(source + i);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i),
+                     _mm256_cvtps_ph(values, _MM_FROUND_TO_NEAREST_INT));
+  }
+  return i;
+}
+
+bool SupportsF16C() {
+  static const bool supports_f16c =
+      __builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c");
+  return supports_f16c;
+}
+#endif  // FLUTTER_PIXEL_CONVERSIONS_F16C
+
+using RowConversion = void (*)(const void* source,
+                               void* destination,
+                               int width);
+
+void CopyRow(const void* source, void* destination, int width) {
+  std::memcpy(destination, source, width * kBytesPerPixel);
+}
+
+void SwapRedAndBlueRow(const void* source, void* destination, int width) {
+  SwapRedAndBlue(static_cast<const uint8_t*>(source),
+                 static_cast<uint8_t*>(destination), width);
+}
+
+void ConvertF32ToF16Row(const void* source, void* destination, int width) {
+  ConvertF32ToF16(static_cast<const float*>(source),
+                  static_cast<uint16_t*>(destination), width * 4);
+}
+
+bool Is8888(SkColorType type) {
+  return type == kRGBA_8888_SkColorType || type == kBGRA_8888_SkColorType;
+}
+
+RowConversion ChooseRowConversion(SkColorType source,
+                                  SkColorType destination) {
+  if (Is8888(source) && Is8888(destination)) {
+    return source == destination ? CopyRow : SwapRedAndBlueRow;
+  }
+  if (source == kRGBA_F32_SkColorType &&
+      destination == kRGBA_F16_SkColorType) {
+    return ConvertF32ToF16Row;
+  }
+  return nullptr;
+}
+
+}  // namespace
+
+void SwapRedAndBlue(const uint8_t* source,
+                    uint8_t* destination,
+                    size_t pixel_count) {
+  size_t i = 0;
+#if defined(__ARM_NEON)
+  for (; i + 16 <= pixel_count; i += 16) {
+    uint8x16x4_t pixels = vld4q_u8(source + i * kBytesPerPixel);
+    const uint8x16_t red = pixels.val[0];
+    pixels.val[0] = pixels.val[2];
+    pixels.val[2] = red;
+    vst4q_u8(destination + i * kBytesPerPixel, pixels);
+  }
+#elif defined(__SSE2__)
+  const __m128i green_and_alpha =
+      _mm_set1_epi32(static_cast<int>(0xff00ff00));
+  const __m128i low_channel = _mm_set1_epi32(0x000000ff);
+  for (; i + 4 <= pixel_count; i += 4) {
+    const __m128i pixels = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(source + i * kBytesPerPixel));
+    const __m128i swapped = _mm_or_si128(
+        _mm_and_si128(_mm_srli_epi32(pixels, 16), low_channel),
+        _mm_slli_epi32(_mm_and_si128(pixels, low_channel), 16));
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(destination + i * kBytesPerPixel),
+        _mm_or_si128(_mm_and_si128(pixels, green_and_alpha), swapped));
+  }
+#endif
+  for (; i < pixel_count; i++) {
+    const uint8_t* pixel = source + i * kBytesPerPixel;
+    uint8_t* swapped = destination + i * kBytesPerPixel;
+    const uint8_t red = pixel[0];
+    swapped[0] = pixel[2];
+    swapped[1] = pixel[1];
+    swapped[2] = red;
+    swapped[3] = pixel[3];
+  }
+}
+
+void ConvertF32ToF16(const float* source, uint16_t* destination, size_t count) {
+  size_t i = 0;
+#if defined(FML_ARCH_CPU_ARM64)
+  for (; i + 4 <= count; i += 4) {
+    vst1_u16(destination + i,
+             vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(source + i))));
+  }
+#elif FLUTTER_PIXEL_CONVERSIONS_F16C
+  if (SupportsF16C()) {
+    i = ConvertF32ToF16F16C(source, destination, count);
+  }
+#endif
+  for (; i < count; i++) {
+    destination[i] = FloatToHalf(source[i]);
+  }
+}
+
+bool ConvertPixels(const SkPixmap& source, const SkPixmap& destination) {
+  if (!source.addr() || !destination.writable_addr() ||
+      source.dimensions() != destination.dimensions() ||
+      source.alphaType() != destination.alphaType() ||
+      !SkColorSpace::Equals(source.colorSpace(), destination.colorSpace())) {
+    return false;
+  }
+  const auto convert =
+      ChooseRowConversion(source.colorType(), destination.colorType());
+  if (!convert) {
+    return false;
+  }
+  for (int row = 0; row < source.height(); row++) {
+    convert(source.addr(0, row), destination.writable_addr(0, row),
+            source.width());
+  }
+  return true;
+}
+
+}  // namespace flutter
@@ -0,0 +1,40 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_LIB_UI_PAINTING_PIXEL_CONVERSIONS_H_
+#define FLUTTER_LIB_UI_PAINTING_PIXEL_CONVERSIONS_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "third_party/skia/include/core/SkPixmap.h"
+
+namespace flutter {
+
+/// @brief  Swap the red and blue channels of `pixel_count` 8888 pixels,
+///         converting RGBA pixels to BGRA ones or the other way around.
+///         `source` and `destination` may be the same buffer.
+void SwapRedAndBlue(const uint8_t* source,
+                    uint8_t* destination,
+                    size_t pixel_count);
+
+/// @brief  Convert `count` 32 bit floats to half floats, rounding to the
+///         nearest representable value. Out of range values become
+///         infinities.
+void ConvertF32ToF16(const float* source, uint16_t* destination, size_t count);
+
+/// @brief  Convert the pixels of `source` into `destination` with vectorized
+///         kernels, for the conversions that raw images need before they are
+///         uploaded:
+///         - RGBA or BGRA 8888 pixels to RGBA or BGRA 8888 pixels.
+///         - RGBA F32 pixels to RGBA F16 pixels.
+///         The pixmaps must have the same dimensions, alpha type and color
+///         space.
+/// @return false, leaving `destination` untouched, if the conversion isn't
+///         one of the above. `SkPixmap::readPixels` handles the rest.
+bool ConvertPixels(const SkPixmap& source, const SkPixmap& destination);
+
+}  // namespace flutter
+
+#endif  // FLUTTER_LIB_UI_PAINTING_PIXEL_CONVERSIONS_H_
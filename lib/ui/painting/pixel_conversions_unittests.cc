@@ -0,0 +1,158 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/pixel_conversions.h"
+
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "flutter/testing/testing.h"
+#include "third_party/skia/include/core/SkBitmap.h"
+#include "third_party/skia/include/core/SkColorSpace.h"
+
+namespace flutter {
+namespace testing {
+
+TEST(PixelConversionsTest, SwapsRedAndBlue) {
+  // Enough pixels for the vectorized loops and a remainder.
+  constexpr size_t kPixelCount = 37;
+  std::vector<uint8_t> pixels(kPixelCount * 4);
+  for (size_t i = 0; i < pixels.size(); i++) {
+    pixels[i] = static_cast<uint8_t>(i * 7);
+  }
+  std::vector<uint8_t> swapped(pixels.size());
+  SwapRedAndBlue(pixels.data(), swapped.data(), kPixelCount);
+  for (size_t i = 0; i < pixels.size(); i += 4) {
+    EXPECT_EQ(swapped[i + 0], pixels[i + 2]);
+    EXPECT_EQ(swapped[i + 1], pixels[i + 1]);
+    EXPECT_EQ(swapped[i + 2], pixels[i + 0]);
+    EXPECT_EQ(swapped[i + 3], pixels[i + 3]);
+  }
+
+  SwapRedAndBlue(swapped.data(), swapped.data(), kPixelCount);
+  EXPECT_EQ(swapped, pixels);
+}
+
+TEST(PixelConversionsTest, ConvertsFloatsToHalves) {
+  const std::vector<std::pair<float, uint16_t>> cases = {
+      {0.0f, 0x0000},
+      {-0.0f, 0x8000},
+      {1.0f, 0x3c00},
+      {-2.0f, 0xc000},
+      {0.1f, 0x2e66},
+      {65504.0f, 0x7bff},
+      // Rounds up to the next power of two, which is out of range.
+      {65520.0f, 0x7c00},
+      {1e10f, 0x7c00},
+      {std::numeric_limits<float>::infinity(), 0x7c00},
+      {-std::numeric_limits<float>::infinity(), 0xfc00},
+      // The smallest normal and subnormal halves.
+      {std::ldexp(1.0f, -14), 0x0400},
+      {std::ldexp(1.0f, -24), 0x0001},
+      {std::ldexp(1.0f, -26), 0x0000},
+      // Ties round to even.
+      {1.0f + std::ldexp(1.0f, -11), 0x3c00},
+      {1.0f + 3 * std::ldexp(1.0f, -11), 0x3c02},
+      {std::ldexp(1.0f, -25), 0x0000},
+      {3 * std::ldexp(1.0f, -25), 0x0002},
+  };
+  std::vector<float> values;
+  for (const auto& test_case : cases) {
+    values.push_back(test_case.first);
+  }
+  std::vector<uint16_t> halves(values.size());
+  ConvertF32ToF16(values.data(), halves.data(), values.size());
+  for (size_t i = 0; i < cases.size(); i++) {
+    EXPECT_EQ(halves[i], cases[i].second) << "Converting " << values[i];
+
+    // One value at a time doesn't use the vectorized loops.
+    uint16_t half = 0;
+    ConvertF32ToF16(&values[i], &half, 1);
+    EXPECT_EQ(half, cases[i].second) << "Converting " << values[i];
+  }
+
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  uint16_t half = 0;
+  ConvertF32ToF16(&nan, &half, 1);
+  EXPECT_EQ(half & 0x7c00, 0x7c00);
+  EXPECT_NE(half & 0x03ff, 0);
+}
+
+TEST(PixelConversionsTest, ConvertsPixelsLikeReadPixels) {
+  // Rows are padded to check that row bytes are respected.
+  const auto source_info = SkImageInfo::Make(13, 7, kBGRA_8888_SkColorType,
+                                             kPremul_SkAlphaType);
+  SkBitmap source;
+  ASSERT_TRUE(source.tryAllocPixels(source_info, 13 * 4 + 12));
+  for (int y = 0; y < source.height(); y++) {
+    for (int x = 0; x < source.width(); x++) {
+      *source.getAddr32(x, y) = SkPreMultiplyARGB(
+          255 - x * 10, x * 19, y * 31, (x * y * 5) % 256);
+    }
+  }
+
+  for (const auto color_type :
+       {kRGBA_8888_SkColorType, kBGRA_8888_SkColorType}) {
+    SkBitmap converted;
+    SkBitmap expected;
+    ASSERT_TRUE(
+        converted.tryAllocPixels(source_info.makeColorType(color_type)));
+    ASSERT_TRUE(expected.tryAllocPixels(source_info.makeColorType(color_type)));
+    ASSERT_TRUE(ConvertPixels(source.pixmap(), converted.pixmap()));
+    ASSERT_TRUE(source.readPixels(expected.pixmap()));
+    for (int y = 0; y < source.height(); y++) {
+      for (int x = 0; x < source.width(); x++) {
+        EXPECT_EQ(*converted.getAddr32(x, y), *expected.getAddr32(x, y));
+      }
+    }
+  }
+}
+
+TEST(PixelConversionsTest, ConvertsFloatPixelsToHalfFloatPixels) {
+  const auto info = SkImageInfo::Make(3, 2, kRGBA_F32_SkColorType,
+                                      kUnpremul_SkAlphaType);
+  std::vector<float> source(3 * 2 * 4);
+  for (size_t i = 0; i < source.size(); i++) {
+    source[i] = i * 0.25f;
+  }
+  SkBitmap converted;
+  ASSERT_TRUE(
+      converted.tryAllocPixels(info.makeColorType(kRGBA_F16_SkColorType)));
+  ASSERT_TRUE(ConvertPixels(SkPixmap(info, source.data(), 3 * 16),
+                            converted.pixmap()));
+
+  std::vector<uint16_t> expected(source.size());
+  ConvertF32ToF16(source.data(), expected.data(), source.size());
+  for (int y = 0; y < 2; y++) {
+    const auto* row = static_cast<const uint16_t*>(converted.getAddr(0, y));
+    for (int i = 0; i < 3 * 4; i++) {
+      EXPECT_EQ(row[i], expected[y * 3 * 4 + i]);
+    }
+  }
+}
+
+TEST(PixelConversionsTest, RejectsOtherConversions) {
+  const auto info =
+      SkImageInfo::Make(4, 4, kRGBA_8888_SkColorType, kPremul_SkAlphaType);
+  SkBitmap source;
+  ASSERT_TRUE(source.tryAllocPixels(info));
+  source.eraseColor(SK_ColorRED);
+
+  const auto expect_rejected = [&source](const SkImageInfo& other_info) {
+    SkBitmap destination;
+    ASSERT_TRUE(destination.tryAllocPixels(other_info));
+    destination.eraseColor(SK_ColorBLUE);
+    EXPECT_FALSE(ConvertPixels(source.pixmap(), destination.pixmap()));
+    EXPECT_EQ(destination.getColor(0, 0), SK_ColorBLUE);
+  };
+  expect_rejected(info.makeWH(2, 2));
+  expect_rejected(info.makeAlphaType(kUnpremul_SkAlphaType));
+  expect_rejected(info.makeColorType(kRGBA_F16_SkColorType));
+  expect_rejected(info.makeColorSpace(SkColorSpace::MakeSRGBLinear()));
+}
+
+}  // namespace testing
+}  // namespace flutter
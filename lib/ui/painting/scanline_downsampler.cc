@@ -0,0 +1,142 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/scanline_downsampler.h"
+
+#include <algorithm>
+
+#include "flutter/fml/logging.h"
+
+namespace flutter {
+
+// Source and destination rows and columns are measured in units that make
+// both of their sizes integral. A source column spans the destination width
+// in units, and a destination column spans the source width, so the image is
+// `source width * destination width` units wide. The same goes for rows.
+
+bool ScanlineDownsampler::CanDownsample(const SkImageInfo& source,
+                                        const SkImageInfo& destination) {
+  if (source.colorType() != destination.colorType() ||
+      source.alphaType() != destination.alphaType()) {
+    return false;
+  }
+  switch (source.colorType()) {
+    case kRGBA_8888_SkColorType:
+    case kBGRA_8888_SkColorType:
+      break;
+    default:
+      return false;
+  }
+  // Averaging unpremultiplied colors would bleed the color of transparent
+  // pixels into their neighbours.
+  if (source.alphaType() == kUnpremul_SkAlphaType) {
+    return false;
+  }
+  return !destination.isEmpty() &&
+         destination.width() <= source.width() &&
+         destination.height() <= source.height();
+}
+
+ScanlineDownsampler::ScanlineDownsampler(SkISize source_size,
+                                         const SkPixmap& destination)
+    : source_size_(source_size),
+      destination_(destination),
+      row_(destination.width() * kChannelCount),
+      accumulator_(destination.width() * kChannelCount) {
+  FML_DCHECK(destination.width() <= source_size.width());
+  FML_DCHECK(destination.height() <= source_size.height());
+
+  const int64_t source_width = source_size_.width();
+  const int64_t destination_width = destination_.width();
+  column_contributions_.reserve(source_width);
+  for (int64_t column = 0; column < source_width; column++) {
+    const int64_t start = column * destination_width;
+    const int64_t end = start + destination_width;
+    const int64_t destination_column = start / source_width;
+    const int64_t boundary = (destination_column + 1) * source_width;
+    // Destination columns are at least as wide as source columns, so a
+    // source column covers at most two of them.
+    const int64_t overlap = std::min(end, boundary) - start;
+    column_contributions_.push_back(ColumnContribution{
+        .column = static_cast<int>(destination_column),
+        .weight = static_cast<float>(overlap) / source_width,
+        .next_weight =
+            static_cast<float>(destination_width - overlap) / source_width,
+    });
+  }
+}
+
+ScanlineDownsampler::~ScanlineDownsampler() = default;
+
+bool ScanlineDownsampler::IsComplete() const {
+  return next_destination_row_ == destination_.height();
+}
+
+void ScanlineDownsampler::AddRows(const void* rows,
+                                  int row_count,
+                                  size_t row_bytes) {
+  const auto* row = static_cast<const uint8_t*>(rows);
+  for (int i = 0; i < row_count && next_source_row_ < source_size_.height();
+       i++) {
+    AddRow(row);
+    row += row_bytes;
+  }
+}
+
+void ScanlineDownsampler::AddRow(const uint8_t* pixels) {
+  // Average the row horizontally.
+  std::fill(row_.begin(), row_.end(), 0.0f);
+  for (const auto& contribution : column_contributions_) {
+    float* destination = &row_[contribution.column * kChannelCount];
+    for (int channel = 0; channel < kChannelCount; channel++) {
+      destination[channel] += pixels[channel] * contribution.weight;
+    }
+    if (contribution.next_weight > 0.0f) {
+      destination += kChannelCount;
+      for (int channel = 0; channel < kChannelCount; channel++) {
+        destination[channel] += pixels[channel] * contribution.next_weight;
+      }
+    }
+    pixels += kChannelCount;
+  }
+
+  // Then accumulate it into the destination rows it covers.
+  const int64_t source_height = source_size_.height();
+  const int64_t destination_height = destination_.height();
+  const int64_t start = next_source_row_ * destination_height;
+  const int64_t end = start + destination_height;
+  const int64_t boundary = (next_destination_row_ + 1) * source_height;
+  next_source_row_++;
+
+  if (end <= boundary) {
+    AccumulateRow(static_cast<float>(destination_height) / source_height);
+    if (end == boundary) {
+      WriteDestinationRow();
+    }
+    return;
+  }
+  AccumulateRow(static_cast<float>(boundary - start) / source_height);
+  WriteDestinationRow();
+  AccumulateRow(static_cast<float>(end - boundary) / source_height);
+}
+
+void ScanlineDownsampler::AccumulateRow(float weight) {
+  for (size_t i = 0; i < accumulator_.size(); i++) {
+    accumulator_[i] += row_[i] * weight;
+  }
+}
+
+void ScanlineDownsampler::WriteDestinationRow() {
+  FML_DCHECK(next_destination_row_ < destination_.height());
+  auto* pixels = static_cast<uint8_t*>(
+      destination_.writable_addr(0, next_destination_row_));
+  for (size_t i = 0; i < accumulator_.size(); i++) {
+    pixels[i] =
+        static_cast<uint8_t>(std::clamp(accumulator_[i] + 0.5f, 0.0f, 255.0f));
+  }
+  std::fill(accumulator_.begin(), accumulator_.end(), 0.0f);
+  next_destination_row_++;
+}
+
+}  // namespace flutter
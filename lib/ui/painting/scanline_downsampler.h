@@ -0,0 +1,78 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_LIB_UI_PAINTING_SCANLINE_DOWNSAMPLER_H_
+#define FLUTTER_LIB_UI_PAINTING_SCANLINE_DOWNSAMPLER_H_
+
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "third_party/skia/include/core/SkImageInfo.h"
+#include "third_party/skia/include/core/SkPixmap.h"
+#include "third_party/skia/include/core/SkSize.h"
+
+namespace flutter {
+
+/// @brief  Area averages the rows of an image down to the size of a
+///         destination pixmap as they are provided from the top down. Only a
+///         couple of rows of accumulators are kept in addition to the
+///         destination, so an image that is decoded by scanlines never needs
+///         to be held in memory at its decoded size.
+/// @see    `ImageGenerator::StartScanlineDecode`
+class ScanlineDownsampler {
+ public:
+  /// @brief  Whether the pixels of an image described by `source` can be
+  ///         downsampled into a pixmap described by `destination`. Both must
+  ///         use the same 8 bit per channel color type, and the destination
+  ///         may not be larger than the source in either dimension.
+  static bool CanDownsample(const SkImageInfo& source,
+                            const SkImageInfo& destination);
+
+  /// @brief  Create a downsampler writing to `destination`, which must
+  ///         remain valid until every row has been added.
+  /// @see    `CanDownsample`
+  ScanlineDownsampler(SkISize source_size, const SkPixmap& destination);
+
+  ~ScanlineDownsampler();
+
+  /// @brief  Consume the next `row_count` rows of the source image. Rows of
+  ///         the destination are written as soon as all of the source rows
+  ///         they cover have been added.
+  void AddRows(const void* rows, int row_count, size_t row_bytes);
+
+  /// @brief  Whether every row of the destination has been written.
+  bool IsComplete() const;
+
+ private:
+  struct ColumnContribution {
+    /// The first destination column that the source column covers.
+    int column;
+    /// The weight of the source column in `column`.
+    float weight;
+    /// The weight of the source column in the column after `column`.
+    float next_weight;
+  };
+
+  static constexpr int kChannelCount = 4;
+
+  const SkISize source_size_;
+  const SkPixmap destination_;
+  std::vector<ColumnContribution> column_contributions_;
+  std::vector<float> row_;
+  std::vector<float> accumulator_;
+  int next_source_row_ = 0;
+  int next_destination_row_ = 0;
+
+  void AddRow(const uint8_t* pixels);
+
+  void AccumulateRow(float weight);
+
+  void WriteDestinationRow();
+
+  FML_DISALLOW_COPY_AND_ASSIGN(ScanlineDownsampler);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_LIB_UI_PAINTING_SCANLINE_DOWNSAMPLER_H_
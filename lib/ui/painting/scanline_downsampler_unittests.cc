@@ -0,0 +1,87 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/scanline_downsampler.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "flutter/testing/testing.h"
+
+namespace flutter {
+namespace testing {
+
+static SkImageInfo MakeInfo(int width, int height) {
+  return SkImageInfo::Make(width, height, kRGBA_8888_SkColorType,
+                           kPremul_SkAlphaType);
+}
+
+TEST(ScanlineDownsamplerTest, CanOnlyDownsample8888Pixels) {
+  EXPECT_TRUE(ScanlineDownsampler::CanDownsample(MakeInfo(10, 10),
+                                                 MakeInfo(10, 10)));
+  EXPECT_TRUE(
+      ScanlineDownsampler::CanDownsample(MakeInfo(10, 10), MakeInfo(3, 7)));
+  EXPECT_FALSE(
+      ScanlineDownsampler::CanDownsample(MakeInfo(10, 10), MakeInfo(11, 7)));
+  EXPECT_FALSE(
+      ScanlineDownsampler::CanDownsample(MakeInfo(10, 10), MakeInfo(0, 0)));
+  EXPECT_FALSE(ScanlineDownsampler::CanDownsample(
+      MakeInfo(10, 10).makeColorType(kRGBA_F16_SkColorType),
+      MakeInfo(5, 5).makeColorType(kRGBA_F16_SkColorType)));
+  EXPECT_FALSE(ScanlineDownsampler::CanDownsample(
+      MakeInfo(10, 10).makeAlphaType(kUnpremul_SkAlphaType),
+      MakeInfo(5, 5).makeAlphaType(kUnpremul_SkAlphaType)));
+}
+
+TEST(ScanlineDownsamplerTest, AveragesTheAreaCoveredByEachPixel) {
+  // A 4x2 image with black left and white right halves, one row at a time.
+  std::vector<uint8_t> source(4 * 2 * 4, 0);
+  for (int row = 0; row < 2; row++) {
+    std::fill_n(source.begin() + row * 16 + 8, 8, 255);
+  }
+  std::vector<uint8_t> destination(3 * 4, 0);
+  SkPixmap pixmap(MakeInfo(3, 1), destination.data(), 3 * 4);
+
+  ScanlineDownsampler downsampler(SkISize::Make(4, 2), pixmap);
+  downsampler.AddRows(source.data(), 1, 16);
+  EXPECT_FALSE(downsampler.IsComplete());
+  downsampler.AddRows(source.data() + 16, 1, 16);
+  ASSERT_TRUE(downsampler.IsComplete());
+
+  // The middle pixel covers two thirds of a black and of a white pixel.
+  EXPECT_EQ(destination[0], 0);
+  EXPECT_EQ(destination[4], 128);
+  EXPECT_EQ(destination[8], 255);
+}
+
+TEST(ScanlineDownsamplerTest, PreservesUniformColors) {
+  const SkISize source_size = SkISize::Make(37, 23);
+  std::vector<uint8_t> source(source_size.width() * source_size.height() * 4);
+  for (size_t i = 0; i < source.size(); i += 4) {
+    source[i + 0] = 10;
+    source[i + 1] = 20;
+    source[i + 2] = 30;
+    source[i + 3] = 255;
+  }
+  std::vector<uint8_t> destination(5 * 7 * 4, 0);
+  SkPixmap pixmap(MakeInfo(5, 7), destination.data(), 5 * 4);
+
+  ScanlineDownsampler downsampler(source_size, pixmap);
+  // Bands of rows that don't line up with the destination rows.
+  const size_t row_bytes = source_size.width() * 4;
+  for (int row = 0; row < source_size.height(); row += 4) {
+    downsampler.AddRows(source.data() + row * row_bytes,
+                        std::min(4, source_size.height() - row), row_bytes);
+  }
+  ASSERT_TRUE(downsampler.IsComplete());
+  for (size_t i = 0; i < destination.size(); i += 4) {
+    EXPECT_EQ(destination[i + 0], 10);
+    EXPECT_EQ(destination[i + 1], 20);
+    EXPECT_EQ(destination[i + 2], 30);
+    EXPECT_EQ(destination[i + 3], 255);
+  }
+}
+
+}  // namespace testing
+}  // namespace flutter
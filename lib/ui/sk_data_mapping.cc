@@ -0,0 +1,23 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/sk_data_mapping.h"
+
+namespace flutter {
+
+static void MappingReleaseProc(const void* ptr, void* context) {
+  delete reinterpret_cast<fml::Mapping*>(context);
+}
+
+sk_sp<SkData> MakeSkDataFromMapping(std::unique_ptr<fml::Mapping> mapping) {
+  if (mapping->GetSize() == 0 || mapping->GetMapping() == nullptr) {
+    return SkData::MakeEmpty();
+  }
+  fml::Mapping* mapping_ptr = mapping.release();
+  return SkData::MakeWithProc(mapping_ptr->GetMapping(),
+                              mapping_ptr->GetSize(), MappingReleaseProc,
+                              mapping_ptr);
+}
+
+}  // namespace flutter
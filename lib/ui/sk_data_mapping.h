@@ -0,0 +1,28 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_LIB_UI_SK_DATA_MAPPING_H_
+#define FLUTTER_LIB_UI_SK_DATA_MAPPING_H_
+
+#include <memory>
+
+#include "flutter/fml/mapping.h"
+#include "third_party/skia/include/core/SkData.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// @brief      Wraps the mapping in an SkData without copying it. The mapping
+///             is released along with the SkData.
+///
+///             The mapping must stay readable for as long as the SkData is
+///             alive. Use this for read-only bundle assets, not for files
+///             other processes may truncate, as reading a truncated file
+///             mapping raises SIGBUS.
+///
+sk_sp<SkData> MakeSkDataFromMapping(std::unique_ptr<fml::Mapping> mapping);
+
+}  // namespace flutter
+
+#endif  // FLUTTER_LIB_UI_SK_DATA_MAPPING_H_
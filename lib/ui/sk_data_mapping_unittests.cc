@@ -0,0 +1,54 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/sk_data_mapping.h"
+
+#include <memory>
+#include <vector>
+
+#include "flutter/fml/mapping.h"
+#include "flutter/testing/testing.h"
+
+namespace flutter {
+namespace testing {
+
+/// A mapping that records when it is destroyed.
+static std::unique_ptr<fml::Mapping> MakeTrackedMapping(const uint8_t* data,
+                                                        size_t size,
+                                                        bool* destroyed) {
+  return std::make_unique<fml::NonOwnedMapping>(
+      data, size, [destroyed](auto, auto) { *destroyed = true; });
+}
+
+TEST(SkDataMappingTest, AdoptsMappingWithoutCopying) {
+  std::vector<uint8_t> bytes = {1, 2, 3, 4, 5};
+  bool destroyed = false;
+  auto mapping = MakeTrackedMapping(bytes.data(), bytes.size(), &destroyed);
+
+  sk_sp<SkData> data = MakeSkDataFromMapping(std::move(mapping));
+  ASSERT_TRUE(data);
+  EXPECT_EQ(data->data(), bytes.data());
+  EXPECT_EQ(data->size(), bytes.size());
+  EXPECT_FALSE(destroyed);
+
+  // A second reference keeps the mapping alive.
+  sk_sp<SkData> other = data;
+  data.reset();
+  EXPECT_FALSE(destroyed);
+  other.reset();
+  EXPECT_TRUE(destroyed);
+}
+
+TEST(SkDataMappingTest, EmptyMappingIsReleasedRightAway) {
+  bool destroyed = false;
+  auto mapping = MakeTrackedMapping(nullptr, 0u, &destroyed);
+
+  sk_sp<SkData> data = MakeSkDataFromMapping(std::move(mapping));
+  ASSERT_TRUE(data);
+  EXPECT_EQ(data->size(), 0u);
+  EXPECT_TRUE(destroyed);
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -7,6 +7,8 @@
 #include <utility>
 
 #include "flutter/fml/logging.h"
+#include "flutter/fml/trace_event.h"
+#include "flutter/lib/ui/sk_data_mapping.h"
 #include "third_party/skia/include/core/SkData.h"
 #include "third_party/skia/include/core/SkFontMgr.h"
 #include "third_party/skia/include/core/SkStream.h"
@@ -16,14 +18,6 @@
 
 namespace flutter {
 
-namespace {
-
-void MappingReleaseProc(const void* ptr, void* context) {
-  delete reinterpret_cast<fml::Mapping*>(context);
-}
-
-}  // anonymous namespace
-
 AssetManagerFontProvider::AssetManagerFontProvider(
     std::shared_ptr<AssetManager> asset_manager)
     : asset_manager_(std::move(asset_manager)) {}
@@ -67,6 +61,21 @@ void AssetManagerFontProvider::RegisterAsset(const std::string& family_name,
   family_it->second->registerAsset(asset);
 }
 
+void AssetManagerFontProvider::PreloadFonts(
+    const std::shared_ptr<fml::ConcurrentTaskRunner>& task_runner) {
+  if (!task_runner) {
+    return;
+  }
+  for (const auto& family : registered_families_) {
+    task_runner->PostTask([style_set = family.second]() {
+      TRACE_EVENT0("flutter", "AssetManagerFontProvider::PreloadFonts");
+      for (int i = 0; i < style_set->count(); i++) {
+        style_set->createTypeface(i);
+      }
+    });
+  }
+}
+
 AssetManagerFontStyleSet::AssetManagerFontStyleSet(
     std::shared_ptr<AssetManager> asset_manager,
     std::string family_name)
@@ -76,17 +85,19 @@ AssetManagerFontStyleSet::AssetManagerFontStyleSet(
 AssetManagerFontStyleSet::~AssetManagerFontStyleSet() = default;
 
 void AssetManagerFontStyleSet::registerAsset(const std::string& asset) {
+  std::scoped_lock lock(typefaces_mutex_);
   assets_.emplace_back(asset);
 }
 
 int AssetManagerFontStyleSet::count() {
+  std::scoped_lock lock(typefaces_mutex_);
   return assets_.size();
 }
 
 void AssetManagerFontStyleSet::getStyle(int index,
                                         SkFontStyle* style,
                                         SkString* name) {
-  FML_DCHECK(index < static_cast<int>(assets_.size()));
+  FML_DCHECK(index < count());
   if (style) {
     sk_sp<SkTypeface> typeface(createTypeface(index));
     if (typeface) {
@@ -100,34 +111,44 @@ void AssetManagerFontStyleSet::getStyle(int index,
 
 auto AssetManagerFontStyleSet::createTypeface(int i) -> CreateTypefaceRet {
   size_t index = i;
-  if (index >= assets_.size()) {
+  std::string asset_name;
+  {
+    std::scoped_lock lock(typefaces_mutex_);
+    if (index >= assets_.size()) {
+      return nullptr;
+    }
+    if (assets_[index].typeface) {
+      return CreateTypefaceRet(SkRef(assets_[index].typeface.get()));
+    }
+    asset_name = assets_[index].asset;
+  }
+
+  // Load and parse the font without holding the lock, so that the other fonts
+  // of the family can be used in the meantime. If the font is loaded on
+  // several threads at once, the first typeface to be published is kept.
+  std::unique_ptr<fml::Mapping> asset_mapping =
+      asset_manager_->GetAsMapping(asset_name);
+  if (asset_mapping == nullptr) {
     return nullptr;
   }
 
-  TypefaceAsset& asset = assets_[index];
-  if (!asset.typeface) {
-    std::unique_ptr<fml::Mapping> asset_mapping =
-        asset_manager_->GetAsMapping(asset.asset);
-    if (asset_mapping == nullptr) {
-      return nullptr;
-    }
+  sk_sp<SkData> asset_data = MakeSkDataFromMapping(std::move(asset_mapping));
+  std::unique_ptr<SkMemoryStream> stream = SkMemoryStream::Make(asset_data);
 
-    fml::Mapping* asset_mapping_ptr = asset_mapping.release();
-    sk_sp<SkData> asset_data = SkData::MakeWithProc(
-        asset_mapping_ptr->GetMapping(), asset_mapping_ptr->GetSize(),
-        MappingReleaseProc, asset_mapping_ptr);
-    std::unique_ptr<SkMemoryStream> stream = SkMemoryStream::Make(asset_data);
-
-    sk_sp<SkFontMgr> font_mgr = txt::GetDefaultFontManager();
-    // Ownership of the stream is transferred.
-    asset.typeface = font_mgr->makeFromStream(std::move(stream));
-    if (!asset.typeface) {
-      FML_DLOG(ERROR) << "Unable to load font asset for family: "
-                      << family_name_;
-      return nullptr;
-    }
+  sk_sp<SkFontMgr> font_mgr = txt::GetDefaultFontManager();
+  // Ownership of the stream is transferred.
+  sk_sp<SkTypeface> typeface = font_mgr->makeFromStream(std::move(stream));
+  if (!typeface) {
+    FML_DLOG(ERROR) << "Unable to load font asset for family: "
+                    << family_name_;
+    return nullptr;
   }
 
+  std::scoped_lock lock(typefaces_mutex_);
+  TypefaceAsset& asset = assets_[index];
+  if (!asset.typeface) {
+    asset.typeface = std::move(typeface);
+  }
   return CreateTypefaceRet(SkRef(asset.typeface.get()));
 }
 
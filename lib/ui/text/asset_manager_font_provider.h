@@ -6,11 +6,13 @@
 #define FLUTTER_LIB_UI_TEXT_ASSET_MANAGER_FONT_PROVIDER_H_
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 #include "flutter/assets/asset_manager.h"
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/macros.h"
 #include "third_party/skia/include/core/SkFontMgr.h"
 #include "third_party/skia/include/core/SkTypeface.h"
@@ -57,6 +59,8 @@ class AssetManagerFontStyleSet : public SkFontStyleSet {
     std::string asset;
     sk_sp<SkTypeface> typeface;
   };
+  // Guards the typefaces of the assets, which may be loaded on a worker.
+  std::mutex typefaces_mutex_;
   std::vector<TypefaceAsset> assets_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(AssetManagerFontStyleSet);
@@ -71,6 +75,17 @@ class AssetManagerFontProvider : public txt::FontAssetProvider {
 
   void RegisterAsset(const std::string& family_name, const std::string& asset);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Load and parse the fonts of all registered families on the
+  ///             given task runner, so that the first paragraphs that use
+  ///             them don't have to. Fonts that are requested before they
+  ///             have been preloaded are loaded as usual.
+  ///
+  /// @param[in]  task_runner  The runner of the concurrent worker pool.
+  ///
+  void PreloadFonts(
+      const std::shared_ptr<fml::ConcurrentTaskRunner>& task_runner);
+
   // |FontAssetProvider|
   size_t GetFamilyCount() const override;
 
@@ -0,0 +1,79 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/text/asset_manager_font_provider.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include "flutter/assets/asset_resolver.h"
+#include "flutter/fml/concurrent_message_loop.h"
+#include "flutter/fml/synchronization/waitable_event.h"
+#include "flutter/testing/testing.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+/// Resolves assets to test fixtures and counts the assets that are read.
+class FixtureAssetResolver : public AssetResolver {
+ public:
+  explicit FixtureAssetResolver(std::shared_ptr<std::atomic_int> read_count)
+      : read_count_(std::move(read_count)) {}
+
+  // |AssetResolver|
+  bool IsValid() const override { return true; }
+
+  // |AssetResolver|
+  bool IsValidAfterAssetManagerChange() const override { return true; }
+
+  // |AssetResolver|
+  AssetResolverType GetType() const override {
+    return AssetResolverType::kDirectoryAssetBundle;
+  }
+
+  // |AssetResolver|
+  std::unique_ptr<fml::Mapping> GetAsMapping(
+      const std::string& asset_name) const override {
+    (*read_count_)++;
+    return OpenFixtureAsMapping(asset_name);
+  }
+
+ private:
+  std::shared_ptr<std::atomic_int> read_count_;
+};
+
+}  // namespace
+
+TEST(AssetManagerFontProviderTest, PreloadedFamiliesHaveTheirTypefaces) {
+  auto read_count = std::make_shared<std::atomic_int>(0);
+  auto asset_manager = std::make_shared<AssetManager>();
+  asset_manager->PushBack(std::make_unique<FixtureAssetResolver>(read_count));
+  AssetManagerFontProvider font_provider(asset_manager);
+  font_provider.RegisterAsset("Roboto", "Roboto-Medium.ttf");
+
+  // A single worker runs the tasks in order, so the latch is signaled once
+  // the fonts are preloaded.
+  auto loop = fml::ConcurrentMessageLoop::Create(1u);
+  auto task_runner = loop->GetTaskRunner();
+  font_provider.PreloadFonts(task_runner);
+  fml::AutoResetWaitableEvent latch;
+  task_runner->PostTask([&latch]() { latch.Signal(); });
+  latch.Wait();
+  EXPECT_EQ(read_count->load(), 1);
+
+  // The typeface is already loaded and is not read again.
+  auto style_set = font_provider.MatchFamily("Roboto");
+  ASSERT_TRUE(style_set);
+  ASSERT_EQ(style_set->count(), 1);
+  auto typeface = style_set->createTypeface(0);
+  ASSERT_TRUE(typeface);
+  EXPECT_EQ(style_set->createTypeface(0), typeface);
+  EXPECT_EQ(read_count->load(), 1);
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -67,7 +67,8 @@ void FontCollection::SetupDefaultFontManager(
 //
 // Structure described in https://docs.flutter.dev/cookbook/design/fonts
 void FontCollection::RegisterFonts(
-    const std::shared_ptr<AssetManager>& asset_manager) {
+    const std::shared_ptr<AssetManager>& asset_manager,
+    const std::shared_ptr<fml::ConcurrentTaskRunner>& preload_task_runner) {
 #if FML_OS_MACOSX || FML_OS_IOS
   RegisterSystemFonts(*dynamic_font_manager_);
 #endif
@@ -124,6 +125,8 @@ void FontCollection::RegisterFonts(
     }
   }
 
+  font_provider->PreloadFonts(preload_task_runner);
+
   collection_->SetAssetFontManager(
       sk_make_sp<txt::AssetFontManager>(std::move(font_provider)));
 }
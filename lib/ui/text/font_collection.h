@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "flutter/assets/asset_manager.h"
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/memory/ref_ptr.h"
 #include "third_party/tonic/typed_data/typed_list.h"
@@ -26,7 +27,18 @@ class FontCollection {
 
   void SetupDefaultFontManager(uint32_t font_initialization_data);
 
-  void RegisterFonts(const std::shared_ptr<AssetManager>& asset_manager);
+  //----------------------------------------------------------------------------
+  /// @brief      Register the font families declared in the font manifest of
+  ///             the given assets.
+  ///
+  /// @param[in]  asset_manager        The assets of the application.
+  /// @param[in]  preload_task_runner  If not null, the fonts of the families
+  ///                                  are loaded and parsed on this runner
+  ///                                  ahead of their first use.
+  ///
+  void RegisterFonts(const std::shared_ptr<AssetManager>& asset_manager,
+                     const std::shared_ptr<fml::ConcurrentTaskRunner>&
+                         preload_task_runner = nullptr);
 
   void RegisterTestFonts();
 
@@ -320,7 +320,7 @@ void PlatformConfiguration::DispatchPlatformMessage(
 }
 
 void PlatformConfiguration::DispatchPointerDataPacket(
-    const PointerDataPacket& packet) {
+    std::unique_ptr<PointerDataPacket> packet) {
   std::shared_ptr<tonic::DartState> dart_state =
       dispatch_pointer_data_packet_.dart_state().lock();
   if (!dart_state) {
@@ -328,9 +328,22 @@ void PlatformConfiguration::DispatchPointerDataPacket(
   }
   tonic::DartState::Scope scope(dart_state);
 
-  const std::vector<uint8_t>& buffer = packet.data();
-  Dart_Handle data_handle =
-      tonic::DartByteData::Create(buffer.data(), buffer.size());
+  std::vector<uint8_t>& buffer = packet->data();
+  Dart_Handle data_handle;
+  if (buffer.size() < tonic::DartByteData::kExternalSizeThreshold) {
+    data_handle = tonic::DartByteData::Create(buffer.data(), buffer.size());
+  } else {
+    // The byte data views the buffer of the packet, which is deleted when the
+    // byte data is collected.
+    data_handle = Dart_NewExternalTypedDataWithFinalizer(
+        Dart_TypedData_kByteData, buffer.data(), buffer.size(), packet.get(),
+        buffer.size(), [](void* isolate_callback_data, void* peer) {
+          delete static_cast<PointerDataPacket*>(peer);
+        });
+    if (!Dart_IsError(data_handle)) {
+      packet.release();
+    }
+  }
   if (Dart_IsError(data_handle)) {
     return;
   }
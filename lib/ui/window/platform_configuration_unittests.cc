@@ -9,13 +9,17 @@
 #include <memory>
 
 #include "flutter/common/task_runners.h"
+#include "flutter/fml/make_copyable.h"
 #include "flutter/fml/synchronization/waitable_event.h"
 #include "flutter/lib/ui/painting/vertices.h"
+#include "flutter/lib/ui/window/pointer_data_packet.h"
 #include "flutter/runtime/dart_vm.h"
 #include "flutter/shell/common/shell_test.h"
 #include "flutter/shell/common/thread_host.h"
 #include "flutter/testing/testing.h"
 #include "gmock/gmock.h"
+#include "third_party/tonic/converter/dart_converter.h"
+#include "third_party/tonic/typed_data/dart_byte_data.h"
 
 namespace flutter {
 
@@ -490,5 +494,69 @@ TEST_F(PlatformConfigurationTest, SetDartPerformanceMode) {
   DestroyShell(std::move(shell), task_runners);
 }
 
+TEST_F(PlatformConfigurationTest, DispatchesLargePointerDataPackets) {
+  // Enough pointers that the packet is handed to Dart as external typed data.
+  const size_t pointer_count = tonic::DartByteData::kExternalSizeThreshold /
+                                   (kPointerDataFieldCount * kBytesPerField) +
+                               1;
+  auto message_latch = std::make_shared<fml::AutoResetWaitableEvent>();
+  Shell* shell_ptr = nullptr;
+
+  auto nativeHandlerReady = [&](Dart_NativeArguments args) {
+    auto packet = std::make_unique<PointerDataPacket>(pointer_count);
+    ASSERT_GE(packet->data().size(),
+              tonic::DartByteData::kExternalSizeThreshold);
+    for (size_t i = 0; i < pointer_count; i++) {
+      PointerData pointer_data;
+      pointer_data.Clear();
+      pointer_data.change = PointerData::Change::kHover;
+      pointer_data.physical_x = i;
+      packet->SetPointerData(i, pointer_data);
+    }
+    // Dispatch once the handler has returned to the event loop.
+    shell_ptr->GetTaskRunners().GetUITaskRunner()->PostTask(fml::MakeCopyable(
+        [engine = shell_ptr->GetEngine(), packet = std::move(packet)]() mutable {
+          ASSERT_TRUE(engine);
+          engine->DispatchPointerDataPacket(std::move(packet), 0);
+        }));
+  };
+  auto nativeReportPointerDataPacket = [&](Dart_NativeArguments args) {
+    EXPECT_EQ(tonic::DartConverter<int64_t>::FromDart(
+                  Dart_GetNativeArgument(args, 0)),
+              static_cast<int64_t>(pointer_count));
+    EXPECT_EQ(tonic::DartConverter<double>::FromDart(
+                  Dart_GetNativeArgument(args, 1)),
+              static_cast<double>(pointer_count - 1));
+    message_latch->Signal();
+  };
+
+  Settings settings = CreateSettingsForFixture();
+  TaskRunners task_runners("test",                  // label
+                           GetCurrentTaskRunner(),  // platform
+                           CreateNewThread(),       // raster
+                           CreateNewThread(),       // ui
+                           CreateNewThread()        // io
+  );
+
+  AddNativeCallback("PointerDataPacketHandlerReady",
+                    CREATE_NATIVE_ENTRY(nativeHandlerReady));
+  AddNativeCallback("ReportPointerDataPacket",
+                    CREATE_NATIVE_ENTRY(nativeReportPointerDataPacket));
+
+  std::unique_ptr<Shell> shell = CreateShell(settings, task_runners);
+  ASSERT_TRUE(shell->IsSetup());
+  shell_ptr = shell.get();
+
+  auto run_configuration = RunConfiguration::InferFromSettings(settings);
+  run_configuration.SetEntrypoint("receiveLargePointerDataPacket");
+
+  shell->RunEngine(std::move(run_configuration), [&](auto result) {
+    ASSERT_EQ(result, Engine::RunStatus::Success);
+  });
+
+  message_latch->Wait();
+  DestroyShell(std::move(shell), task_runners);
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -23,6 +23,7 @@ class PointerDataPacket {
   PointerData GetPointerData(size_t i) const;
   size_t GetLength() const;
   const std::vector<uint8_t>& data() const { return data_; }
+  std::vector<uint8_t>& data() { return data_; }
 
  private:
   std::vector<uint8_t> data_;
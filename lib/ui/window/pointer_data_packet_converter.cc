@@ -18,6 +18,9 @@ PointerDataPacketConverter::~PointerDataPacketConverter() = default;
 std::unique_ptr<PointerDataPacket> PointerDataPacketConverter::Convert(
     std::unique_ptr<PointerDataPacket> packet) {
   std::vector<PointerData> converted_pointers;
+  // Most pointer data converts to itself, plus the occasional synthesized
+  // event.
+  converted_pointers.reserve(packet->GetLength() + 1);
   // Converts each pointer data in the buffer and stores it in the
   // converted_pointers.
   for (size_t i = 0; i < packet->GetLength(); i++) {
@@ -26,14 +29,55 @@ std::unique_ptr<PointerDataPacket> PointerDataPacketConverter::Convert(
   }
 
   // Writes converted_pointers into converted_packet.
-  auto converted_packet =
-      std::make_unique<flutter::PointerDataPacket>(converted_pointers.size());
-  size_t count = 0;
-  for (auto& converted_pointer : converted_pointers) {
-    converted_packet->SetPointerData(count++, converted_pointer);
+  return std::make_unique<flutter::PointerDataPacket>(
+      reinterpret_cast<uint8_t*>(converted_pointers.data()),
+      converted_pointers.size() * sizeof(PointerData));
+}
+
+void PointerDataPacketConverter::CoalesceMoves(
+    std::vector<PointerData>& pointers) {
+  const auto is_coalescable = [](const PointerData& pointer_data) {
+    return pointer_data.signal_kind == PointerData::SignalKind::kNone &&
+           (pointer_data.change == PointerData::Change::kMove ||
+            pointer_data.change == PointerData::Change::kHover ||
+            pointer_data.change == PointerData::Change::kPanZoomUpdate);
+  };
+
+  // The index in `pointers` of the last event of each device, if that event
+  // can be combined with the next.
+  std::map<int64_t, size_t> coalescable;
+  std::vector<bool> combined(pointers.size(), false);
+  for (size_t i = 0; i < pointers.size(); i++) {
+    PointerData& pointer_data = pointers[i];
+    if (!is_coalescable(pointer_data)) {
+      coalescable.erase(pointer_data.device);
+      continue;
+    }
+    auto found = coalescable.find(pointer_data.device);
+    if (found != coalescable.end()) {
+      const PointerData& previous = pointers[found->second];
+      if (previous.change == pointer_data.change &&
+          previous.buttons == pointer_data.buttons &&
+          previous.pointer_identifier == pointer_data.pointer_identifier) {
+        pointer_data.physical_delta_x += previous.physical_delta_x;
+        pointer_data.physical_delta_y += previous.physical_delta_y;
+        pointer_data.pan_delta_x += previous.pan_delta_x;
+        pointer_data.pan_delta_y += previous.pan_delta_y;
+        pointer_data.synthesized =
+            previous.synthesized && pointer_data.synthesized;
+        combined[found->second] = true;
+      }
+    }
+    coalescable[pointer_data.device] = i;
   }
 
-  return converted_packet;
+  size_t count = 0;
+  for (size_t i = 0; i < pointers.size(); i++) {
+    if (!combined[i]) {
+      pointers[count++] = pointers[i];
+    }
+  }
+  pointers.resize(count);
 }
 
 void PointerDataPacketConverter::ConvertPointerData(
@@ -96,6 +96,24 @@ class PointerDataPacketConverter {
   std::unique_ptr<PointerDataPacket> Convert(
       std::unique_ptr<PointerDataPacket> packet);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Combines each run of move, hover or pan zoom update events of
+  ///             a pointer that are not separated by other events of that
+  ///             pointer into the last event of the run, which receives the
+  ///             sum of their deltas. The combined event takes the place of
+  ///             the last event of the run.
+  ///
+  ///             High frequency input devices, such as 240Hz styluses and
+  ///             trackpads, deliver several moves per frame that the
+  ///             framework would otherwise process one at a time. Combining
+  ///             them loses the intermediate positions, which the framework
+  ///             uses to estimate velocities, so it is only done on request.
+  ///
+  /// @param[in]  pointers  The converted pointer data, which is combined in
+  ///                       place.
+  ///
+  static void CoalesceMoves(std::vector<PointerData>& pointers);  // NOLINT
+
  private:
   std::map<int64_t, PointerState> states_;
 
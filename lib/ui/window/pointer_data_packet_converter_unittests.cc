@@ -713,5 +713,83 @@ TEST(PointerDataPacketConverterTest, CanConvertTrackpadGesture) {
   ASSERT_EQ(result[3].synthesized, 0);
 }
 
+TEST(PointerDataPacketConverterTest, CanCoalesceMoves) {
+  PointerDataPacketConverter converter;
+  auto packet = std::make_unique<PointerDataPacket>(8);
+  PointerData data;
+  CreateSimulatedPointerData(data, PointerData::Change::kDown, 0, 0.0, 0.0, 1);
+  packet->SetPointerData(0, data);
+  CreateSimulatedPointerData(data, PointerData::Change::kMove, 0, 1.0, 2.0, 1);
+  packet->SetPointerData(1, data);
+  CreateSimulatedPointerData(data, PointerData::Change::kMove, 0, 3.0, 4.0, 1);
+  packet->SetPointerData(2, data);
+  // Events of other pointers don't interrupt a run of moves.
+  CreateSimulatedPointerData(data, PointerData::Change::kDown, 1, 9.0, 9.0, 1);
+  packet->SetPointerData(3, data);
+  CreateSimulatedPointerData(data, PointerData::Change::kMove, 0, 6.0, 8.0, 1);
+  packet->SetPointerData(4, data);
+  // A change of buttons ends a run.
+  CreateSimulatedPointerData(data, PointerData::Change::kMove, 0, 7.0, 8.0, 3);
+  packet->SetPointerData(5, data);
+  CreateSimulatedPointerData(data, PointerData::Change::kUp, 0, 7.0, 8.0, 0);
+  packet->SetPointerData(6, data);
+  CreateSimulatedPointerData(data, PointerData::Change::kMove, 1, 10.0, 9.0,
+                             1);
+  packet->SetPointerData(7, data);
+  auto converted_packet = converter.Convert(std::move(packet));
+
+  std::vector<PointerData> result;
+  UnpackPointerPacket(result, std::move(converted_packet));
+  PointerDataPacketConverter::CoalesceMoves(result);
+
+  // A synthesized add precedes each down.
+  ASSERT_EQ(result.size(), (size_t)8);
+  ASSERT_EQ(result[0].change, PointerData::Change::kAdd);
+  ASSERT_EQ(result[1].change, PointerData::Change::kDown);
+  ASSERT_EQ(result[2].change, PointerData::Change::kAdd);
+  ASSERT_EQ(result[2].device, 1);
+  ASSERT_EQ(result[3].change, PointerData::Change::kDown);
+  ASSERT_EQ(result[3].device, 1);
+
+  ASSERT_EQ(result[4].change, PointerData::Change::kMove);
+  ASSERT_EQ(result[4].device, 0);
+  ASSERT_EQ(result[4].physical_x, 6.0);
+  ASSERT_EQ(result[4].physical_y, 8.0);
+  ASSERT_EQ(result[4].physical_delta_x, 6.0);
+  ASSERT_EQ(result[4].physical_delta_y, 8.0);
+  ASSERT_EQ(result[4].synthesized, 0);
+
+  ASSERT_EQ(result[5].change, PointerData::Change::kMove);
+  ASSERT_EQ(result[5].buttons, 3);
+  ASSERT_EQ(result[5].physical_delta_x, 1.0);
+  ASSERT_EQ(result[5].physical_delta_y, 0.0);
+
+  ASSERT_EQ(result[6].change, PointerData::Change::kUp);
+  ASSERT_EQ(result[7].change, PointerData::Change::kMove);
+  ASSERT_EQ(result[7].device, 1);
+}
+
+TEST(PointerDataPacketConverterTest, ConvertDoesNotCoalesceMoves) {
+  PointerDataPacketConverter converter;
+  auto packet = std::make_unique<PointerDataPacket>(4);
+  PointerData data;
+  CreateSimulatedPointerData(data, PointerData::Change::kAdd, 0, 0.0, 0.0, 0);
+  packet->SetPointerData(0, data);
+  CreateSimulatedPointerData(data, PointerData::Change::kDown, 0, 0.0, 0.0, 1);
+  packet->SetPointerData(1, data);
+  CreateSimulatedPointerData(data, PointerData::Change::kMove, 0, 1.0, 0.0, 1);
+  packet->SetPointerData(2, data);
+  CreateSimulatedPointerData(data, PointerData::Change::kMove, 0, 2.0, 0.0, 1);
+  packet->SetPointerData(3, data);
+  auto converted_packet = converter.Convert(std::move(packet));
+
+  std::vector<PointerData> result;
+  UnpackPointerPacket(result, std::move(converted_packet));
+
+  ASSERT_EQ(result.size(), (size_t)4);
+  ASSERT_EQ(result[2].physical_delta_x, 1.0);
+  ASSERT_EQ(result[3].physical_delta_x, 1.0);
+}
+
 }  // namespace testing
 }  // namespace flutter
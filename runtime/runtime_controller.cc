@@ -300,10 +300,10 @@ bool RuntimeController::DispatchPlatformMessage(
 }
 
 bool RuntimeController::DispatchPointerDataPacket(
-    const PointerDataPacket& packet) {
+    std::unique_ptr<PointerDataPacket> packet) {
   if (auto* platform_configuration = GetPlatformConfigurationIfAvailable()) {
     TRACE_EVENT0("flutter", "RuntimeController::DispatchPointerDataPacket");
-    platform_configuration->DispatchPointerDataPacket(packet);
+    platform_configuration->DispatchPointerDataPacket(std::move(packet));
     return true;
   }
 
@@ -54,10 +54,11 @@ Engine::Engine(
       font_collection_(font_collection),
       image_decoder_(ImageDecoder::Make(settings_,
                                         task_runners,
-                                        std::move(image_decoder_task_runner),
+                                        image_decoder_task_runner,
                                         std::move(io_manager),
                                         gpu_disabled_switch)),
       task_runners_(task_runners),
+      concurrent_task_runner_(std::move(image_decoder_task_runner)),
       weak_factory_(this) {
   pointer_data_dispatcher_ = dispatcher_maker(*this);
 }
@@ -183,7 +184,9 @@ bool Engine::UpdateAssetManager(
 
   // Using libTXT as the text engine.
   if (settings_.use_asset_fonts) {
-    font_collection_->RegisterFonts(asset_manager_);
+    font_collection_->RegisterFonts(
+        asset_manager_,
+        settings_.preload_asset_fonts ? concurrent_task_runner_ : nullptr);
   }
 
   if (settings_.use_test_fonts) {
@@ -518,7 +521,7 @@ void Engine::DoDispatchPacket(std::unique_ptr<PointerDataPacket> packet,
                               uint64_t trace_flow_id) {
   animator_->EnqueueTraceFlowId(trace_flow_id);
   if (runtime_controller_) {
-    runtime_controller_->DispatchPointerDataPacket(*packet);
+    runtime_controller_->DispatchPointerDataPacket(std::move(packet));
   }
 }
 
@@ -4,7 +4,10 @@
 
 #include "flutter/shell/common/pointer_data_dispatcher.h"
 
+#include <vector>
+
 #include "flutter/fml/trace_event.h"
+#include "flutter/lib/ui/window/pointer_data_packet_converter.h"
 
 namespace flutter {
 
@@ -15,6 +18,11 @@ SmoothPointerDataDispatcher::SmoothPointerDataDispatcher(Delegate& delegate)
     : DefaultPointerDataDispatcher(delegate), weak_factory_(this) {}
 SmoothPointerDataDispatcher::~SmoothPointerDataDispatcher() = default;
 
+CoalescingPointerDataDispatcher::CoalescingPointerDataDispatcher(
+    Delegate& delegate)
+    : DefaultPointerDataDispatcher(delegate), weak_factory_(this) {}
+CoalescingPointerDataDispatcher::~CoalescingPointerDataDispatcher() = default;
+
 void DefaultPointerDataDispatcher::DispatchPacket(
     std::unique_ptr<PointerDataPacket> packet,
     uint64_t trace_flow_id) {
@@ -72,4 +80,76 @@ void SmoothPointerDataDispatcher::DispatchPendingPacket() {
   ScheduleSecondaryVsyncCallback();
 }
 
+static void AppendPointers(const PointerDataPacket& packet,
+                           std::vector<PointerData>& pointers) {
+  for (size_t i = 0; i < packet.GetLength(); i++) {
+    pointers.push_back(packet.GetPointerData(i));
+  }
+}
+
+static std::unique_ptr<PointerDataPacket> CoalescePointers(
+    std::vector<PointerData>& pointers) {
+  PointerDataPacketConverter::CoalesceMoves(pointers);
+  return std::make_unique<PointerDataPacket>(
+      reinterpret_cast<uint8_t*>(pointers.data()),
+      pointers.size() * sizeof(PointerData));
+}
+
+void CoalescingPointerDataDispatcher::DispatchPacket(
+    std::unique_ptr<PointerDataPacket> packet,
+    uint64_t trace_flow_id) {
+  TRACE_EVENT0_WITH_FLOW_IDS("flutter",
+                             "CoalescingPointerDataDispatcher::DispatchPacket",
+                             /*flow_id_count=*/1, &trace_flow_id);
+  TRACE_FLOW_STEP("flutter", "PointerEvent", trace_flow_id);
+
+  if (is_pointer_data_in_progress_) {
+    pending_pointers_.reserve(pending_pointers_.size() + packet->GetLength());
+    AppendPointers(*packet, pending_pointers_);
+    pending_trace_flow_ids_.push_back(trace_flow_id);
+  } else {
+    FML_DCHECK(pending_pointers_.empty());
+    std::vector<PointerData> pointers;
+    pointers.reserve(packet->GetLength());
+    AppendPointers(*packet, pointers);
+    DefaultPointerDataDispatcher::DispatchPacket(CoalescePointers(pointers),
+                                                 trace_flow_id);
+    is_pointer_data_in_progress_ = true;
+  }
+  ScheduleSecondaryVsyncCallback();
+}
+
+void CoalescingPointerDataDispatcher::ScheduleSecondaryVsyncCallback() {
+  delegate_.ScheduleSecondaryVsyncCallback(
+      reinterpret_cast<uintptr_t>(this),
+      [dispatcher = weak_factory_.GetWeakPtr()]() {
+        if (dispatcher && dispatcher->is_pointer_data_in_progress_) {
+          if (!dispatcher->pending_trace_flow_ids_.empty()) {
+            dispatcher->DispatchPendingPointers();
+          } else {
+            dispatcher->is_pointer_data_in_progress_ = false;
+          }
+        }
+      });
+}
+
+void CoalescingPointerDataDispatcher::DispatchPendingPointers() {
+  FML_DCHECK(!pending_trace_flow_ids_.empty());
+  FML_DCHECK(is_pointer_data_in_progress_);
+  TRACE_EVENT0("flutter",
+               "CoalescingPointerDataDispatcher::DispatchPendingPointers");
+  // The combined packet continues the flow of the first packet. The flows of
+  // the others end here.
+  for (size_t i = 1; i < pending_trace_flow_ids_.size(); i++) {
+    TRACE_FLOW_END("flutter", "PointerEvent", pending_trace_flow_ids_[i]);
+  }
+  const uint64_t trace_flow_id = pending_trace_flow_ids_.front();
+  auto packet = CoalescePointers(pending_pointers_);
+  pending_pointers_.clear();
+  pending_trace_flow_ids_.clear();
+  DefaultPointerDataDispatcher::DispatchPacket(std::move(packet),
+                                               trace_flow_id);
+  ScheduleSecondaryVsyncCallback();
+}
+
 }  // namespace flutter
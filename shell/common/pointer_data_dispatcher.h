@@ -163,6 +163,49 @@ class SmoothPointerDataDispatcher : public DefaultPointerDataDispatcher {
   FML_DISALLOW_COPY_AND_ASSIGN(SmoothPointerDataDispatcher);
 };
 
+//------------------------------------------------------------------------------
+/// A dispatcher that combines the moves of each pointer that are delivered
+/// within one VSYNC, so that the framework handles at most one move per
+/// pointer and frame from high frequency input devices.
+///
+/// Like `SmoothPointerDataDispatcher`, a packet is dispatched right away if no
+/// pointer data was dispatched since the last VSYNC. Otherwise its events are
+/// appended to the pending events, which are dispatched as a single packet at
+/// the next VSYNC. Embedders usually deliver one move per packet, so the runs
+/// of moves of each device are combined with
+/// `PointerDataPacketConverter::CoalesceMoves` across all the pending packets,
+/// not only within each of them.
+///
+/// The intermediate positions of a combined run are dropped, not kept as
+/// history: `PointerData` has no room for them and the framework doesn't
+/// consume them. This is why this dispatcher is only used when
+/// `Settings::coalesce_pointer_moves` is set, in which case it replaces the
+/// dispatcher of the `PlatformView`.
+class CoalescingPointerDataDispatcher : public DefaultPointerDataDispatcher {
+ public:
+  explicit CoalescingPointerDataDispatcher(Delegate& delegate);
+
+  // |PointerDataDispatcer|
+  void DispatchPacket(std::unique_ptr<PointerDataPacket> packet,
+                      uint64_t trace_flow_id) override;
+
+  virtual ~CoalescingPointerDataDispatcher();
+
+ private:
+  void DispatchPendingPointers();
+  void ScheduleSecondaryVsyncCallback();
+
+  // The events received since the last dispatch, to be combined and
+  // dispatched at the next VSYNC.
+  std::vector<PointerData> pending_pointers_;
+  std::vector<uint64_t> pending_trace_flow_ids_;
+  bool is_pointer_data_in_progress_ = false;
+
+  // WeakPtrFactory must be the last member.
+  fml::WeakPtrFactory<CoalescingPointerDataDispatcher> weak_factory_;
+  FML_DISALLOW_COPY_AND_ASSIGN(CoalescingPointerDataDispatcher);
+};
+
 //--------------------------------------------------------------------------
 /// @brief      Signature for constructing PointerDataDispatcher.
 ///
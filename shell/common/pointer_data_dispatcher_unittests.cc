@@ -0,0 +1,171 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/pointer_data_dispatcher.h"
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "flutter/testing/testing.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+/// Records the dispatched packets, and lets the test decide when the vsync
+/// callbacks run.
+class FakeDelegate : public PointerDataDispatcher::Delegate {
+ public:
+  void DoDispatchPacket(std::unique_ptr<PointerDataPacket> packet,
+                        uint64_t trace_flow_id) override {
+    std::vector<PointerData> pointers;
+    for (size_t i = 0; i < packet->GetLength(); i++) {
+      pointers.push_back(packet->GetPointerData(i));
+    }
+    dispatched_.push_back(std::move(pointers));
+    dispatched_flow_ids_.push_back(trace_flow_id);
+  }
+
+  void ScheduleSecondaryVsyncCallback(uintptr_t id,
+                                      const fml::closure& callback) override {
+    vsync_callbacks_[id] = callback;
+  }
+
+  void Vsync() {
+    auto callbacks = std::move(vsync_callbacks_);
+    vsync_callbacks_.clear();
+    for (const auto& [id, callback] : callbacks) {
+      callback();
+    }
+  }
+
+  const std::vector<std::vector<PointerData>>& dispatched() const {
+    return dispatched_;
+  }
+
+  const std::vector<uint64_t>& dispatched_flow_ids() const {
+    return dispatched_flow_ids_;
+  }
+
+ private:
+  std::vector<std::vector<PointerData>> dispatched_;
+  std::vector<uint64_t> dispatched_flow_ids_;
+  std::map<uintptr_t, fml::closure> vsync_callbacks_;
+};
+
+PointerData CreatePointerData(PointerData::Change change,
+                              int64_t device,
+                              double delta_x) {
+  PointerData data;
+  data.Clear();
+  data.change = change;
+  data.kind = PointerData::DeviceKind::kTouch;
+  data.signal_kind = PointerData::SignalKind::kNone;
+  data.device = device;
+  data.pointer_identifier = device + 1;
+  data.physical_delta_x = delta_x;
+  data.buttons = 1;
+  return data;
+}
+
+std::unique_ptr<PointerDataPacket> CreatePacket(
+    const std::vector<PointerData>& pointers) {
+  auto packet = std::make_unique<PointerDataPacket>(pointers.size());
+  for (size_t i = 0; i < pointers.size(); i++) {
+    packet->SetPointerData(i, pointers[i]);
+  }
+  return packet;
+}
+
+}  // namespace
+
+TEST(CoalescingPointerDataDispatcherTest, DispatchesFirstPacketRightAway) {
+  FakeDelegate delegate;
+  CoalescingPointerDataDispatcher dispatcher(delegate);
+
+  dispatcher.DispatchPacket(
+      CreatePacket({CreatePointerData(PointerData::Change::kMove, 0, 1.0),
+                    CreatePointerData(PointerData::Change::kMove, 0, 2.0)}),
+      1);
+
+  // Moves within the packet are combined too.
+  ASSERT_EQ(delegate.dispatched().size(), 1u);
+  ASSERT_EQ(delegate.dispatched()[0].size(), 1u);
+  EXPECT_EQ(delegate.dispatched()[0][0].physical_delta_x, 3.0);
+  EXPECT_EQ(delegate.dispatched_flow_ids()[0], 1u);
+}
+
+TEST(CoalescingPointerDataDispatcherTest, CombinesMovesOfPacketsWithinAFrame) {
+  FakeDelegate delegate;
+  CoalescingPointerDataDispatcher dispatcher(delegate);
+
+  dispatcher.DispatchPacket(
+      CreatePacket({CreatePointerData(PointerData::Change::kDown, 0, 0.0)}), 1);
+  ASSERT_EQ(delegate.dispatched().size(), 1u);
+
+  // One move per packet, as most embedders deliver them, for two pointers.
+  for (int i = 0; i < 4; i++) {
+    dispatcher.DispatchPacket(
+        CreatePacket({CreatePointerData(PointerData::Change::kMove, 0, 1.0)}),
+        2 + i);
+  }
+  dispatcher.DispatchPacket(
+      CreatePacket({CreatePointerData(PointerData::Change::kMove, 1, 5.0)}), 6);
+  dispatcher.DispatchPacket(
+      CreatePacket({CreatePointerData(PointerData::Change::kMove, 1, 5.0)}), 7);
+  EXPECT_EQ(delegate.dispatched().size(), 1u);
+
+  delegate.Vsync();
+  ASSERT_EQ(delegate.dispatched().size(), 2u);
+  const auto& combined = delegate.dispatched()[1];
+  ASSERT_EQ(combined.size(), 2u);
+  EXPECT_EQ(combined[0].device, 0);
+  EXPECT_EQ(combined[0].physical_delta_x, 4.0);
+  EXPECT_EQ(combined[1].device, 1);
+  EXPECT_EQ(combined[1].physical_delta_x, 10.0);
+  // The combined packet continues the flow of the first pending packet.
+  EXPECT_EQ(delegate.dispatched_flow_ids()[1], 2u);
+
+  // Nothing is pending for the next frame, after which packets are dispatched
+  // right away again.
+  delegate.Vsync();
+  EXPECT_EQ(delegate.dispatched().size(), 2u);
+  dispatcher.DispatchPacket(
+      CreatePacket({CreatePointerData(PointerData::Change::kUp, 0, 0.0)}), 8);
+  EXPECT_EQ(delegate.dispatched().size(), 3u);
+}
+
+TEST(CoalescingPointerDataDispatcherTest, KeepsEventsThatEndARunOfMoves) {
+  FakeDelegate delegate;
+  CoalescingPointerDataDispatcher dispatcher(delegate);
+
+  dispatcher.DispatchPacket(
+      CreatePacket({CreatePointerData(PointerData::Change::kDown, 0, 0.0)}), 1);
+  dispatcher.DispatchPacket(
+      CreatePacket({CreatePointerData(PointerData::Change::kMove, 0, 1.0)}), 2);
+  dispatcher.DispatchPacket(
+      CreatePacket({CreatePointerData(PointerData::Change::kMove, 0, 1.0)}), 3);
+  dispatcher.DispatchPacket(
+      CreatePacket({CreatePointerData(PointerData::Change::kUp, 0, 0.0)}), 4);
+  dispatcher.DispatchPacket(
+      CreatePacket({CreatePointerData(PointerData::Change::kDown, 0, 0.0)}), 5);
+  dispatcher.DispatchPacket(
+      CreatePacket({CreatePointerData(PointerData::Change::kMove, 0, 3.0)}), 6);
+
+  delegate.Vsync();
+  ASSERT_EQ(delegate.dispatched().size(), 2u);
+  const auto& combined = delegate.dispatched()[1];
+  ASSERT_EQ(combined.size(), 4u);
+  EXPECT_EQ(combined[0].change, PointerData::Change::kMove);
+  EXPECT_EQ(combined[0].physical_delta_x, 2.0);
+  EXPECT_EQ(combined[1].change, PointerData::Change::kUp);
+  EXPECT_EQ(combined[2].change, PointerData::Change::kDown);
+  EXPECT_EQ(combined[3].change, PointerData::Change::kMove);
+  EXPECT_EQ(combined[3].physical_delta_x, 3.0);
+}
+
+}  // namespace testing
+}  // namespace flutter
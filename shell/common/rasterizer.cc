@@ -80,6 +80,13 @@ void Rasterizer::Setup(std::unique_ptr<Surface> surface) {
     compositor_context_->OnGrContextCreated();
   }
 
+#if IMPELLER_SUPPORTS_RENDERING
+  if (auto aiks_context = surface_->GetAiksContext()) {
+    aiks_context->GetContentContext().SetAsyncRuntimeEffectCompilation(
+        delegate_.GetSettings().impeller_async_runtime_effect_compilation);
+  }
+#endif  // IMPELLER_SUPPORTS_RENDERING
+
   if (external_view_embedder_ &&
       external_view_embedder_->SupportsDynamicThreadMerging() &&
       !raster_thread_merger_) {
@@ -22,6 +22,7 @@
 #include "flutter/fml/message_loop.h"
 #include "flutter/fml/paths.h"
 #include "flutter/fml/trace_event.h"
+#include "flutter/lib/ui/painting/decoded_image_cache.h"
 #include "flutter/runtime/dart_vm.h"
 #include "flutter/shell/common/base64.h"
 #include "flutter/shell/common/engine.h"
@@ -297,6 +298,11 @@ std::unique_ptr<Shell> Shell::CreateShellOnPlatformThread(
   // Send dispatcher_maker to the engine constructor because shell won't have
   // platform_view set until Shell::Setup is called later.
   auto dispatcher_maker = platform_view->GetDispatcherMaker();
+  if (shell->GetSettings().coalesce_pointer_moves) {
+    dispatcher_maker = [](PointerDataDispatcher::Delegate& delegate) {
+      return std::make_unique<CoalescingPointerDataDispatcher>(delegate);
+    };
+  }
 
   // Create the engine on the UI thread.
   std::promise<std::unique_ptr<Engine>> engine_promise;
@@ -609,7 +615,10 @@ void Shell::NotifyLowMemoryWarning() const {
                                trace_id);
       });
   // The IO Manager uses resource cache limits of 0, so it is not necessary
-  // to purge them.
+  // to purge them. Decoded images kept for reuse can be decoded again.
+  if (io_manager_ && io_manager_->GetDecodedImageCache()) {
+    io_manager_->GetDecodedImageCache()->Purge();
+  }
 }
 
 void Shell::RunEngine(RunConfiguration run_configuration) {
@@ -981,6 +990,11 @@ void Shell::OnPlatformViewSetViewportMetrics(int64_t view_id,
       metrics.physical_width * metrics.physical_height * 12 * 4;
   size_t resource_cache_max_bytes =
       resource_cache_limit_calculator_->GetResourceCacheMaxBytes();
+  // Decoded images are budgeted like the GPU resources of the shells sharing
+  // the IO manager.
+  if (io_manager_ && io_manager_->GetDecodedImageCache()) {
+    io_manager_->GetDecodedImageCache()->SetMaxBytes(resource_cache_max_bytes);
+  }
   task_runners_.GetRasterTaskRunner()->PostTask(
       [rasterizer = rasterizer_->GetWeakPtr(), resource_cache_max_bytes] {
         if (rasterizer) {
@@ -54,6 +54,7 @@ ShellIOManager::ShellIOManager(
           /*drain_immediate=*/!!impeller_context)),
       is_gpu_disabled_sync_switch_(std::move(is_gpu_disabled_sync_switch)),
       impeller_context_(std::move(impeller_context)),
+      decoded_image_cache_(std::make_shared<DecodedImageCache>()),
       weak_factory_(this) {
   if (!resource_context_) {
 #ifndef OS_FUCHSIA
@@ -65,6 +66,9 @@ ShellIOManager::ShellIOManager(
 }
 
 ShellIOManager::~ShellIOManager() {
+  // Cached images may still need to be collected by the IO queue.
+  decoded_image_cache_->Purge();
+
   // Last chance to drain the IO queue as the platform side reference to the
   // underlying OpenGL context may be going away.
   is_gpu_disabled_sync_switch_->Execute(
@@ -90,6 +94,8 @@ void ShellIOManager::UpdateResourceContext(
                 resource_context_.get())
           : nullptr;
   unref_queue_->UpdateResourceContext(resource_context_);
+  // Images uploaded with the previous resource context can't be reused.
+  decoded_image_cache_->Purge();
 }
 
 fml::WeakPtr<ShellIOManager> ShellIOManager::GetWeakPtr() {
@@ -124,4 +130,10 @@ std::shared_ptr<impeller::Context> ShellIOManager::GetImpellerContext() const {
   return impeller_context_;
 }
 
+// |IOManager|
+std::shared_ptr<DecodedImageCache> ShellIOManager::GetDecodedImageCache()
+    const {
+  return decoded_image_cache_;
+}
+
 }  // namespace flutter
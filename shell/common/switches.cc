@@ -444,6 +444,11 @@ Settings SettingsFromCommandLine(const fml::CommandLine& command_line) {
       command_line.HasOption(FlagForSwitch(Switch::UseTestFonts));
   settings.use_asset_fonts =
       !command_line.HasOption(FlagForSwitch(Switch::DisableAssetFonts));
+  settings.preload_asset_fonts =
+      command_line.HasOption(FlagForSwitch(Switch::PreloadAssetFonts));
+
+  settings.coalesce_pointer_moves =
+      command_line.HasOption(FlagForSwitch(Switch::CoalescePointerMoves));
 
   {
     std::string enable_impeller_value;
@@ -468,6 +473,8 @@ Settings SettingsFromCommandLine(const fml::CommandLine& command_line) {
       command_line.HasOption(FlagForSwitch(Switch::EnableVulkanValidation));
   settings.enable_opengl_gpu_tracing =
       command_line.HasOption(FlagForSwitch(Switch::EnableOpenGLGPUTracing));
+  settings.impeller_async_runtime_effect_compilation = command_line.HasOption(
+      FlagForSwitch(Switch::ImpellerAsyncRuntimeEffectCompilation));
 
   settings.enable_embedder_api =
       command_line.HasOption(FlagForSwitch(Switch::EnableEmbedderAPI));
@@ -218,6 +218,16 @@ DEF_SWITCH(PrefetchedDefaultFontManager,
            "prefetched-default-font-manager",
            "Indicates whether the embedding started a prefetch of the "
            "default font manager before creating the engine.")
+DEF_SWITCH(PreloadAssetFonts,
+           "preload-asset-fonts",
+           "Load and parse the fonts declared in the font manifest on the "
+           "concurrent worker pool when the engine starts, instead of when "
+           "text first uses them.")
+DEF_SWITCH(CoalescePointerMoves,
+           "coalesce-pointer-moves",
+           "Combine the consecutive moves of a pointer that the platform "
+           "delivers within one frame into a single event, instead of "
+           "dispatching every intermediate position to the framework.")
 DEF_SWITCH(VerboseLogging,
            "verbose-logging",
            "By default, only errors are logged. This flag enabled logging at "
@@ -279,6 +289,11 @@ DEF_SWITCH(EnableOpenGLGPUTracing,
            "enable-opengl-gpu-tracing",
            "Enable tracing of GPU execution time when using the Impeller "
            "OpenGLES backend.")
+DEF_SWITCH(ImpellerAsyncRuntimeEffectCompilation,
+           "impeller-async-runtime-effect-compilation",
+           "Skip Impeller runtime effects whose pipelines are still compiling "
+           "instead of waiting for them. The effects are drawn on a later "
+           "frame once their pipelines are ready.")
 DEF_SWITCH(LeakVM,
            "leak-vm",
            "When the last shell shuts down, the shared VM is leaked by default "
@@ -12,6 +12,7 @@
 #include "flutter/fml/mapping.h"
 #include "flutter/fml/trace_event.h"
 #include "impeller/display_list/dl_dispatcher.h"
+#include "impeller/renderer/backend/metal/context_mtl.h"
 #include "impeller/renderer/backend/metal/surface_mtl.h"
 #include "impeller/typographer/backends/skia/typographer_context_skia.h"
 
@@ -29,6 +30,15 @@ static std::shared_ptr<impeller::Renderer> CreateImpellerRenderer(
   return renderer;
 }
 
+static std::shared_ptr<impeller::TypographerContext> CreateTypographerContext(
+    const std::shared_ptr<impeller::Context>& context) {
+  if (!context) {
+    return impeller::TypographerContextSkia::Make();
+  }
+  return impeller::TypographerContextSkia::Make(
+      impeller::ContextMTL::Cast(*context).GetWorkerTaskRunner());
+}
+
 GPUSurfaceMetalImpeller::GPUSurfaceMetalImpeller(GPUSurfaceMetalDelegate* delegate,
                                                  const std::shared_ptr<impeller::Context>& context,
                                                  bool render_to_surface)
@@ -37,7 +47,7 @@ GPUSurfaceMetalImpeller::GPUSurfaceMetalImpeller(GPUSurfaceMetalDelegate* delega
       impeller_renderer_(CreateImpellerRenderer(context)),
       aiks_context_(
           std::make_shared<impeller::AiksContext>(impeller_renderer_ ? context : nullptr,
-                                                  impeller::TypographerContextSkia::Make())),
+                                                  CreateTypographerContext(context))),
       render_to_surface_(render_to_surface) {
   // If this preference is explicitly set, we allow for disabling partial repaint.
   NSNumber* disablePartialRepaint =
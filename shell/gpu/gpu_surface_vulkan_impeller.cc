@@ -6,6 +6,7 @@
 
 #include "flutter/fml/make_copyable.h"
 #include "impeller/display_list/dl_dispatcher.h"
+#include "impeller/renderer/backend/vulkan/context_vk.h"
 #include "impeller/renderer/backend/vulkan/surface_context_vk.h"
 #include "impeller/renderer/renderer.h"
 #include "impeller/renderer/surface.h"
@@ -24,8 +25,11 @@ GPUSurfaceVulkanImpeller::GPUSurfaceVulkanImpeller(
     return;
   }
 
+  auto worker_task_runner = impeller::SurfaceContextVK::Cast(*context)
+                                .GetParent()
+                                ->GetConcurrentWorkerTaskRunner();
   auto aiks_context = std::make_shared<impeller::AiksContext>(
-      context, impeller::TypographerContextSkia::Make());
+      context, impeller::TypographerContextSkia::Make(worker_task_runner));
   if (!aiks_context->IsValid()) {
     return;
   }
@@ -19,6 +19,32 @@ constexpr int kHasScrollingAction =
     FlutterSemanticsAction::kFlutterSemanticsActionScrollUp |
     FlutterSemanticsAction::kFlutterSemanticsActionScrollDown;
 
+// Whether a node update would leave the node as it is in the tree. The
+// offset container of a node in the tree is set after the update that added
+// it, from its parent, so it isn't compared.
+static bool IsNodeDataUnchanged(const ui::AXNodeData& update,
+                                const ui::AXNodeData& existing) {
+  const gfx::Transform* update_transform =
+      update.relative_bounds.transform.get();
+  const gfx::Transform* existing_transform =
+      existing.relative_bounds.transform.get();
+  if ((update_transform == nullptr) != (existing_transform == nullptr) ||
+      (update_transform && *update_transform != *existing_transform)) {
+    return false;
+  }
+  return update.role == existing.role && update.state == existing.state &&
+         update.actions == existing.actions &&
+         update.relative_bounds.bounds == existing.relative_bounds.bounds &&
+         update.child_ids == existing.child_ids &&
+         update.string_attributes == existing.string_attributes &&
+         update.int_attributes == existing.int_attributes &&
+         update.float_attributes == existing.float_attributes &&
+         update.bool_attributes == existing.bool_attributes &&
+         update.intlist_attributes == existing.intlist_attributes &&
+         update.stringlist_attributes == existing.stringlist_attributes &&
+         update.html_attributes == existing.html_attributes;
+}
+
 // AccessibilityBridge
 AccessibilityBridge::AccessibilityBridge()
     : tree_(std::make_unique<ui::AXTree>()) {
@@ -295,6 +321,14 @@ void AccessibilityBridge::ConvertFlutterUpdate(const SemanticsNode& node,
     node_data.child_ids.push_back(child);
   }
   SetTreeData(node, tree_update);
+
+  // The framework resends every node that was marked dirty, even if its
+  // semantics ended up unchanged. Leaving those nodes out of the update saves
+  // the tree from replacing their data and reporting them as changed.
+  ui::AXNode* existing = tree_->GetFromId(node.id);
+  if (existing && IsNodeDataUnchanged(node_data, existing->data())) {
+    return;
+  }
   tree_update.nodes.push_back(node_data);
 }
 
@@ -205,6 +205,51 @@ TEST(AccessibilityBridgeTest, CanFireChildrenChangedCorrectly) {
               Contains(ui::AXEventGenerator::Event::SUBTREE_CREATED));
 }
 
+TEST(AccessibilityBridgeTest, LeavesUnchangedNodesOutOfUpdates) {
+  std::shared_ptr<TestAccessibilityBridge> bridge =
+      std::make_shared<TestAccessibilityBridge>();
+
+  std::vector<int32_t> children{1, 2};
+  FlutterSemanticsNode2 root = CreateSemanticsNode(0, "root", &children);
+  FlutterSemanticsNode2 child1 = CreateSemanticsNode(1, "child 1");
+  FlutterSemanticsNode2 child2 = CreateSemanticsNode(2, "child 2");
+  bridge->AddFlutterSemanticsNodeUpdate(root);
+  bridge->AddFlutterSemanticsNodeUpdate(child1);
+  bridge->AddFlutterSemanticsNodeUpdate(child2);
+  bridge->CommitUpdates();
+
+  class ChangedNodesObserver : public ui::AXTreeObserver {
+   public:
+    std::vector<int32_t> changed_ids;
+
+    void OnAtomicUpdateFinished(ui::AXTree* tree,
+                                bool root_changed,
+                                const std::vector<Change>& changes) override {
+      for (const auto& change : changes) {
+        changed_ids.push_back(change.node->id());
+      }
+    }
+  };
+  ChangedNodesObserver observer;
+  bridge->GetTree()->AddObserver(&observer);
+
+  // Only the label of child 2 changes.
+  child2.label = "new child 2";
+  bridge->AddFlutterSemanticsNodeUpdate(root);
+  bridge->AddFlutterSemanticsNodeUpdate(child1);
+  bridge->AddFlutterSemanticsNodeUpdate(child2);
+  bridge->CommitUpdates();
+  bridge->GetTree()->RemoveObserver(&observer);
+
+  EXPECT_EQ(observer.changed_ids, std::vector<int32_t>{2});
+  EXPECT_EQ(bridge->GetFlutterPlatformNodeDelegateFromID(2).lock()->GetName(),
+            "new child 2");
+  EXPECT_EQ(bridge->GetFlutterPlatformNodeDelegateFromID(0)
+                .lock()
+                ->GetChildCount(),
+            2);
+}
+
 TEST(AccessibilityBridgeTest, CanHandleSelectionChangeCorrectly) {
   std::shared_ptr<TestAccessibilityBridge> bridge =
       std::make_shared<TestAccessibilityBridge>();
@@ -17,6 +17,9 @@
 #include "paragraph_builder_skia.h"
 #include "paragraph_skia.h"
 
+#include <string>
+#include <type_traits>
+
 #include "third_party/skia/modules/skparagraph/include/ParagraphStyle.h"
 #include "third_party/skia/modules/skparagraph/include/TextStyle.h"
 #include "txt/paragraph_style.h"
@@ -42,6 +45,116 @@ SkFontStyle MakeSkFontStyle(txt::FontWeight font_weight,
                                            : SkFontStyle::Slant::kItalic_Slant);
 }
 
+// Paragraph cache keys describe paragraphs with the bytes of the values they
+// were built from. Values that are equal have the same bytes, and values that
+// are unlikely to be equal, such as negative and positive zero, are allowed to
+// be distinct.
+template <typename T>
+void AppendToKey(std::string& key, const T& value) {
+  static_assert(std::is_trivially_copyable_v<T>);
+  key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void AppendToKey(std::string& key, const std::string& value) {
+  AppendToKey(key, value.size());
+  key.append(value);
+}
+
+void AppendToKey(std::string& key, const std::u16string& value) {
+  AppendToKey(key, value.size());
+  key.append(reinterpret_cast<const char*>(value.data()),
+             value.size() * sizeof(char16_t));
+}
+
+void AppendToKey(std::string& key, const std::vector<std::string>& values) {
+  AppendToKey(key, values.size());
+  for (const auto& value : values) {
+    AppendToKey(key, value);
+  }
+}
+
+// The paints of text styles are part of the key's paints rather than of its
+// description.
+void AppendToKey(std::string& key, const TextStyle& style) {
+  AppendToKey(key, style.color);
+  AppendToKey(key, style.decoration);
+  AppendToKey(key, style.decoration_color);
+  AppendToKey(key, style.decoration_style);
+  AppendToKey(key, style.decoration_thickness_multiplier);
+  AppendToKey(key, style.font_weight);
+  AppendToKey(key, style.font_style);
+  AppendToKey(key, style.text_baseline);
+  AppendToKey(key, style.half_leading);
+  AppendToKey(key, style.font_families);
+  AppendToKey(key, style.font_size);
+  AppendToKey(key, style.letter_spacing);
+  AppendToKey(key, style.word_spacing);
+  AppendToKey(key, style.height);
+  AppendToKey(key, style.has_height_override);
+  AppendToKey(key, style.locale);
+  AppendToKey(key, style.background.has_value());
+  AppendToKey(key, style.foreground.has_value());
+  AppendToKey(key, style.text_shadows.size());
+  for (const auto& shadow : style.text_shadows) {
+    AppendToKey(key, shadow.color);
+    AppendToKey(key, shadow.offset.fX);
+    AppendToKey(key, shadow.offset.fY);
+    AppendToKey(key, shadow.blur_sigma);
+  }
+  AppendToKey(key, style.font_features.GetFontFeatures().size());
+  for (const auto& [feature, value] : style.font_features.GetFontFeatures()) {
+    AppendToKey(key, feature);
+    AppendToKey(key, value);
+  }
+  AppendToKey(key, style.font_variations.GetAxisValues().size());
+  for (const auto& [axis, value] : style.font_variations.GetAxisValues()) {
+    AppendToKey(key, axis);
+    AppendToKey(key, value);
+  }
+}
+
+void AppendToKey(std::string& key, const ParagraphStyle& style) {
+  AppendToKey(key, style.font_weight);
+  AppendToKey(key, style.font_style);
+  AppendToKey(key, style.font_family);
+  AppendToKey(key, style.font_size);
+  AppendToKey(key, style.height);
+  AppendToKey(key, style.has_height_override);
+  AppendToKey(key, style.text_height_behavior);
+  AppendToKey(key, style.strut_enabled);
+  AppendToKey(key, style.strut_font_weight);
+  AppendToKey(key, style.strut_font_style);
+  AppendToKey(key, style.strut_font_families);
+  AppendToKey(key, style.strut_font_size);
+  AppendToKey(key, style.strut_height);
+  AppendToKey(key, style.strut_has_height_override);
+  AppendToKey(key, style.strut_half_leading);
+  AppendToKey(key, style.strut_leading);
+  AppendToKey(key, style.force_strut_height);
+  AppendToKey(key, style.text_align);
+  AppendToKey(key, style.text_direction);
+  AppendToKey(key, style.max_lines);
+  AppendToKey(key, style.ellipsis);
+  AppendToKey(key, style.locale);
+  AppendToKey(key, style.apply_rounding_hack);
+}
+
+void AppendToKey(std::string& key, const PlaceholderRun& span) {
+  AppendToKey(key, span.width);
+  AppendToKey(key, span.height);
+  AppendToKey(key, span.alignment);
+  AppendToKey(key, span.baseline);
+  AppendToKey(key, span.baseline_offset);
+}
+
+// Tags that separate the operations of a paragraph builder in cache keys.
+enum class KeyOperation : uint8_t {
+  kPushStyle,
+  kPop,
+  kAddText,
+  kAddPlaceholder,
+};
+
 }  // anonymous namespace
 
 ParagraphBuilderSkia::ParagraphBuilderSkia(
@@ -51,6 +164,12 @@ ParagraphBuilderSkia::ParagraphBuilderSkia(
     : base_style_(style.GetTextStyle()), impeller_enabled_(impeller_enabled) {
   builder_ = skt::ParagraphBuilder::make(
       TxtToSkia(style), font_collection->CreateSktFontCollection());
+  paragraph_cache_ = font_collection->GetParagraphCache();
+  if (paragraph_cache_) {
+    cache_key_.generation = paragraph_cache_->GetGeneration();
+    AppendToKey(cache_key_.description, style);
+    LimitCacheKeySize();
+  }
 }
 
 ParagraphBuilderSkia::~ParagraphBuilderSkia() = default;
@@ -58,11 +177,20 @@ ParagraphBuilderSkia::~ParagraphBuilderSkia() = default;
 void ParagraphBuilderSkia::PushStyle(const TextStyle& style) {
   builder_->pushStyle(TxtToSkia(style));
   txt_style_stack_.push(style);
+  if (paragraph_cache_) {
+    AppendToKey(cache_key_.description, KeyOperation::kPushStyle);
+    AppendToKey(cache_key_.description, style);
+    LimitCacheKeySize();
+  }
 }
 
 void ParagraphBuilderSkia::Pop() {
   builder_->pop();
   txt_style_stack_.pop();
+  if (paragraph_cache_) {
+    AppendToKey(cache_key_.description, KeyOperation::kPop);
+    LimitCacheKeySize();
+  }
 }
 
 const TextStyle& ParagraphBuilderSkia::PeekStyle() {
@@ -71,6 +199,11 @@ const TextStyle& ParagraphBuilderSkia::PeekStyle() {
 
 void ParagraphBuilderSkia::AddText(const std::u16string& text) {
   builder_->addText(text);
+  if (paragraph_cache_) {
+    AppendToKey(cache_key_.description, KeyOperation::kAddText);
+    AppendToKey(cache_key_.description, text);
+    LimitCacheKeySize();
+  }
 }
 
 void ParagraphBuilderSkia::AddPlaceholder(PlaceholderRun& span) {
@@ -83,11 +216,34 @@ void ParagraphBuilderSkia::AddPlaceholder(PlaceholderRun& span) {
       static_cast<skt::PlaceholderAlignment>(span.alignment);
 
   builder_->addPlaceholder(placeholder_style);
+  if (paragraph_cache_) {
+    AppendToKey(cache_key_.description, KeyOperation::kAddPlaceholder);
+    AppendToKey(cache_key_.description, span);
+    LimitCacheKeySize();
+  }
+}
+
+void ParagraphBuilderSkia::LimitCacheKeySize() {
+  if (cache_key_.description.size() > ParagraphCache::kMaxDescriptionSize) {
+    paragraph_cache_.reset();
+    cache_key_ = {};
+  }
 }
 
 std::unique_ptr<Paragraph> ParagraphBuilderSkia::Build() {
+  if (!paragraph_cache_) {
+    return std::make_unique<ParagraphSkia>(
+        builder_->Build(), std::move(dl_paints_), impeller_enabled_);
+  }
+  // Reuse the shaped text and line breaks of an identical paragraph.
+  cache_key_.paints = dl_paints_;
+  auto paragraph = paragraph_cache_->Take(cache_key_);
+  if (!paragraph) {
+    paragraph = builder_->Build();
+  }
   return std::make_unique<ParagraphSkia>(
-      builder_->Build(), std::move(dl_paints_), impeller_enabled_);
+      std::move(paragraph), std::move(dl_paints_), impeller_enabled_,
+      paragraph_cache_, std::move(cache_key_));
 }
 
 skt::ParagraphPainter::PaintID ParagraphBuilderSkia::CreatePaintID(
@@ -18,6 +18,7 @@
 #define LIB_TXT_SRC_PARAGRAPH_BUILDER_SKIA_H_
 
 #include "txt/paragraph_builder.h"
+#include "txt/paragraph_cache.h"
 
 #include "flutter/display_list/dl_paint.h"
 #include "third_party/skia/modules/skparagraph/include/ParagraphBuilder.h"
@@ -50,7 +51,16 @@ class ParagraphBuilderSkia : public ParagraphBuilder {
   skia::textlayout::ParagraphStyle TxtToSkia(const ParagraphStyle& txt);
   skia::textlayout::TextStyle TxtToSkia(const TextStyle& txt);
 
+  /// Stops caching the paragraph once its description is too long to be
+  /// cached.
+  void LimitCacheKeySize();
+
   std::shared_ptr<skia::textlayout::ParagraphBuilder> builder_;
+  /// The paragraph cache, or nullptr if the paragraph is not cached.
+  std::shared_ptr<ParagraphCache> paragraph_cache_;
+  /// Everything the paragraph is built from, used to find a Skia paragraph
+  /// of an identical paragraph in the paragraph cache.
+  ParagraphCache::Key cache_key_;
   TextStyle base_style_;
 
   /// @brief      Whether Impeller is enabled in the runtime.
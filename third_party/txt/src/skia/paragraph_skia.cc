@@ -245,10 +245,20 @@ class DisplayListParagraphPainter : public skt::ParagraphPainter {
 
 ParagraphSkia::ParagraphSkia(std::unique_ptr<skt::Paragraph> paragraph,
                              std::vector<flutter::DlPaint>&& dl_paints,
-                             bool impeller_enabled)
+                             bool impeller_enabled,
+                             std::weak_ptr<ParagraphCache> paragraph_cache,
+                             ParagraphCache::Key cache_key)
     : paragraph_(std::move(paragraph)),
       dl_paints_(dl_paints),
-      impeller_enabled_(impeller_enabled) {}
+      impeller_enabled_(impeller_enabled),
+      paragraph_cache_(std::move(paragraph_cache)),
+      cache_key_(std::move(cache_key)) {}
+
+ParagraphSkia::~ParagraphSkia() {
+  if (auto paragraph_cache = paragraph_cache_.lock()) {
+    paragraph_cache->Put(std::move(cache_key_), std::move(paragraph_));
+  }
+}
 
 double ParagraphSkia::GetMaxWidth() {
   return SkScalarToDouble(paragraph_->getMaxWidth());
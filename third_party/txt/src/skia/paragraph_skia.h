@@ -20,6 +20,7 @@
 #include <optional>
 
 #include "txt/paragraph.h"
+#include "txt/paragraph_cache.h"
 
 #include "third_party/skia/modules/skparagraph/include/Paragraph.h"
 
@@ -28,11 +29,15 @@ namespace txt {
 // Implementation of Paragraph based on Skia's text layout module.
 class ParagraphSkia : public Paragraph {
  public:
+  // If a paragraph cache is given, the Skia paragraph is returned to it with
+  // the key of the paragraph when this paragraph is destroyed.
   ParagraphSkia(std::unique_ptr<skia::textlayout::Paragraph> paragraph,
                 std::vector<flutter::DlPaint>&& dl_paints,
-                bool impeller_enabled);
+                bool impeller_enabled,
+                std::weak_ptr<ParagraphCache> paragraph_cache = {},
+                ParagraphCache::Key cache_key = {});
 
-  virtual ~ParagraphSkia() = default;
+  virtual ~ParagraphSkia();
 
   double GetMaxWidth() override;
 
@@ -94,6 +99,8 @@ class ParagraphSkia : public Paragraph {
   std::optional<std::vector<LineMetrics>> line_metrics_;
   std::vector<TextStyle> line_metrics_styles_;
   const bool impeller_enabled_;
+  std::weak_ptr<ParagraphCache> paragraph_cache_;
+  ParagraphCache::Key cache_key_;
 };
 
 }  // namespace txt
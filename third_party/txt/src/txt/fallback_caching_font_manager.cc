@@ -0,0 +1,169 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "fallback_caching_font_manager.h"
+
+#include <cstring>
+#include <utility>
+
+#include "flutter/fml/logging.h"
+#include "flutter/fml/trace_event.h"
+#include "third_party/skia/include/core/SkStream.h"
+#include "third_party/skia/include/core/SkTypeface.h"
+
+namespace txt {
+
+namespace {
+
+// Text in a single script needs a handful of fallback decisions, but text
+// that mixes in CJK characters can need one for each character. The cache
+// starts over once it holds this many decisions.
+constexpr size_t kMaxFallbacks = 4096;
+
+template <typename T>
+void AppendBytes(std::string& key, const T& value) {
+  char bytes[sizeof(T)];
+  std::memcpy(bytes, &value, sizeof(T));
+  key.append(bytes, sizeof(T));
+}
+
+void AppendString(std::string& key, const char* string) {
+  const size_t length = string ? std::strlen(string) : 0;
+  AppendBytes(key, length);
+  key.append(string ? string : "", length);
+}
+
+std::string MakeFallbackKey(const char family_name[],
+                            const SkFontStyle& style,
+                            const char* bcp47[],
+                            int bcp47_count,
+                            SkUnichar character) {
+  std::string key;
+  AppendBytes(key, character);
+  AppendBytes(key, family_name != nullptr);
+  AppendString(key, family_name);
+  AppendBytes(key, style.weight());
+  AppendBytes(key, style.width());
+  AppendBytes(key, style.slant());
+  AppendBytes(key, bcp47_count);
+  for (int i = 0; i < bcp47_count; i++) {
+    AppendString(key, bcp47[i]);
+  }
+  return key;
+}
+
+}  // namespace
+
+FallbackCachingFontManager::FallbackCachingFontManager(
+    sk_sp<SkFontMgr> font_manager)
+    : font_manager_(std::move(font_manager)) {
+  FML_DCHECK(font_manager_ != nullptr);
+}
+
+FallbackCachingFontManager::~FallbackCachingFontManager() = default;
+
+size_t FallbackCachingFontManager::GetCachedFallbackCount() const {
+  std::scoped_lock lock(fallbacks_mutex_);
+  return fallbacks_.size();
+}
+
+// |SkFontMgr|
+int FallbackCachingFontManager::onCountFamilies() const {
+  return font_manager_->countFamilies();
+}
+
+// |SkFontMgr|
+void FallbackCachingFontManager::onGetFamilyName(int index,
+                                                 SkString* familyName) const {
+  font_manager_->getFamilyName(index, familyName);
+}
+
+// |SkFontMgr|
+sk_sp<SkFontStyleSet> FallbackCachingFontManager::onCreateStyleSet(
+    int index) const {
+  return font_manager_->createStyleSet(index);
+}
+
+// |SkFontMgr|
+sk_sp<SkFontStyleSet> FallbackCachingFontManager::onMatchFamily(
+    const char familyName[]) const {
+  return font_manager_->matchFamily(familyName);
+}
+
+// |SkFontMgr|
+sk_sp<SkTypeface> FallbackCachingFontManager::onMatchFamilyStyle(
+    const char familyName[],
+    const SkFontStyle& style) const {
+  return font_manager_->matchFamilyStyle(familyName, style);
+}
+
+// |SkFontMgr|
+sk_sp<SkTypeface> FallbackCachingFontManager::onMatchFamilyStyleCharacter(
+    const char familyName[],
+    const SkFontStyle& style,
+    const char* bcp47[],
+    int bcp47Count,
+    SkUnichar character) const {
+  std::string key =
+      MakeFallbackKey(familyName, style, bcp47, bcp47Count, character);
+  {
+    std::scoped_lock lock(fallbacks_mutex_);
+    auto found = fallbacks_.find(key);
+    if (found != fallbacks_.end()) {
+      return found->second;
+    }
+  }
+
+  // The platform lookup can be slow, so it is made without holding the lock.
+  sk_sp<SkTypeface> typeface;
+  {
+    TRACE_EVENT0("flutter", "FallbackCachingFontManager::MatchCharacter");
+    typeface = font_manager_->matchFamilyStyleCharacter(
+        familyName, style, bcp47, bcp47Count, character);
+  }
+
+  std::scoped_lock lock(fallbacks_mutex_);
+  if (fallbacks_.size() >= kMaxFallbacks) {
+    fallbacks_.clear();
+  }
+  fallbacks_.emplace(std::move(key), typeface);
+  return typeface;
+}
+
+// |SkFontMgr|
+sk_sp<SkTypeface> FallbackCachingFontManager::onMakeFromData(
+    sk_sp<SkData> data,
+    int ttcIndex) const {
+  return font_manager_->makeFromData(std::move(data), ttcIndex);
+}
+
+// |SkFontMgr|
+sk_sp<SkTypeface> FallbackCachingFontManager::onMakeFromStreamIndex(
+    std::unique_ptr<SkStreamAsset> stream,
+    int ttcIndex) const {
+  return font_manager_->makeFromStream(std::move(stream), ttcIndex);
+}
+
+// |SkFontMgr|
+sk_sp<SkTypeface> FallbackCachingFontManager::onMakeFromStreamArgs(
+    std::unique_ptr<SkStreamAsset> stream,
+    const SkFontArguments& args) const {
+  return font_manager_->makeFromStream(std::move(stream), args);
+}
+
+// |SkFontMgr|
+sk_sp<SkTypeface> FallbackCachingFontManager::onMakeFromFile(
+    const char path[],
+    int ttcIndex) const {
+  return font_manager_->makeFromFile(path, ttcIndex);
+}
+
+// |SkFontMgr|
+sk_sp<SkTypeface> FallbackCachingFontManager::onLegacyMakeTypeface(
+    const char familyName[],
+    SkFontStyle style) const {
+  return font_manager_->legacyMakeTypeface(familyName, style);
+}
+
+}  // namespace txt
@@ -0,0 +1,95 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef LIB_TXT_SRC_FALLBACK_CACHING_FONT_MANAGER_H_
+#define LIB_TXT_SRC_FALLBACK_CACHING_FONT_MANAGER_H_
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "flutter/fml/macros.h"
+#include "third_party/skia/include/core/SkFontMgr.h"
+#include "third_party/skia/include/core/SkRefCnt.h"
+
+namespace txt {
+
+//------------------------------------------------------------------------------
+/// @brief      A font manager that forwards to another font manager, usually
+///             the platform's, and remembers which typeface it picked as the
+///             fallback for a character.
+///
+///             Text shaping asks for a fallback typeface for every run of
+///             characters that the requested fonts can't render, and the
+///             platform resolves each request by searching the system fonts.
+///             The decisions are cached by family name, style, locales and
+///             character, including the decision that no font has the
+///             character. Because the font collection keeps this manager
+///             when its fonts change, the decisions outlive the Skia font
+///             collections that are rebuilt from it.
+class FallbackCachingFontManager : public SkFontMgr {
+ public:
+  explicit FallbackCachingFontManager(sk_sp<SkFontMgr> font_manager);
+
+  ~FallbackCachingFontManager() override;
+
+  size_t GetCachedFallbackCount() const;
+
+ private:
+  // |SkFontMgr|
+  int onCountFamilies() const override;
+
+  // |SkFontMgr|
+  void onGetFamilyName(int index, SkString* familyName) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkFontStyleSet> onCreateStyleSet(int index) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkFontStyleSet> onMatchFamily(const char familyName[]) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkTypeface> onMatchFamilyStyle(const char familyName[],
+                                       const SkFontStyle&) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkTypeface> onMatchFamilyStyleCharacter(
+      const char familyName[],
+      const SkFontStyle&,
+      const char* bcp47[],
+      int bcp47Count,
+      SkUnichar character) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkTypeface> onMakeFromData(sk_sp<SkData>, int ttcIndex) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkTypeface> onMakeFromStreamIndex(std::unique_ptr<SkStreamAsset>,
+                                          int ttcIndex) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkTypeface> onMakeFromStreamArgs(std::unique_ptr<SkStreamAsset>,
+                                         const SkFontArguments&) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkTypeface> onMakeFromFile(const char path[],
+                                   int ttcIndex) const override;
+
+  // |SkFontMgr|
+  sk_sp<SkTypeface> onLegacyMakeTypeface(const char familyName[],
+                                         SkFontStyle) const override;
+
+  const sk_sp<SkFontMgr> font_manager_;
+
+  mutable std::mutex fallbacks_mutex_;
+  // Keyed by the family name, style, locales and character of the request,
+  // encoded as bytes.
+  mutable std::unordered_map<std::string, sk_sp<SkTypeface>> fallbacks_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(FallbackCachingFontManager);
+};
+
+}  // namespace txt
+
+#endif  // LIB_TXT_SRC_FALLBACK_CACHING_FONT_MANAGER_H_
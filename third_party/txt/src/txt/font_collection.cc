@@ -26,12 +26,28 @@
 #include <vector>
 #include "flutter/fml/logging.h"
 #include "flutter/fml/trace_event.h"
+#include "txt/fallback_caching_font_manager.h"
 #include "txt/platform.h"
 #include "txt/text_style.h"
 
 namespace txt {
 
-FontCollection::FontCollection() : enable_font_fallback_(true) {}
+namespace {
+
+// Fallback fonts come from the default font manager, so its fallback
+// decisions are cached across changes to the other fonts of the collection.
+sk_sp<SkFontMgr> CacheFallbacks(sk_sp<SkFontMgr> font_manager) {
+  if (!font_manager) {
+    return nullptr;
+  }
+  return sk_make_sp<FallbackCachingFontManager>(std::move(font_manager));
+}
+
+}  // namespace
+
+FontCollection::FontCollection()
+    : enable_font_fallback_(true),
+      paragraph_cache_(std::make_shared<ParagraphCache>()) {}
 
 FontCollection::~FontCollection() {
   if (skt_collection_) {
@@ -45,28 +61,34 @@ size_t FontCollection::GetFontManagersCount() const {
 
 void FontCollection::SetupDefaultFontManager(
     uint32_t font_initialization_data) {
-  default_font_manager_ = GetDefaultFontManager(font_initialization_data);
+  default_font_manager_ =
+      CacheFallbacks(GetDefaultFontManager(font_initialization_data));
   skt_collection_.reset();
+  paragraph_cache_->Clear();
 }
 
 void FontCollection::SetDefaultFontManager(sk_sp<SkFontMgr> font_manager) {
-  default_font_manager_ = font_manager;
+  default_font_manager_ = CacheFallbacks(std::move(font_manager));
   skt_collection_.reset();
+  paragraph_cache_->Clear();
 }
 
 void FontCollection::SetAssetFontManager(sk_sp<SkFontMgr> font_manager) {
   asset_font_manager_ = font_manager;
   skt_collection_.reset();
+  paragraph_cache_->Clear();
 }
 
 void FontCollection::SetDynamicFontManager(sk_sp<SkFontMgr> font_manager) {
   dynamic_font_manager_ = font_manager;
   skt_collection_.reset();
+  paragraph_cache_->Clear();
 }
 
 void FontCollection::SetTestFontManager(sk_sp<SkFontMgr> font_manager) {
   test_font_manager_ = font_manager;
   skt_collection_.reset();
+  paragraph_cache_->Clear();
 }
 
 // Return the available font managers in the order they should be queried.
@@ -88,12 +110,14 @@ void FontCollection::DisableFontFallback() {
   if (skt_collection_) {
     skt_collection_->disableFontFallback();
   }
+  paragraph_cache_->Clear();
 }
 
 void FontCollection::ClearFontFamilyCache() {
   if (skt_collection_) {
     skt_collection_->clearCaches();
   }
+  paragraph_cache_->Clear();
 }
 
 sk_sp<skia::textlayout::FontCollection>
@@ -118,4 +142,8 @@ FontCollection::CreateSktFontCollection() {
   return skt_collection_;
 }
 
+std::shared_ptr<ParagraphCache> FontCollection::GetParagraphCache() const {
+  return paragraph_cache_;
+}
+
 }  // namespace txt
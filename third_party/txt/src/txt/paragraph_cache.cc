@@ -0,0 +1,90 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "paragraph_cache.h"
+
+#include <functional>
+#include <iterator>
+
+#include "flutter/fml/trace_event.h"
+
+namespace txt {
+
+namespace {
+
+// The number of Skia paragraphs that are kept for reuse.
+constexpr size_t kMaxEntries = 256;
+
+}  // namespace
+
+bool ParagraphCache::Key::operator==(const Key& other) const {
+  return generation == other.generation && description == other.description &&
+         paints == other.paints;
+}
+
+ParagraphCache::ParagraphCache() = default;
+
+ParagraphCache::~ParagraphCache() = default;
+
+uint64_t ParagraphCache::GetGeneration() const {
+  std::scoped_lock lock(mutex_);
+  return generation_;
+}
+
+std::unique_ptr<skia::textlayout::Paragraph> ParagraphCache::Take(
+    const Key& key) {
+  const size_t hash = std::hash<std::string>{}(key.description);
+  std::scoped_lock lock(mutex_);
+  auto [begin, end] = index_.equal_range(hash);
+  for (auto found = begin; found != end; ++found) {
+    if (found->second->key == key) {
+      TRACE_EVENT0("flutter", "ParagraphCache::Hit");
+      auto paragraph = std::move(found->second->paragraph);
+      entries_.erase(found->second);
+      index_.erase(found);
+      return paragraph;
+    }
+  }
+  return nullptr;
+}
+
+void ParagraphCache::Put(
+    Key key,
+    std::unique_ptr<skia::textlayout::Paragraph> paragraph) {
+  if (!paragraph || key.description.size() > kMaxDescriptionSize) {
+    return;
+  }
+  const size_t hash = std::hash<std::string>{}(key.description);
+  std::scoped_lock lock(mutex_);
+  if (key.generation != generation_) {
+    return;
+  }
+  while (entries_.size() >= kMaxEntries) {
+    const auto& oldest = entries_.back();
+    auto [begin, end] = index_.equal_range(oldest.hash);
+    for (auto found = begin; found != end; ++found) {
+      if (found->second == std::prev(entries_.end())) {
+        index_.erase(found);
+        break;
+      }
+    }
+    entries_.pop_back();
+  }
+  entries_.push_front(Entry{hash, std::move(key), std::move(paragraph)});
+  index_.emplace(hash, entries_.begin());
+}
+
+void ParagraphCache::Clear() {
+  std::scoped_lock lock(mutex_);
+  generation_++;
+  index_.clear();
+  entries_.clear();
+}
+
+size_t ParagraphCache::GetCount() const {
+  std::scoped_lock lock(mutex_);
+  return entries_.size();
+}
+
+}  // namespace txt
@@ -0,0 +1,96 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef LIB_TXT_SRC_PARAGRAPH_CACHE_H_
+#define LIB_TXT_SRC_PARAGRAPH_CACHE_H_
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "flutter/display_list/dl_paint.h"
+#include "flutter/fml/macros.h"
+#include "third_party/skia/modules/skparagraph/include/Paragraph.h"  // nogncheck
+
+namespace txt {
+
+//------------------------------------------------------------------------------
+/// @brief      A cache of the Skia paragraphs of destroyed paragraphs, so that
+///             an identical paragraph that is built later, such as the label
+///             of a list item that is built again, reuses their shaped text
+///             and, when it is laid out at the same width, their line breaks.
+///
+///             A cached Skia paragraph is handed to one paragraph at a time,
+///             and is returned to the cache when that paragraph is destroyed.
+///             The cache is cleared whenever the fonts of its font collection
+///             change.
+class ParagraphCache {
+ public:
+  //----------------------------------------------------------------------------
+  /// @brief      Everything that a paragraph was built from.
+  struct Key {
+    /// The generation of the cache when the paragraph was built.
+    uint64_t generation = 0;
+    /// The paragraph style, then the text styles, text and placeholders in the
+    /// order they were added, encoded as bytes.
+    std::string description;
+    /// The paints referenced by the text styles.
+    std::vector<flutter::DlPaint> paints;
+
+    bool operator==(const Key& other) const;
+  };
+
+  /// Paragraphs described by more bytes than this, which are mostly those with
+  /// very long text, are not worth keeping.
+  static constexpr size_t kMaxDescriptionSize = 64 * 1024;
+
+  ParagraphCache();
+
+  ~ParagraphCache();
+
+  uint64_t GetGeneration() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Remove a Skia paragraph that was built from `key` from the
+  ///             cache.
+  ///
+  /// @return     The Skia paragraph, or nullptr if none is cached.
+  std::unique_ptr<skia::textlayout::Paragraph> Take(const Key& key);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Add the Skia paragraph of a paragraph that is being destroyed,
+  ///             evicting the least recently added paragraphs if the cache is
+  ///             full. Paragraphs built before the cache was last cleared, and
+  ///             paragraphs with very long descriptions, are not cached.
+  void Put(Key key, std::unique_ptr<skia::textlayout::Paragraph> paragraph);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Remove all paragraphs and start a new generation.
+  void Clear();
+
+  size_t GetCount() const;
+
+ private:
+  struct Entry {
+    size_t hash;
+    Key key;
+    std::unique_ptr<skia::textlayout::Paragraph> paragraph;
+  };
+
+  mutable std::mutex mutex_;
+  uint64_t generation_ = 0;
+  // Ordered from the most to the least recently added.
+  std::list<Entry> entries_;
+  std::unordered_multimap<size_t, std::list<Entry>::iterator> index_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(ParagraphCache);
+};
+
+}  // namespace txt
+
+#endif  // LIB_TXT_SRC_PARAGRAPH_CACHE_H_
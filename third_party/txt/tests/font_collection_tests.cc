@@ -18,11 +18,65 @@
 
 #include <sstream>
 
+#include "txt/fallback_caching_font_manager.h"
 #include "txt/font_collection.h"
 
 namespace txt {
 namespace testing {
 
+namespace {
+
+// Counts the fallback requests that reach it, and has no fonts.
+class FallbackCountingFontManager : public SkFontMgr {
+ public:
+  mutable int fallback_requests = 0;
+
+ private:
+  int onCountFamilies() const override { return 0; }
+  void onGetFamilyName(int index, SkString* familyName) const override {}
+  sk_sp<SkFontStyleSet> onCreateStyleSet(int index) const override {
+    return nullptr;
+  }
+  sk_sp<SkFontStyleSet> onMatchFamily(const char familyName[]) const override {
+    return nullptr;
+  }
+  sk_sp<SkTypeface> onMatchFamilyStyle(const char familyName[],
+                                       const SkFontStyle&) const override {
+    return nullptr;
+  }
+  sk_sp<SkTypeface> onMatchFamilyStyleCharacter(
+      const char familyName[],
+      const SkFontStyle&,
+      const char* bcp47[],
+      int bcp47Count,
+      SkUnichar character) const override {
+    fallback_requests++;
+    return nullptr;
+  }
+  sk_sp<SkTypeface> onMakeFromData(sk_sp<SkData>, int ttcIndex) const override {
+    return nullptr;
+  }
+  sk_sp<SkTypeface> onMakeFromStreamIndex(std::unique_ptr<SkStreamAsset>,
+                                          int ttcIndex) const override {
+    return nullptr;
+  }
+  sk_sp<SkTypeface> onMakeFromStreamArgs(
+      std::unique_ptr<SkStreamAsset>,
+      const SkFontArguments&) const override {
+    return nullptr;
+  }
+  sk_sp<SkTypeface> onMakeFromFile(const char path[],
+                                   int ttcIndex) const override {
+    return nullptr;
+  }
+  sk_sp<SkTypeface> onLegacyMakeTypeface(const char familyName[],
+                                         SkFontStyle) const override {
+    return nullptr;
+  }
+};
+
+}  // namespace
+
 class FontCollectionTests : public ::testing::Test {
  public:
   FontCollectionTests() {}
@@ -39,5 +93,48 @@ TEST_F(FontCollectionTests, SettingUpDefaultFontManagerClearsCache) {
   sk_font_collection = font_collection.CreateSktFontCollection();
   ASSERT_NE(sk_font_collection->getFallbackManager().get(), nullptr);
 }
+
+TEST_F(FontCollectionTests, CachesFallbackDecisions) {
+  auto counting_manager = sk_make_sp<FallbackCountingFontManager>();
+  FallbackCachingFontManager caching_manager(counting_manager);
+  const char* english[] = {"en-US"};
+  const char* japanese[] = {"ja-JP"};
+
+  caching_manager.matchFamilyStyleCharacter(nullptr, SkFontStyle(), english, 1,
+                                            0x4E00);
+  caching_manager.matchFamilyStyleCharacter(nullptr, SkFontStyle(), english, 1,
+                                            0x4E00);
+  EXPECT_EQ(counting_manager->fallback_requests, 1);
+  EXPECT_EQ(caching_manager.GetCachedFallbackCount(), 1u);
+
+  // Each locale, style, family and character is a separate decision.
+  caching_manager.matchFamilyStyleCharacter(nullptr, SkFontStyle(), japanese,
+                                            1, 0x4E00);
+  caching_manager.matchFamilyStyleCharacter(nullptr, SkFontStyle::Bold(),
+                                            english, 1, 0x4E00);
+  caching_manager.matchFamilyStyleCharacter("Roboto", SkFontStyle(), english,
+                                            1, 0x4E00);
+  caching_manager.matchFamilyStyleCharacter(nullptr, SkFontStyle(), english, 1,
+                                            0x4E01);
+  EXPECT_EQ(counting_manager->fallback_requests, 5);
+  EXPECT_EQ(caching_manager.GetCachedFallbackCount(), 5u);
+}
+
+TEST_F(FontCollectionTests, FallbackDecisionsSurviveFontChanges) {
+  auto counting_manager = sk_make_sp<FallbackCountingFontManager>();
+  FontCollection font_collection;
+  font_collection.SetDefaultFontManager(counting_manager);
+  const char* english[] = {"en-US"};
+
+  font_collection.CreateSktFontCollection()
+      ->getFallbackManager()
+      ->matchFamilyStyleCharacter(nullptr, SkFontStyle(), english, 1, 0x4E00);
+  font_collection.SetTestFontManager(sk_make_sp<FallbackCountingFontManager>());
+  font_collection.CreateSktFontCollection()
+      ->getFallbackManager()
+      ->matchFamilyStyleCharacter(nullptr, SkFontStyle(), english, 1, 0x4E00);
+  EXPECT_EQ(counting_manager->fallback_requests, 1);
+}
+
 }  // namespace testing
 }  // namespace txt
@@ -241,5 +241,102 @@ TEST_F(PainterTest, DrawTextBlobNoImpeller) {
 }
 #endif  // IMPELLER_SUPPORTS_RENDERING
 
+class ParagraphCacheTest : public ::testing::Test {
+ protected:
+  ParagraphCacheTest() : font_collection_(MakeFontCollection()) {}
+
+  static std::shared_ptr<txt::FontCollection> MakeFontCollection() {
+    auto font_collection = std::make_shared<txt::FontCollection>();
+    SetFonts(*font_collection);
+    return font_collection;
+  }
+
+  static void SetFonts(txt::FontCollection& font_collection) {
+    auto font_provider = std::make_unique<txt::TypefaceFontAssetProvider>();
+    for (auto& font : GetTestFontData()) {
+      font_provider->RegisterTypeface(font);
+    }
+    font_collection.SetAssetFontManager(
+        sk_make_sp<txt::AssetFontManager>(std::move(font_provider)));
+  }
+
+  std::unique_ptr<txt::Paragraph> Build(double font_size = 14,
+                                        SkColor color = SK_ColorBLACK) {
+    txt::TextStyle style;
+    style.color = color;
+    style.font_size = font_size;
+    style.font_families.push_back("ahem");
+    txt::ParagraphBuilderSkia builder(txt::ParagraphStyle(), font_collection_,
+                                      /*impeller_enabled=*/false);
+    builder.PushStyle(style);
+    builder.AddText(u"Hello World! Hello World! Hello World!");
+    builder.Pop();
+    return builder.Build();
+  }
+
+  size_t GetCachedParagraphCount() const {
+    return font_collection_->GetParagraphCache()->GetCount();
+  }
+
+  std::shared_ptr<txt::FontCollection> font_collection_;
+};
+
+TEST_F(ParagraphCacheTest, ReusesTheLayoutOfIdenticalParagraphs) {
+  auto paragraph = Build();
+  paragraph->Layout(100);
+  const double height = paragraph->GetHeight();
+  const size_t line_count = paragraph->GetNumberOfLines();
+  EXPECT_GT(line_count, 1u);
+  EXPECT_EQ(GetCachedParagraphCount(), 0u);
+
+  paragraph.reset();
+  EXPECT_EQ(GetCachedParagraphCount(), 1u);
+
+  paragraph = Build();
+  EXPECT_EQ(GetCachedParagraphCount(), 0u);
+  paragraph->Layout(100);
+  EXPECT_EQ(paragraph->GetHeight(), height);
+  EXPECT_EQ(paragraph->GetNumberOfLines(), line_count);
+
+  // A reused paragraph can still be laid out at other widths.
+  paragraph->Layout(10000);
+  EXPECT_EQ(paragraph->GetNumberOfLines(), 1u);
+}
+
+TEST_F(ParagraphCacheTest, DoesNotReuseDifferentParagraphs) {
+  Build()->Layout(100);
+  EXPECT_EQ(GetCachedParagraphCount(), 1u);
+
+  auto larger = Build(/*font_size=*/20);
+  auto red = Build(/*font_size=*/14, SK_ColorRED);
+  EXPECT_EQ(GetCachedParagraphCount(), 1u);
+
+  auto identical = Build();
+  EXPECT_EQ(GetCachedParagraphCount(), 0u);
+}
+
+TEST_F(ParagraphCacheTest, DoesNotCacheParagraphsWithVeryLongText) {
+  txt::ParagraphBuilderSkia builder(txt::ParagraphStyle(), font_collection_,
+                                    /*impeller_enabled=*/false);
+  const std::u16string text(txt::ParagraphCache::kMaxDescriptionSize, u'a');
+  builder.AddText(text);
+  builder.AddText(text);
+  builder.Build()->Layout(100);
+  EXPECT_EQ(GetCachedParagraphCount(), 0u);
+}
+
+TEST_F(ParagraphCacheTest, ChangingFontsClearsTheCache) {
+  auto built_before_change = Build();
+  Build()->Layout(100);
+  EXPECT_EQ(GetCachedParagraphCount(), 1u);
+
+  SetFonts(*font_collection_);
+  EXPECT_EQ(GetCachedParagraphCount(), 0u);
+
+  // Paragraphs shaped with the previous fonts are not cached either.
+  built_before_change.reset();
+  EXPECT_EQ(GetCachedParagraphCount(), 0u);
+}
+
 }  // namespace testing
 }  // namespace flutter